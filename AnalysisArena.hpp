@@ -0,0 +1,69 @@
+#ifndef ANALYSIS_ARENA_H
+#define ANALYSIS_ARENA_H
+
+#include "llvm/Support/Allocator.h"
+
+#include <type_traits>
+#include <utility>
+
+#include "ScopeHandler.hpp"
+
+using namespace llvm;
+
+/**
+ * Bump allocator owning every analysis node of a function.
+ * Nodes are never freed one by one: the slabs are released all together with the arena.
+ */
+class AnalysisArena {
+
+public:
+
+    /// @brief Create a new operand inside the arena, numbered in creation order
+    template<typename... Args>
+    Operand* makeOperand(Args&&... args) {
+        Operand* op = new (operands.Allocate()) Operand(std::forward<Args>(args)...);
+        op->index = numOperands++;
+        return op;
+    }
+
+    /// @brief Number of operands created so far
+    unsigned getNumOperands() const {
+        return numOperands;
+    }
+
+    /// @brief Raw storage for variable size nodes (e.g. ScopeMap), never destroyed
+    void* allocate(size_t size, size_t alignment) {
+        return nodes.Allocate(size, Align(alignment));
+    }
+
+    /// @brief Create a node which does not need its destructor to be called
+    template<typename T, typename... Args>
+    T* make(Args&&... args) {
+        static_assert(std::is_trivially_destructible<T>::value, "arena nodes are never destroyed");
+        return new (nodes.Allocate<T>()) T(std::forward<Args>(args)...);
+    }
+
+    AnalysisArena() = default;
+    AnalysisArena(const AnalysisArena&) = delete;
+    AnalysisArena& operator=(const AnalysisArena&) = delete;
+
+private:
+
+    /**
+     * Operands still own a name and the list of users, so they are destroyed with the arena
+     */
+    SpecificBumpPtrAllocator<Operand> operands;
+
+    /**
+     * Storage for trivially destructible nodes
+     */
+    BumpPtrAllocator nodes;
+
+    /**
+     * Counter of created operands. Dependencies always exist before their users,
+     * so creation order is a topological order of the operand graph
+     */
+    unsigned numOperands = 0;
+};
+
+#endif
@@ -8,61 +8,41 @@ std::string Block::getName() const {
 }
 
 void Block::recognize() {
-    errs() << "recognize()\n";
+    DEBUG_WITH_TYPE(VRA_VISIT_DEBUG_TYPE, dbgs() << "recognize(" << el->getName() << ")\n");
 
-    if (llvm::Loop* L = getOwner()->getLoopInfo()->getLoopFor(el)) {
-        ownedByLoop = L;
+    // the kind comes from the shape of the CFG, as seen by the scheduler: loop membership and predecessors
+    LoopInfo* LI = getOwner()->getLoopInfo();
+    ownedByLoop = LI->getLoopFor(el);
 
+    if (ownedByLoop) {
         // se è un loop header no problemi
-        if (L->getHeader() == el) {
+        if (ownedByLoop->getHeader() == el) {
             type = BlockTypology::LoopHeader;
             return;
         }
 
-        // BEGIN isLoopLatch ?
-        if (el == L->getLoopLatch()) {
+        if (ownedByLoop->isLoopLatch(el)) {
             type = BlockTypology::LoopLatch;
             return;
         }
+    }
 
-        llvm::SmallVector<llvm::BasicBlock*, 4> latches;
-        L->getLoopLatches(latches);
-        for (llvm::BasicBlock* latch : latches) {
-            if (latch == el) {
-                type = BlockTypology::LoopLatch;
-                return;
-            }
-        }
-        // END isLoopLatch
-
-        // BEGIN isExitBlock
-        if (el == L->getExitBlock()) {
+    // exit blocks are outside the loop they leave: one of the predecessors is in a loop not containing this block
+    for (BasicBlock* pred : predecessors(el)) {
+        llvm::Loop* predLoop = LI->getLoopFor(pred);
+        if (predLoop && !predLoop->contains(el)) {
             type = BlockTypology::LoopExit;
             return;
         }
-
-        llvm::SmallVector<llvm::BasicBlock*, 4> exists;
-        L->getExitBlocks(exists);
-        for (llvm::BasicBlock* exit : exists) {
-            if (exit == el) {
-                type = BlockTypology::LoopExit;
-                return;
-            }
-        }
-        // END isExitBlock
     }
 
-    Instruction* term = el->getTerminator();
-    if (dyn_cast<BranchInst>(term)) {
-        type = BlockTypology::StandardFork;
-        return;
-    } else if (dyn_cast<SwitchInst>(term)) {
-        type = BlockTypology::StandardFork;
+    if (el->hasNPredecessorsOrMore(2)) {
+        type = BlockTypology::StandardMerge;
         return;
     }
 
-    if (!llvm::pred_empty(el) && el->getUniquePredecessor()) {
-        type = BlockTypology::StandardMerge;
+    if (el->getTerminator()->getNumSuccessors() > 1) {
+        type = BlockTypology::StandardFork;
         return;
     }
 
@@ -103,45 +83,23 @@ llvm::Loop* Block::getLoop() {
 } 
 
 Scope* Block::emplaceScope(Scope* parent) {
-    scope = std::make_unique<Scope>(parent);
+    scope = std::make_unique<Scope>(parent, owner->getArena());
     return scope.get();
 }
 
 
-void Block::setNumLoopLatches(llvm::Loop* L) {
-    llvm::SmallVector<llvm::BasicBlock*, 4> latches;
-    L->getLoopLatches(latches);
-    num_latches = latches.size();
-}
-
-bool Block::isLoopWholeAnalyzed() {
-    return num_latches == 0;
-}
-
-void Block::decrRemainingLatches() {
-    num_latches--;
-}
-
-
-void Block::setNumBranches(short nb) {
-    num_branches = nb;
-}
-
-void Block::decrRemainingBranches() {
-    num_branches--;
-}
-
-bool Block::isForkWholeAnalyzed() {
-    return num_branches == 0;
-}
-
-
-void Block::rescaleLoopHeaderScope(Scope* latchScope) {
-
-    // 1 mergia il vecchio parentScope con il latchScope. Questo diventerà il nuovo parentScope
-
-    // rianalizza le istruzioni, soprattutto i phi nodes in modo completo
+void Block::rescaleLoopHeaderScope() {
+    if (owner->getFixpointConfig().enabled) {
+        owner->solveLoopFixpoint(this);
+        return;
+    }
 
+    // i valori dei latch diventano dipendenze dei phi: il solver itera fino alla stabilita' (widening sui phi),
+    // senza le passate di narrowing del fixpoint
+    RangeSolver& solver = owner->getSolver();
+    for (Operand* headerOp : owner->closeLoop(this)) {
+        solver.invalidate(headerOp);
+    }
 }
 
 FunctionAnalyzer* Block::getOwner() {
@@ -13,12 +13,12 @@ class FunctionAnalyzer;
 class BlockVisitor;
 
 enum BlockTypology {
-    StandardFork,       // fork with classic join block later without outgoing from current loop
+    StandardFork,       // block with several successors and a single predecessor
     InterLoopFork,      // fork within loop where join point is outside of its loop (break keyword)
-    StandardMerge,      // jojn point derived from StardardFork
+    StandardMerge,      // join point: block with several predecessors
     LoopHeader,         // first block of the loop with phi nodes
-    LoopLatch,          // block which connect loop header, used to understand when all blocks inside loop are analyzed
-    LoopExit,           // ExitBlock of the loop, can update unmerged inner loop fork
+    LoopLatch,          // block which connect loop header
+    LoopExit,           // ExitBlock of a loop (outside of it), joins the blocks leaving the loop
     ReturnBlock,        // block with Ret instruction
     SimpleBlock         // block without particularities, just follow it
 };
@@ -29,17 +29,6 @@ enum LoopRelation {
     OutsideLoop
 };
 
-enum AggregationType {
-    Fork, Loop
-};
-
-struct BlockAggregation {
-    AggregationType type;
-    Block* ref;
-
-    BlockAggregation(AggregationType type, Block* ref) : type(type), ref(ref) {}
-};
-
 class Block {
 
 public:
@@ -67,36 +56,10 @@ public:
     Scope* emplaceScope(Scope* parent);
 
     /**
-     * Set the initial number of latches to analyze before terminate loop analysis
-     */
-    void setNumLoopLatches(llvm::Loop* L);
-
-    /**
-     * Reduce the number of remaining latches by 1
-     */
-    void decrRemainingLatches();
-
-    /**
-     * Check if all latches were been analyzed
-     */
-    bool isLoopWholeAnalyzed();
-
-    /**
-     * Set the initial number of branches to analyze before handle merge
+     * Once all latches are analyzed, make the values they bring back dependencies of the header phi nodes
+     * and solve the loop to a post-fixpoint (see FunctionAnalyzer::closeLoop)
      */
-    void setNumBranches(short num_branches);
-
-    /**
-     * Reduce the number of remaining branches by 1
-     */
-    void decrRemainingBranches();
-
-    /**
-     * Check if all branches were been analyzed
-     */
-    bool isForkWholeAnalyzed();
-
-    void rescaleLoopHeaderScope(Scope* latchScope);
+    void rescaleLoopHeaderScope();
 
     FunctionAnalyzer* getOwner();
 
@@ -187,16 +150,6 @@ private:
      */
     std::pair<u_int64_t, u_int64_t> bounds = {0 , 1};
 
-    /**
-     * Num of loop latches to know when all loop path have been analyzed
-     */
-    short num_latches = 0;
-
-    /**
-     * Num of fork branches to know when all loop path have been analyzed
-     */
-    short num_branches = 0;
-
     /**
      * Scope of the block
      */
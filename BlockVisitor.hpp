@@ -5,6 +5,9 @@
 
 #include "BlockClass.hpp"
 
+/// Debug type of the trace of every visited block (-debug-only=vra-visit), more verbose than "vra"
+#define VRA_VISIT_DEBUG_TYPE "vra-visit"
+
 class Block;
 
 class BlockVisitor {
@@ -1,9 +1,21 @@
 #include "FunctionAnalyzer.hpp"
+
+#include "llvm/ADT/Statistic.h"
+#include "llvm/Support/TimeProfiler.h"
+
+#define DEBUG_TYPE "vra"
+
+STATISTIC(NumFunctionsAnalyzed, "Functions analyzed");
+STATISTIC(NumBlocksVisited, "Blocks visited");
+STATISTIC(NumLoopsClosed, "Loops closed (header scopes rescaled)");
+STATISTIC(NumOperandsCreated, "Operands created");
+
 #include "RangePropagationVisitor.cpp"
 #include "VRAPass.h"
 
-FunctionAnalyzer::FunctionAnalyzer(Function* el, llvm::VRAPass* vra_pass) : el(el), vra_pass(vra_pass),  
-    FAM(vra_pass->getMAM()->getResult<llvm::FunctionAnalysisManagerModuleProxy>(*el->getParent()).getManager()), 
+
+FunctionAnalyzer::FunctionAnalyzer(Function* el, llvm::VRAPass* vra_pass, FunctionAnalysisManager& FAM) : el(el), vra_pass(vra_pass),  
+    FAM(FAM), 
     SE(FAM.getResult<ScalarEvolutionAnalysis>(*el)),
     DT(&FAM.getResult<DominatorTreeAnalysis>(*el)) {
 
@@ -14,49 +26,149 @@ FunctionAnalyzer::FunctionAnalyzer(Function* el, llvm::VRAPass* vra_pass) : el(e
  * visitor pattern
  */
 void FunctionAnalyzer::analyze() {
+    TimeTraceScope timeScope("VRAFunction", el->getName());
+    ++NumFunctionsAnalyzed;
 
     Scope* globalScope = getPass()->getGlobalScope();
-    scope = std::make_unique<Scope>(globalScope);
+    scope = std::make_unique<Scope>(globalScope, arena);
 
     //TODO: predere il range dalle annotazioni o dai parametri passati
     for (llvm::Argument &Arg : el->args()) {
         std::string name = Arg.hasName() ? Arg.getName().str() : makeArgName();
         VarType vtype = Arg.getType()->isPointerTy() ? VarType::ArgumentRef : VarType::Argument;
-        auto argOp = std::make_unique<Operand>(name, nullptr, vtype);
-        scope->addOperand(std::move(argOp));
+        scope->addOperand(arena.makeOperand(name, vtype, &Arg));
     }
 
 
-    IA = std::make_shared<InstructionAnalyzer>(std::make_shared<RangeHandler>());
+    IA = std::make_shared<InstructionAnalyzer>(std::make_shared<RangeHandler>(), &arena);
+
+    // loops are always closed on their headers (see Block::rescaleLoopHeaderScope), widening makes them terminate
+    solver.setWidening(collectWideningThresholds(), getFixpointConfig().wideningDelay);
 
-    // preparare il blocco entry
-    BasicBlock* entryBlock = &el->getEntryBlock();
-    workload.push(entryBlock);
+    blockIndex.reserve(el->size());
 
     RangePropagationVisitor visitor(this);
-    
-    while (!workload.empty()) {
 
-        BasicBlock* curBasicBlock = workload.front();
-        workload.pop();
+    // weak topological order: each block once, after its predecessors; loops are closed when all their blocks are done
+    WTOScheduler schedule(*el, *loopInfo);
 
-        if (contains(curBasicBlock)) continue;
+    for (const WTOScheduler::Step& step : schedule.getSteps()) {
 
-        Block* curBlock = emplaceBlock(curBasicBlock, this);
+        if (step.kind == WTOScheduler::Step::CloseLoop) {
+            TimeTraceScope closeScope("VRACloseLoop", step.bb->getName());
+            ++NumLoopsClosed;
+            getBlockByLLVMBasicBlock(step.bb)->rescaleLoopHeaderScope();
+            continue;
+        }
+
+        Block* curBlock = emplaceBlock(step.bb, this);
+        ++NumBlocksVisited;
         
         curBlock->recognize();
         curBlock->accept(visitor);
     }
 
-
     // devo capire se la funzione non è void il range dei valori che usciranno
+    buildReturnOperand();
+
+    // the pools of constants and expressions are only needed while visiting the blocks
+    IA.reset();
 
+    NumOperandsCreated += arena.getNumOperands();
 }
 
 
-std::pair<u_int64_t, u_int64_t> FunctionAnalyzer::getLoopIterBounds(llvm::Loop* L) {
-    std::string indent(breadcrumb.size() + 1, '-');
+void FunctionAnalyzer::precomputeLoopIterBounds() {
+    for (llvm::Loop* L : loopInfo->getLoopsInPreorder()) {
+        loopIterBounds[L] = getLoopIterBounds(L);
+    }
+}
+
+void FunctionAnalyzer::precomputeInductionRanges() {
+    for (llvm::Loop* L : loopInfo->getLoopsInPreorder()) {
+        for (BasicBlock* BB : L->blocks()) {
+            // instructions of inner loops are visited with their own loop
+            if (loopInfo->getLoopFor(BB) != L) continue;
+
+            // when only the header leaves the loop, the other blocks do not run in the last iteration
+            bool inBody = BB != L->getHeader() && L->getExitingBlock() == L->getHeader();
+
+            for (Instruction& I : *BB) {
+                // header phi nodes are bounded when the loop is closed, by precomputeHeaderRanges
+                if (isa<PHINode>(I) && BB == L->getHeader()) continue;
+                if (!SE.isSCEVable(I.getType())) continue;
+
+                auto* AR = dyn_cast<SCEVAddRecExpr>(SE.getSCEV(&I));
+                if (!AR || AR->getLoop() != L) continue;
+
+                if (auto r = getAddRecRange(AR, inBody)) {
+                    inductionRanges[&I] = *r;
+                }
+            }
+        }
+    }
+}
+
+void FunctionAnalyzer::precomputeHeaderRanges() {
+    for (llvm::Loop* L : loopInfo->getLoopsInPreorder()) {
+        for (PHINode& phi : L->getHeader()->phis()) {
+            if (!SE.isSCEVable(phi.getType())) continue;
+
+            auto* AR = dyn_cast<SCEVAddRecExpr>(SE.getSCEV(&phi));
+            if (!AR || AR->getLoop() != L) continue;
+
+            if (auto r = getAddRecRange(AR)) {
+                headerRanges[&phi] = *r;
+            }
+        }
+    }
+}
+
+std::optional<Range> FunctionAnalyzer::getAddRecRange(const SCEVAddRecExpr* AR, bool beforeExit) {
+    if (!AR->isAffine()) return std::nullopt;
+
+    // {start,+,step}: values are start + step * k with k in [0, max backedge taken count]
+    auto* start = dyn_cast<SCEVConstant>(AR->getStart());
+    auto* step = dyn_cast<SCEVConstant>(AR->getStepRecurrence(SE));
+    auto* maxBTC = dyn_cast<SCEVConstant>(SE.getConstantMaxBackedgeTakenCount(AR->getLoop()));
+
+    if (start && step && maxBTC) {
+        unsigned bits = SE.getTypeSizeInBits(AR->getType());
+        double iterations = maxBTC->getAPInt().roundToDouble();
+        if (beforeExit && iterations > 0) iterations -= 1;
+
+        double first = start->getAPInt().signedRoundToDouble();
+        double last = first + step->getAPInt().signedRoundToDouble() * iterations;
+
+        // the closed form holds only if no value wraps: nsw, or the last value still fits the type
+        bool fits = std::min(first, last) >= APInt::getSignedMinValue(bits).signedRoundToDouble() &&
+                    std::max(first, last) <= APInt::getSignedMaxValue(bits).signedRoundToDouble();
+        if (AR->hasNoSignedWrap() || fits) {
+            return Range(static_cast<float>(first), static_cast<float>(last), true);
+        }
+
+        // it wraps: the signed range of SE holds, even when it is the whole type
+        ConstantRange CR = SE.getSignedRange(AR);
+        if (CR.isEmptySet()) return std::nullopt;
+        return Range(static_cast<float>(CR.getSignedMin().signedRoundToDouble()),
+                     static_cast<float>(CR.getSignedMax().signedRoundToDouble()), true);
+    }
+
+    // symbolic start or step: SE can still bound it, unless it may wrap
+    ConstantRange CR = SE.getSignedRange(AR);
+    if (CR.isFullSet() || CR.isEmptySet()) return std::nullopt;
 
+    return Range(static_cast<float>(CR.getSignedMin().signedRoundToDouble()),
+                 static_cast<float>(CR.getSignedMax().signedRoundToDouble()), true);
+}
+
+std::optional<Range> FunctionAnalyzer::getInductionRange(const Value* v) const {
+    auto it = inductionRanges.find(v);
+    if (it == inductionRanges.end()) return std::nullopt;
+    return it->second;
+}
+
+std::pair<u_int64_t, u_int64_t> FunctionAnalyzer::getLoopIterBounds(llvm::Loop* L) {
     u_int64_t min_iter = 0;
     u_int64_t max_iter = 0;
 
@@ -70,34 +182,30 @@ std::pair<u_int64_t, u_int64_t> FunctionAnalyzer::getLoopIterBounds(llvm::Loop*
             const APInt &val = constTrip->getValue()->getValue();
             max_iter = val.getZExtValue();
         } else {
-            outs() << indent << " -Trip count non costante\n";
+            LLVM_DEBUG(dbgs() << std::string(L->getLoopDepth(), '-') << " -Trip count non costante\n");
             // fallback conservativo
             max_iter = 100;
         }
     } else {
-        outs() << indent << " -Trip count uncomputable\n";
+        LLVM_DEBUG(dbgs() << std::string(L->getLoopDepth(), '-') << " -Trip count uncomputable\n");
         max_iter = 100;
     }
 
-    outs() << indent << " -Loop bounds: min_iter = " << min_iter << ", max_iter = " << max_iter << "\n";
+    LLVM_DEBUG(dbgs() << std::string(L->getLoopDepth(), '-') << " -Loop bounds: min_iter = " << min_iter
+                      << ", max_iter = " << max_iter << "\n");
 
     return {min_iter, max_iter};
 }
 
 bool FunctionAnalyzer::contains(BasicBlock* bb) const {
-    return std::any_of(
-        ownedBlocks.begin(),
-        ownedBlocks.end(),
-        [bb](const std::unique_ptr<Block>& b){
-            return b->getLLVMBasicBlock() == bb;
-        }
-    );
+    return blockIndex.count(bb) != 0;
 }
 
 
 
 Block* FunctionAnalyzer::addBlock(std::unique_ptr<Block> block) {
     Block* ptr = block.get();
+    blockIndex[ptr->getLLVMBasicBlock()] = ptr;
     ownedBlocks.push_back(std::move(block));
     return ptr;
 }
@@ -106,26 +214,11 @@ template<typename... Args>
 Block* FunctionAnalyzer::emplaceBlock(Args&&... args) {
     // Costruisce il Block direttamente dentro ownedBlocks
     ownedBlocks.emplace_back(std::make_unique<Block>(std::forward<Args>(args)...));
-    return ownedBlocks.back().get();
-}
-
-void FunctionAnalyzer::addBreadcrumb(BlockAggregation* agg) {
-    breadcrumb.push_back(agg);
-}
-
-BlockAggregation* FunctionAnalyzer::emplaceBreadcrumb(AggregationType type, Block* ref) {
-    // Alloca dinamicamente l’aggregazione
-    auto* agg = new BlockAggregation(type, ref);
-    breadcrumb.push_back(agg);
-    return agg;
-}
-
-void FunctionAnalyzer::popBreadcrumb() {
-    breadcrumb.pop_back();
+    Block* ptr = ownedBlocks.back().get();
+    blockIndex[ptr->getLLVMBasicBlock()] = ptr;
+    return ptr;
 }
 
-
-
 /**
  * Gestione loop header
  * Inizia sempre con un predecessore
@@ -133,18 +226,13 @@ void FunctionAnalyzer::popBreadcrumb() {
  * No istruzioni di return previste
  */
 void FunctionAnalyzer::initLoop(Block* header) {
-    errs() << "initLoop(header: " << header->getName() << ")";
-    
-    header->setNumLoopLatches(header->getLoop());
+    DEBUG_WITH_TYPE(VRA_VISIT_DEBUG_TYPE, dbgs() << "initLoop(header: " << header->getName() << ")\n");
 
-    Scope* parentScope = nullptr;
-    if (Block* parentBlock = header->findNearestDominatingParent()) {
-        parentScope = parentBlock->getScope();
-    }
-    
-    header->emplaceScope(parentScope);
+    header->setIterBounds(loopIterBounds.lookup(header->getLoop()));
 
-    setAnalysisBound();
+    emplaceDominatedScope(header);
+
+    setAnalysisBound(header);
 
     IA->loadBlock(header);
 
@@ -160,23 +248,132 @@ void FunctionAnalyzer::initLoop(Block* header) {
 
     IA->freeBlock();
 
-    header->setIterBounds(getLoopIterBounds(header->getLoop()));
+}
 
-    Instruction* term = header->getLLVMBasicBlock()->getTerminator();
-    if (auto* br = dyn_cast<BranchInst>(term)) {
+const FixpointConfig& FunctionAnalyzer::getFixpointConfig() const {
+    return vra_pass->getFixpointConfig();
+}
 
-        for (unsigned int i = 0; i<br->getNumSuccessors(); i++) {
-            if (llvm::Loop* L = getLoopInfo()->getLoopFor(br->getSuccessor(i))) {
-                if (L == header->getLoop()) { //solo il loop di appartenenza della funzione, altrimenti tutti i branch di loop annidati possono dare problemi
-                    enqueueBlock(br->getSuccessor(i));
-                    return;
+std::vector<float> FunctionAnalyzer::collectWideningThresholds() const {
+    std::vector<float> thresholds = getFixpointConfig().thresholds;
+
+    for (llvm::Loop* L : loopInfo->getLoopsInPreorder()) {
+        for (BasicBlock* BB : L->blocks()) {
+            for (Instruction& I : *BB) {
+
+                // loop bounds: constants compared inside the loop (and their neighbours for < and <=)
+                if (auto* cmp = dyn_cast<CmpInst>(&I)) {
+                    for (Value* v : cmp->operands()) {
+                        if (auto r = InstructionAnalyzer::getConstRange(v)) {
+                            thresholds.push_back(r->min - 1.0f);
+                            thresholds.push_back(r->min);
+                            thresholds.push_back(r->min + 1.0f);
+                        }
+                    }
+                }
+
+                // type limits of the values carried by the loop
+                if (isa<PHINode>(I) && I.getType()->isIntegerTy()) {
+                    unsigned bits = I.getType()->getIntegerBitWidth();
+                    thresholds.push_back(static_cast<float>(APInt::getSignedMinValue(bits).signedRoundToDouble()));
+                    thresholds.push_back(static_cast<float>(APInt::getSignedMaxValue(bits).signedRoundToDouble()));
+                } else if (isa<PHINode>(I) && I.getType()->isFloatingPointTy()) {
+                    thresholds.push_back(std::numeric_limits<float>::lowest());
+                    thresholds.push_back(std::numeric_limits<float>::max());
                 }
-                
             }
         }
-        
     }
 
+    std::sort(thresholds.begin(), thresholds.end());
+    thresholds.erase(std::unique(thresholds.begin(), thresholds.end()), thresholds.end());
+    return thresholds;
+}
+
+Operand* FunctionAnalyzer::getLatchOperand(PHINode& phi, BasicBlock* latch) {
+    Value* incoming = phi.getIncomingValueForBlock(latch);
+
+    if (Operand* constOp = IA->getConstOperand(incoming)) return constOp;
+
+    Block* latchBlock = getBlockByLLVMBasicBlock(latch);
+    if (!latchBlock || !latchBlock->getScope()) return nullptr;
+
+    return latchBlock->getScope()->lookup(incoming);
+}
+
+llvm::SmallVector<Operand*, 8> FunctionAnalyzer::closeLoop(Block* header) {
+    llvm::SmallVector<llvm::BasicBlock*, 4> latches;
+    header->getLoop()->getLoopLatches(latches);
+
+    llvm::SmallVector<Operand*, 8> headerOps;
+
+    for (PHINode& phi : header->getLLVMBasicBlock()->phis()) {
+        Operand* headerOp = header->getScope()->lookup(&phi);
+
+        // only merges of the entry value get the latch values (a header is closed once)
+        if (!headerOp || headerOp->opcode != OpCode::Merge || headerOp->numDeps != 1) continue;
+
+        // the header merges the entry value with the values coming back from every latch
+        Operand* back = nullptr;
+        bool known = true;
+        for (llvm::BasicBlock* latch : latches) {
+            Operand* latchOp = getLatchOperand(phi, latch);
+            if (!latchOp) {
+                known = false;
+                break;
+            }
+            back = back ? arena.makeOperand(headerOp->name, OpCode::Merge, back, latchOp, VarType::Local) : latchOp;
+        }
+
+        // an unknown value comes back: still a dependency, so that summaries see it as the solver does
+        if (!known || !back) {
+            back = arena.makeOperand("unknown", Range(NEG_INF, POS_INF), VarType::Constant);
+        }
+
+        // the trip count bounds what comes back even when no guard does (e.g. accumulators)
+        auto proved = headerRanges.find(&phi);
+        if (proved != headerRanges.end()) {
+            Operand* bound = arena.makeOperand("trip_bound", proved->second, VarType::Constant);
+            back = arena.makeOperand(headerOp->name, OpCode::Below, back, bound, VarType::Local);
+            back = arena.makeOperand(headerOp->name, OpCode::Above, back, bound, VarType::Local);
+        }
+
+        back->tryResolution();
+        headerOp->addDepencendy(back);
+        headerOps.push_back(headerOp);
+    }
+
+    return headerOps;
+}
+
+void FunctionAnalyzer::solveLoopFixpoint(Block* header) {
+    TimeTraceScope timeScope("VRALoopFixpoint", header->getLLVMBasicBlock()->getName());
+    [[maybe_unused]] unsigned evaluationsBefore = solver.getNumReevaluations();
+
+    llvm::SmallVector<Operand*, 8> headerOps = closeLoop(header);
+
+    // going up: back edges are followed, widening on headers guarantees termination
+    for (Operand* op : headerOps) {
+        solver.invalidate(op);
+    }
+
+    unsigned iterations = 0;
+    for (Operand* op : headerOps) {
+        iterations = std::max(iterations, op->updates);
+    }
+
+    // coming down: each pass refines the headers from the post-fixpoint, then their forward cone
+    for (unsigned pass = 0; pass < getFixpointConfig().narrowingPasses; ++pass) {
+        for (Operand* op : headerOps) {
+            Range cur = op->getRange();
+            Range result = op->evaluate();
+            Range refined(std::max(cur.min, result.min), std::min(cur.max, result.max));
+            if (refined.min <= refined.max) solver.narrow(op, refined);
+        }
+    }
+
+    LLVM_DEBUG(dbgs() << DEBUG_HEAD << " solveLoopFixpoint(header: " << header->getName() << "): " << iterations
+                      << " iterations, " << solver.getNumReevaluations() - evaluationsBefore << " evaluations\n");
 }
 
 /**
@@ -186,18 +383,13 @@ void FunctionAnalyzer::initLoop(Block* header) {
  * No istruzioni di return previste
  */
 void FunctionAnalyzer::initStandardFork(Block* fork) {
-    errs() << "initStandardFork(fork: " << fork->getName() << ")";
+    DEBUG_WITH_TYPE(VRA_VISIT_DEBUG_TYPE, dbgs() << "initStandardFork(fork: " << fork->getName() << ")\n");
 
     BasicBlock* el = fork->getLLVMBasicBlock();
 
-    Scope* parentScope = nullptr;
-    if (Block* parentBlock = fork->findNearestDominatingParent()) {
-        parentScope = parentBlock->getScope();
-    }
-    
-    fork->emplaceScope(parentScope);
+    emplaceDominatedScope(fork);
 
-    setAnalysisBound();
+    setAnalysisBound(fork);
 
     IA->loadBlock(fork);
 
@@ -213,156 +405,170 @@ void FunctionAnalyzer::initStandardFork(Block* fork) {
 
     IA->freeBlock();
 
-    // LAST PART: next blocks enqueue
-    short num_branches = 0;
-
-    Instruction* term = el->getTerminator();
-    if (auto* br = dyn_cast<BranchInst>(term)) {
-        
-        for (unsigned int i = 0; i<br->getNumSuccessors(); i++) {
-            auto* succ = br->getSuccessor(i);
-
-            // il successore non esce dal loop corrente
-            if (isNotBreakLoopKeyword(el, succ)) {
-                enqueueBlock(br->getSuccessor(i));
-                num_branches++;
-            } else {
-                // il successore esce dal loop corrente
-
-                Block* predFork = getPredecessorForkFromBreadcrumb();
-                predFork->setType(BlockTypology::InterLoopFork);
-            }
-        }
-        
-
-    } else if (auto* sw = dyn_cast<SwitchInst>(term)) {
-        
-        for (unsigned int i = 1; i <= sw->getNumCases(); i++) {
-            enqueueBlock(br->getSuccessor(i));
-            num_branches++;
-        }
-
-        //last op is default
-        enqueueBlock(br->getSuccessor(0));
-        num_branches++;
-    }
-
-    fork->setNumBranches(num_branches);
+    // i successori sono gia' ordinati dallo scheduler
 }
 
 void FunctionAnalyzer::processSimpleBlock(Block* block) {
-    errs() << "processSimpleBlock(block: " << block->getName() << ")";
+    DEBUG_WITH_TYPE(VRA_VISIT_DEBUG_TYPE, dbgs() << "processSimpleBlock(block: " << block->getName() << ")\n");
 
     BasicBlock* el = block->getLLVMBasicBlock();
 
-    Scope* parentScope = nullptr;
-    if (Block* parentBlock = block->findNearestDominatingParent()) {
-        parentScope = parentBlock->getScope();
-    }
-    
-    block->emplaceScope(parentScope);
+    emplaceDominatedScope(block);
 
-    setAnalysisBound();
+    setAnalysisBound(block);
 
     IA->loadBlock(block);
 
+    for (Instruction& I : *el) {
+        IA->analyzePHINodes(&I);
+    }
+
     for (Instruction& I : *el) {
         IA->analyzeExpressionNodes(&I);
     }
 
     IA->freeBlock();
 
-    Instruction* term = el->getTerminator();
-    if (auto* br = dyn_cast<BranchInst>(term)) {
-
-        auto* succ = br->getSuccessor(0);
-        if (isNotBreakLoopKeyword(el, succ)) {
-            enqueueBlock(br->getSuccessor(0));
-        }
-    } else if (auto* ret = dyn_cast<ReturnInst>(term)) {
-        
-        // se siamo immediatamente in un fork rimuovi un branch
-        Block* fork = getPredecessorForkFromBreadcrumb();
-        if (fork) fork->decrRemainingBranches();
-
-        handleReturn(ret);
-    }
+    handleBlockTerminator(block);
 }
 
 void FunctionAnalyzer::processLoopLatch(Block* latch) {
-    errs() << "processLoopLatch(latch: " << latch->getName() << ")";
-
-    // risalire al breadcrumb del loop corrente
-    Block* loopHeaderBlock = getLoopHeaderFromBreadcrumb();
-    loopHeaderBlock->decrRemainingLatches();
+    DEBUG_WITH_TYPE(VRA_VISIT_DEBUG_TYPE, dbgs() << "processLoopLatch(latch: " << latch->getName() << ")\n");
 
     BasicBlock* el = latch->getLLVMBasicBlock();
 
-    Scope* parentScope = nullptr;
-    if (Block* parentBlock = latch->findNearestDominatingParent()) {
-        parentScope = parentBlock->getScope();
-    }
-    
-    Scope* scope = latch->emplaceScope(parentScope);
+    emplaceDominatedScope(latch);
 
-    setAnalysisBound();
+    setAnalysisBound(latch);
 
     IA->loadBlock(latch);
 
+    for (Instruction& I : *el) {
+        IA->analyzePHINodes(&I);
+    }
+
     for (Instruction& I : *el) {
         IA->analyzeExpressionNodes(&I);
     }
 
     IA->freeBlock();
 
-    // se non analizzato tutto, chiudi qui
-    if (!loopHeaderBlock->isLoopWholeAnalyzed()) return;
+    // the header is solved by the scheduler once every block of the loop has been analyzed
+}
 
-    loopHeaderBlock->rescaleLoopHeaderScope(scope);
+Scope* FunctionAnalyzer::emplaceDominatedScope(Block* block) {
+    // the entry block sees the function scope (arguments)
+    Scope* parentScope = scope.get();
+    if (Block* parentBlock = block->findNearestDominatingParent()) {
+        parentScope = parentBlock->getScope();
+    }
 
-    if (BasicBlock* EB = loopHeaderBlock->getLoop()->getExitBlock()) {
-        enqueueBlock(EB);
-        return;
+    Scope* blockScope = block->emplaceScope(parentScope);
+    applyLoopGuard(block);
+    return blockScope;
+}
+
+void FunctionAnalyzer::applyLoopGuard(Block* block) {
+    BasicBlock* bb = block->getLLVMBasicBlock();
+    BasicBlock* headerBB = bb->getUniquePredecessor();
+    if (!headerBB || !loopInfo->isLoopHeader(headerBB)) return;
+
+    auto* br = dyn_cast<BranchInst>(headerBB->getTerminator());
+    if (!br || !br->isConditional() || br->getSuccessor(0) == br->getSuccessor(1)) return;
+
+    auto* cmp = dyn_cast<CmpInst>(br->getCondition());
+    Block* header = getBlockByLLVMBasicBlock(headerBB);
+    if (!cmp || !header || !header->getScope()) return;
+
+    CmpInst::Predicate taken = br->getSuccessor(0) == bb ? cmp->getPredicate() : cmp->getInversePredicate();
+
+    for (unsigned side = 0; side < 2; ++side) {
+        auto* phi = dyn_cast<PHINode>(cmp->getOperand(side));
+        if (!phi || phi->getParent() != headerBB) continue;
+
+        Operand* headerOp = header->getScope()->lookup(phi);
+        if (!headerOp) continue;
+
+        CmpInst::Predicate pred = side == 0 ? taken : CmpInst::getSwappedPredicate(taken);
+        if (Operand* guarded = makeGuardedOperand(headerOp, pred, cmp->getOperand(1 - side), header->getScope())) {
+            block->getScope()->refine(phi, guarded);
+        }
     }
+}
 
-    llvm::SmallVector<llvm::BasicBlock*, 4> latches;
-    loopHeaderBlock->getLoop()->getExitBlocks(latches);
-    for (llvm::BasicBlock* latch : latches) {
-        enqueueBlock(latch);
+Operand* FunctionAnalyzer::makeGuardBound(Value* other, float shift, Scope* from) {
+    if (auto r = InstructionAnalyzer::getConstRange(other)) {
+        return arena.makeOperand("guard", Range(r->min + shift, r->max + shift), VarType::Constant);
     }
 
-    popBreadcrumb();
-}
+    Operand* op = from->lookup(other);
+    if (!op || shift == 0.0f) return op;
 
-void FunctionAnalyzer::handleStandardMerge(Block* merge) {
-    errs() << "handleStandardMerge(merge: " << merge->getName() << ")";
+    Operand* delta = arena.makeOperand("guard", Range(shift, shift), VarType::Constant);
+    return arena.makeOperand(op->name, OpCode::Add, op, delta, VarType::Local);
+}
 
-    Block* forkBlock = getForkFromBreadcrumb();
-    forkBlock->decrRemainingBranches();
+Operand* FunctionAnalyzer::makeGuardedOperand(Operand* op, CmpInst::Predicate pred, Value* other, Scope* from) {
+    // strict comparisons exclude the bound, which for integers means one unit. Unsigned ones are not
+    // signed ones when a side may be negative, they are not used
+    float step = other->getType()->isIntegerTy() ? 1.0f : 0.0f;
+
+    Operand* upper = nullptr;
+    Operand* lower = nullptr;
+    switch (pred) {
+        case CmpInst::ICMP_SLT: case CmpInst::FCMP_OLT: case CmpInst::FCMP_ULT:
+            upper = makeGuardBound(other, -step, from);
+            break;
+        case CmpInst::ICMP_SLE: case CmpInst::FCMP_OLE: case CmpInst::FCMP_ULE:
+            upper = makeGuardBound(other, 0.0f, from);
+            break;
+        case CmpInst::ICMP_SGT: case CmpInst::FCMP_OGT: case CmpInst::FCMP_UGT:
+            lower = makeGuardBound(other, step, from);
+            break;
+        case CmpInst::ICMP_SGE: case CmpInst::FCMP_OGE: case CmpInst::FCMP_UGE:
+            lower = makeGuardBound(other, 0.0f, from);
+            break;
+        case CmpInst::ICMP_EQ: case CmpInst::FCMP_OEQ: case CmpInst::FCMP_UEQ:
+            upper = lower = makeGuardBound(other, 0.0f, from);
+            break;
+        default:
+            return nullptr;
+    }
+    if (!upper && !lower) return nullptr;
 
-    if (!forkBlock->isForkWholeAnalyzed()) return;
+    Operand* guarded = op;
+    if (upper) guarded = arena.makeOperand(op->name, OpCode::Below, guarded, upper, VarType::Local);
+    if (lower) guarded = arena.makeOperand(op->name, OpCode::Above, guarded, lower, VarType::Local);
+    guarded->tryResolution();
+    return guarded;
+}
 
-    BasicBlock* el = merge->getLLVMBasicBlock();
+Scope* FunctionAnalyzer::emplaceJoinScope(Block* block) {
+    Scope* joined = emplaceDominatedScope(block);
 
-    Scope* parentScope = nullptr;
-    if (BasicBlock* bb = merge->getLLVMBasicBlock()->getUniquePredecessor()) {
-        parentScope = getBlockByLLVMBasicBlock(bb)->getScope();
-    } else {
+    // the dominator of a block with a unique predecessor is that predecessor: nothing to join, and merging
+    // its scope again would drop the loop guard (see applyLoopGuard)
+    if (block->getLLVMBasicBlock()->getUniquePredecessor()) return joined;
 
-        std::unique_ptr<Scope> tempParentScopeHolder = nullptr;
-        for (llvm::BasicBlock *pred : llvm::predecessors(merge->getLLVMBasicBlock())) {
-            if (tempParentScopeHolder == nullptr) {
-                std::make_unique<Scope>(getBlockByLLVMBasicBlock(pred)->getScope());
-            } else {
-                tempParentScopeHolder->mergeWith(getBlockByLLVMBasicBlock(pred)->getScope());
-            }
-        }
-        parentScope = tempParentScopeHolder.get();
+    // back edges come from blocks not analyzed yet
+    SmallVector<Scope*, 8> predScopes;
+    for (BasicBlock* pred : predecessors(block->getLLVMBasicBlock())) {
+        Block* predBlock = getBlockByLLVMBasicBlock(pred);
+        if (predBlock && predBlock->getScope()) predScopes.push_back(predBlock->getScope());
     }
+    joined->mergeWith(predScopes);
+
+    return joined;
+}
 
-    merge->emplaceScope(parentScope);
+void FunctionAnalyzer::handleStandardMerge(Block* merge) {
+    DEBUG_WITH_TYPE(VRA_VISIT_DEBUG_TYPE, dbgs() << "handleStandardMerge(merge: " << merge->getName() << ")\n");
+
+    BasicBlock* el = merge->getLLVMBasicBlock();
+
+    emplaceJoinScope(merge);
 
-    setAnalysisBound();
+    setAnalysisBound(merge);
 
     IA->loadBlock(merge);
 
@@ -376,36 +582,17 @@ void FunctionAnalyzer::handleStandardMerge(Block* merge) {
 
     IA->freeBlock();
 
-    // pulisci la breadcrumb ora che il fork è terminato
-    popBreadcrumb();
-
     handleBlockTerminator(merge);
 }
 
 void FunctionAnalyzer::handleLoopExit(Block* exit) {
-    errs() << "handleLoopExit(exit: " << exit->getName() << ")";
+    DEBUG_WITH_TYPE(VRA_VISIT_DEBUG_TYPE, dbgs() << "handleLoopExit(exit: " << exit->getName() << ")\n");
 
     BasicBlock* el = exit->getLLVMBasicBlock();
 
-    Scope* parentScope = nullptr;
-    if (BasicBlock* bb = exit->getLLVMBasicBlock()->getUniquePredecessor()) {
-        parentScope = getBlockByLLVMBasicBlock(bb)->getScope();
-    } else {
+    emplaceJoinScope(exit);
 
-        std::unique_ptr<Scope> tempParentScopeHolder = nullptr;
-        for (llvm::BasicBlock *pred : llvm::predecessors(exit->getLLVMBasicBlock())) {
-            if (tempParentScopeHolder == nullptr) {
-                std::make_unique<Scope>(getBlockByLLVMBasicBlock(pred)->getScope());
-            } else {
-                tempParentScopeHolder->mergeWith(getBlockByLLVMBasicBlock(pred)->getScope());
-            }
-        }
-        parentScope = tempParentScopeHolder.get();
-    }
-
-    exit->emplaceScope(parentScope);
-
-    setAnalysisBound();
+    setAnalysisBound(exit);
 
     IA->loadBlock(exit);
 
@@ -422,146 +609,63 @@ void FunctionAnalyzer::handleLoopExit(Block* exit) {
     handleBlockTerminator(exit);
 }
 
-void FunctionAnalyzer::enqueueBlock(BasicBlock* B) {
-    workload.push(B);
+Block* FunctionAnalyzer::getBlockByLLVMBasicBlock(BasicBlock* bb) const {
+    return blockIndex.lookup(bb);
 }
 
-Block* FunctionAnalyzer::getLoopHeaderFromBreadcrumb() const {
-    // scorri breadcrumb a ritroso (LIFO)
-    for (auto it = breadcrumb.rbegin(); it != breadcrumb.rend(); ++it) {
-        BlockAggregation* agg = *it;
-        if (agg->type == AggregationType::Loop) {
-            return agg->ref;
-        }
+void FunctionAnalyzer::setAnalysisBound(Block* block) {
+    // loops are solved by the fixpoint, operations do not have to account for iterations
+    if (getFixpointConfig().enabled) {
+        IA->setCurrentIterBounds({1,1});
+        return;
     }
-    return nullptr;
-}
 
-Block* FunctionAnalyzer::getForkFromBreadcrumb() const {
-    // scorri breadcrumb a ritroso (LIFO)
-    for (auto it = breadcrumb.rbegin(); it != breadcrumb.rend(); ++it) {
-        BlockAggregation* agg = *it;
-        if (agg->type == AggregationType::Fork) {
-            return agg->ref;
-        }
+    if (llvm::Loop* L = block->getLoop()) {
+        IA->setCurrentIterBounds(loopIterBounds.lookup(L));
+    } else {
+        IA->setCurrentIterBounds({1,1});
     }
-    return nullptr;
 }
 
-Block* FunctionAnalyzer::getPredecessorForkFromBreadcrumb() const {
-    // scorri breadcrumb a ritroso (LIFO)
-    for (auto it = breadcrumb.rbegin(); it != breadcrumb.rend(); ++it) {
-        BlockAggregation* agg = *it;
-        if (agg->type == AggregationType::Fork) {
-            return agg->ref;
-        } else {
-            return nullptr;
-        }
+void FunctionAnalyzer::handleBlockTerminator(Block* bb) {
+    Instruction* term = bb->getLLVMBasicBlock()->getTerminator();
+    if (auto* ret = dyn_cast<ReturnInst>(term)) {
+        handleReturn(bb, ret);
     }
-    return nullptr;
 }
 
-Block* FunctionAnalyzer::getBlockByLLVMBasicBlock(BasicBlock* bb) const {
-    for (auto const& up : ownedBlocks) {
-        if (up->getLLVMBasicBlock() == bb)
-            return up.get();
-    }
-    return nullptr;
-}
+void FunctionAnalyzer::handleReturn(Block* bb, ReturnInst* ret) {
+    Value* retVal = ret->getReturnValue();
+    if (!retVal) return;    //void
 
-void FunctionAnalyzer::setAnalysisBound() {
-    Block* b = getLoopHeaderFromBreadcrumb();
-    if (b) {
-        IA->setCurrentIterBounds(b->getIterBounds());
+    Operand* retOp = nullptr;
+    if (auto r = InstructionAnalyzer::getConstRange(retVal)) {
+        // RETURN AS POINT
+        retOp = arena.makeOperand("RETURN", *r, VarType::Constant);
     } else {
-        IA->setCurrentIterBounds({1,1});
+        // SSA value (phi nodes included) visible from the returning block
+        retOp = bb->getScope()->lookup(retVal);
     }
-}
 
-void FunctionAnalyzer::handleBlockTerminator(Block* bb) {
-    BasicBlock* el = bb->getLLVMBasicBlock();
+    // value not tracked: nothing is known about RETURN
+    if (!retOp) retOp = arena.makeOperand("RETURN", VarType::Return);
 
-    short num_branches = 0;
-    Instruction* term = el->getTerminator();
-    if (auto* br = dyn_cast<BranchInst>(term)) {
-        
-        if (br->getNumSuccessors() == 1) {
-            // NON è l'inizio di un altro fork, accodo e termino qui
-            enqueueBlock(br->getSuccessor(0));
-            return;
-        } else {
-            for (unsigned int i = 0; i<br->getNumSuccessors(); i++) {
-                auto* succ = br->getSuccessor(i);
-
-                // il successore non esce dal loop corrente
-                if (isNotBreakLoopKeyword(el, succ)) {
-                    enqueueBlock(br->getSuccessor(i));
-                    num_branches++;
-                } else {
-                    // il successore esce dal loop corrente
-                    
-                    Block* predFork = getPredecessorForkFromBreadcrumb();
-                    predFork->setType(BlockTypology::InterLoopFork);
-                }
-            }
-        }
-    } else if (auto* sw = dyn_cast<SwitchInst>(term)) {
-        
-        for (unsigned int i = 1; i <= sw->getNumCases(); i++) {
-            enqueueBlock(br->getSuccessor(i));
-            num_branches++;
-        }
+    returnedOperands.push_back(retOp);
+}
 
-        //last op is default
-        enqueueBlock(br->getSuccessor(0));
-        num_branches++;
-    } else if (auto* ret = dyn_cast<ReturnInst>(term)) {
-        
-        // se siamo immediatamente in un fork rimuovi un branch
-        Block* fork = getPredecessorForkFromBreadcrumb();
-        if (fork) fork->decrRemainingBranches();
+void FunctionAnalyzer::buildReturnOperand() {
+    if (returnedOperands.empty()) return;
 
-        handleReturn(ret);
-        return;
+    // a merge node has at most two inputs: merge in cascade, as for phi nodes
+    Operand* acc = returnedOperands[0];
+    for (size_t i = 1; i + 1 < returnedOperands.size(); ++i) {
+        acc = arena.makeOperand("RETURN", OpCode::Merge, acc, returnedOperands[i], VarType::Return);
     }
+    Operand* last = returnedOperands.size() > 1 ? returnedOperands.back() : nullptr;
 
-    // qui arrivo solo se è l'inizio di un altro fork, quindi cambio il tipo di blocco (l'indicazione precedente del merge non serve più)
-    bb->setNumBranches(num_branches);
-    bb->setType(BlockTypology::StandardFork);
-    emplaceBreadcrumb(AggregationType::Fork, bb);
+    returnOperand = arena.makeOperand("RETURN", OpCode::Merge, acc, last, VarType::Return);
+    returnOperand->tryResolution();
+    scope->addOperand(returnOperand);
 }
 
-void FunctionAnalyzer::handleReturn(ReturnInst* ret) {
-    Value* retVal = ret->getReturnValue();
-    if (!retVal) return;    //void
-
-    Range retRange;
-    // RETURN AS POINT
-    if (auto *CI = dyn_cast<ConstantInt>(retVal)) {
-        int64_t v = CI->getSExtValue();
-        retRange = Range((float)v, (float)v);
-
-    // PHI NODE
-    } else if (auto *phi = dyn_cast<PHINode>(retVal)) {
-        retRange.min = std::numeric_limits<float>::infinity();
-        retRange.max = -std::numeric_limits<float>::infinity();
-        for (unsigned i = 0, e = phi->getNumIncomingValues(); i < e; ++i) {
-            Value* iv = phi->getIncomingValue(i);
-            if (iv->hasName()) {
-                if (Operand* ivVar = scope->lookup(iv->getName().str())) {
-                    retRange.min = std::min(retRange.min, ivVar->getRange()->min);
-                    retRange.max = std::max(retRange.max, ivVar->getRange()->max);
-                }
-            }
-        }
-
-    // SSA Return
-    } else if (retVal->hasName()) {
-        std::string name = retVal->getName().str();
-        if (Operand* v = scope->lookup(name)) {
-            retRange = *v->getRange();
-        }
-    }
-
-    scope->addOperand(std::make_unique<Operand>("RETURN", retRange, VarType::Local));
-}
\ No newline at end of file
+#undef DEBUG_TYPE
@@ -2,10 +2,14 @@
 #define FUNCTION_H
 
 #include "BlockClass.hpp"
+#include "AnalysisArena.hpp"
+#include "RangeSolver.hpp"
+#include "WTOScheduler.hpp"
+#include "FunctionSummary.hpp"
 #include "llvm/IR/Dominators.h"
+#include "llvm/ADT/DenseMap.h"
 
-#include <map>
-#include "queue"
+#include <deque>
 #include <algorithm>
 
 namespace llvm {
@@ -20,6 +24,10 @@ public:
         return el->getName().str();
     }
 
+    Function* getFunction() {
+        return el;
+    }
+
     VRAPass* getPass() {
         return vra_pass;
     } 
@@ -36,8 +44,41 @@ public:
         return *DT;
     }
 
+    AnalysisArena& getArena() {
+        return arena;
+    }
+
+    RangeSolver& getSolver() {
+        return solver;
+    }
+
     std::pair<u_int64_t, u_int64_t> getLoopIterBounds(llvm::Loop* L);
 
+    /**
+     * Query scalar evolution for the iteration bounds of every loop of the function.
+     * Must run before analyze(): SE may create IR constants, so it is not safe to query it
+     * while other functions are analyzed concurrently
+     */
+    void precomputeLoopIterBounds();
+
+    /**
+     * Query scalar evolution for the closed form range of every add recurrence (induction variable)
+     * of the loops of the function, header phi nodes excluded (see precomputeHeaderRanges). Like
+     * precomputeLoopIterBounds, it must run before analyze()
+     */
+    void precomputeInductionRanges();
+
+    /**
+     * Closed form range of v if it is an induction variable, computed by precomputeInductionRanges
+     */
+    std::optional<Range> getInductionRange(const Value* v) const;
+
+    /**
+     * Query scalar evolution for the range of the add recurrences on loop headers, which bounds the values
+     * coming back from the latches in closeLoop. Like precomputeLoopIterBounds, it must run before analyze()
+     */
+    void precomputeHeaderRanges();
+
     
 
     
@@ -45,12 +86,46 @@ public:
     void initLoop(Block* header);
 
     /**
-     * Loop latch: incrementa i loop latch visitati e analizzalo come fosse un blocco semplice.
-     * Se tutti i latches sono stati visitati ricalcola lo scope del loop header, quindi accoda i loop exit
+     * Close the loop of header: header phi nodes get the latch values as dependency, then the solver
+     * goes up to a fixpoint with widening and comes down with a bounded number of narrowing passes
+     */
+    void solveLoopFixpoint(Block* header);
+
+    /**
+     * Give the header phi nodes the values coming back from the latches as dependency (bounded by the trip
+     * count when it is known, unbounded if some latch value is unknown)
+     * @return the header operands that now close the loop, still to be solved
+     */
+    llvm::SmallVector<Operand*, 8> closeLoop(Block* header);
+
+    const FixpointConfig& getFixpointConfig() const;
+
+    /**
+     * Loop latch: analizzalo come fosse un blocco semplice.
+     * Lo scope del loop header viene ricalcolato dallo scheduler quando tutto il loop e' stato visitato
      */
     void processLoopLatch(Block* latch);
 
-    void handleLoopExit(Block* header);
+    void handleLoopExit(Block* exit);
+
+    /**
+     * Scope of block, child of the scope of its nearest dominator (the function scope for the entry block).
+     * See applyLoopGuard
+     */
+    Scope* emplaceDominatedScope(Block* block);
+
+    /**
+     * With the fixpoint, a block entered only from a loop header sees the header phi nodes compared by the
+     * header branch refined by the condition of its edge (e.g. i < 10 in the body): this is what stops
+     * the widening of a counted loop at its bound
+     */
+    void applyLoopGuard(Block* block);
+
+    /// Operand of op knowing that (op pred other) holds, nullptr if nothing can be said
+    Operand* makeGuardedOperand(Operand* op, CmpInst::Predicate pred, Value* other, Scope* from);
+
+    /// Operand of other + shift as seen from the scope from, nullptr if other is not tracked
+    Operand* makeGuardBound(Value* other, float shift, Scope* from);
 
     void initStandardFork(Block* fork);
 
@@ -72,53 +147,76 @@ public:
 
     Block* getBlockByLLVMBasicBlock(llvm::BasicBlock* bb) const;
 
-    /**
-     * Add the block aggregation already created
-     */
-    void addBreadcrumb(BlockAggregation* agg);
+    /// Blocks analyzed, in creation order
+    const std::vector<std::unique_ptr<Block>>& getBlocks() const {
+        return ownedBlocks;
+    }
 
     /**
-     * Create a new block aggregation, append it and returns its poiter
+     * Pass the iteration bounds of the loop of block (if any) to the instruction analyzer
      */
-    BlockAggregation* emplaceBreadcrumb(AggregationType type, Block* ref);
+    void setAnalysisBound(Block* block);
 
     /**
-     * Rimuove l'ultimo elemento della breadcrumb
+     * Scope of a block with several predecessors: it starts from the nearest dominator and joins the scopes of
+     * the predecessors analyzed so far, in one pass (see Scope::mergeWith)
      */
-    void popBreadcrumb();
+    Scope* emplaceJoinScope(Block* block);
 
     /**
-     * Put a basic block of the workload for future analysis
+     * Keep the binding of a call to a summarized function, referred to by the operand of its result
      */
-    void enqueueBlock(BasicBlock* B);
+    const CallBinding* addCallBinding(CallBinding binding) {
+        callBindings.push_back(std::move(binding));
+        return &callBindings.back();
+    }
 
     /**
-     * Riconosci la keyword "break" del loop (non è break se il successore rimane nello stesso loop o va in uno innestato)
+     * RETURN operand of the function, merge of every returned value (nullptr for void functions)
      */
-    bool isNotBreakLoopKeyword(BasicBlock *BB, BasicBlock *Succ);
-
-    Block* getLoopHeaderFromBreadcrumb() const;
-
-    Block* getForkFromBreadcrumb() const;
-
-    Block* getPredecessorForkFromBreadcrumb() const;
-
-    void setAnalysisBound();
-
-    /// Restituisce i range degli argomenti passati ad ogni CallInst
-    const std::map<llvm::CallInst*, std::vector<Range>>& getCallArgRanges() const {
-        return callArgRanges;
+    Operand* getReturnOperand() const {
+        return returnOperand;
     }
 
     
 
-    FunctionAnalyzer (Function* el, llvm::VRAPass* vra_pass);
+    /**
+     * @param el        function to analyze
+     * @param vra_pass  pass providing global scope, settings and callee summaries
+     * @param FAM       manager the LLVM analyses of el are taken from
+     */
+    FunctionAnalyzer (Function* el, llvm::VRAPass* vra_pass, FunctionAnalysisManager& FAM);
 
 protected:
 
     void handleBlockTerminator(Block* bb);
 
-    void handleReturn(ReturnInst* ret);
+    /**
+     * Collect the operand returned by ret, looked up from the scope of its block
+     */
+    void handleReturn(Block* bb, ReturnInst* ret);
+
+    /**
+     * Merge the returned operands into the RETURN operand of the function scope
+     */
+    void buildReturnOperand();
+
+    /**
+     * Range of an affine add recurrence from start, step and max backedge taken count, when it cannot wrap
+     * (nsw, or the last value fits the type). Otherwise the signed range of scalar evolution.
+     * With beforeExit, the value is not computed in the iteration leaving the loop (the last k is one less)
+     */
+    std::optional<Range> getAddRecRange(const SCEVAddRecExpr* AR, bool beforeExit = false);
+
+    /**
+     * Widening thresholds of the function: configured ones, constants compared inside loops and type limits
+     */
+    std::vector<float> collectWideningThresholds() const;
+
+    /**
+     * Operand of the value phi receives from latch, nullptr if unknown
+     */
+    Operand* getLatchOperand(PHINode& phi, BasicBlock* latch);
 
     std::string makeArgName() {
         return "arg_" + std::to_string(++argCounter);
@@ -137,6 +235,16 @@ private:
      */
     VRAPass* vra_pass = nullptr;
 
+    /**
+     * Owner of every operand created while analyzing the function
+     */
+    AnalysisArena arena;
+
+    /**
+     * Re-evaluates the operands depending on a range enlarged after its first resolution
+     */
+    RangeSolver solver;
+
     /**
      * Scope of the function (args and returned elements)
      */
@@ -148,14 +256,9 @@ private:
     std::vector<std::unique_ptr<Block>> ownedBlocks;
 
     /**
-     * Ordered list of macro-blocks. Useful to reconstruct the struct of them
+     * Index of ownedBlocks by llvm basic block, kept in sync by addBlock/emplaceBlock
      */
-    std::vector<BlockAggregation*> breadcrumb;
-
-    /**
-     * Queue of block to analyze
-     */
-    std::queue<BasicBlock*> workload;
+    DenseMap<const BasicBlock*, Block*> blockIndex;
 
     /**
      * Loop info of the function
@@ -182,8 +285,22 @@ private:
      */
     std::shared_ptr<InstructionAnalyzer> IA;
 
-    /// Mappa ogni CallInst ai Range dei suoi argomenti
-    std::map<llvm::CallInst*, std::vector<Range>> callArgRanges;
+    /// Iteration bounds of each loop, filled by precomputeLoopIterBounds
+    DenseMap<const llvm::Loop*, std::pair<u_int64_t, u_int64_t>> loopIterBounds;
+
+    /// Range over all iterations of each induction variable, filled by precomputeInductionRanges
+    DenseMap<const Value*, Range> inductionRanges;
+
+    /// Range proved by scalar evolution of each loop header phi, filled by precomputeHeaderRanges
+    DenseMap<const Value*, Range> headerRanges;
+
+    /// Calls to summarized functions, in visit order: the addresses stay valid for the OpCode::Call operands
+    std::deque<CallBinding> callBindings;
+
+    /// Operands returned by each ret instruction, in visit order
+    SmallVector<Operand*, 2> returnedOperands;
+
+    Operand* returnOperand = nullptr;
 
     /// @brief num of argument of this function on scope
     int argCounter = 0;
@@ -0,0 +1,153 @@
+#include "FunctionSummary.hpp"
+#include "AnalysisArena.hpp"
+
+#include "llvm/IR/Argument.h"
+
+Range FunctionSummary::apply(ArrayRef<Range> args) const {
+    if (!ret) return returnRange;
+    if (!contexts || !contexts->isEnabled()) return evaluateReturn(args);
+
+    SmallVector<Range, 4> context = contexts->quantize(args);
+    if (auto cached = contexts->lookup(this, context)) return *cached;
+
+    Range result = evaluateReturn(context);
+    contexts->insert(this, context, result);
+    return result;
+}
+
+Range FunctionSummary::evaluateReturn(ArrayRef<Range> args) const {
+    DenseMap<const Operand*, Range> memo;
+    SmallPtrSet<const Operand*, 16> inProgress;
+    return evaluate(ret, args, memo, inProgress);
+}
+
+Range FunctionSummary::evaluate(const Operand* op, ArrayRef<Range> args, DenseMap<const Operand*, Range>& memo,
+                                SmallPtrSetImpl<const Operand*>& inProgress) const {
+    auto it = memo.find(op);
+    if (it != memo.end()) return it->second;
+
+    // back edge of a loop: keep the range solved by the analysis
+    if (op->isFixed() || !inProgress.insert(op).second) return op->getRange();
+
+    Range result = op->getRange();
+
+    if (op->opcode == OpCode::Leaf) {
+        if (auto* A = dyn_cast_or_null<Argument>(op->value)) {
+            if (A->getArgNo() < args.size()) result = args[A->getArgNo()];
+        }
+
+    } else if (op->opcode == OpCode::Call) {
+        SmallVector<Range, 4> callArgs;
+        for (Operand* arg : op->call->args) {
+            callArgs.push_back(arg ? evaluate(arg, args, memo, inProgress) : Range(NEG_INF, POS_INF));
+        }
+        result = op->call->callee->apply(callArgs);
+
+    } else {
+        const Range lhs = evaluate(op->dependencies[0], args, memo, inProgress);
+        const Range rhs = op->numDeps > 1 ? evaluate(op->dependencies[1], args, memo, inProgress) : lhs;
+        result = RangeHandler::Apply(op->opcode, lhs, rhs, op->minIter, op->maxIter);
+    }
+
+    inProgress.erase(op);
+    memo[op] = result;
+    return result;
+}
+
+std::vector<SummaryNode> FunctionSummary::flatten(function_ref<std::string(const FunctionSummary*)> calleeName) const {
+    std::vector<SummaryNode> nodes;
+    if (!ret) return nodes;
+
+    // positions are given on discovery, the nodes are filled when taken from the worklist (loops make cycles)
+    DenseMap<const Operand*, int32_t> position;
+    SmallVector<const Operand*, 16> worklist;
+    auto number = [&](const Operand* op) -> int32_t {
+        if (!op) return -1;
+        auto [it, inserted] = position.try_emplace(op, nodes.size());
+        if (inserted) {
+            nodes.emplace_back();
+            worklist.push_back(op);
+        }
+        return it->second;
+    };
+    number(ret);
+
+    while (!worklist.empty()) {
+        const Operand* op = worklist.pop_back_val();
+
+        SummaryNode node;
+        node.range = op->range;
+        node.minIter = op->minIter;
+        node.maxIter = op->maxIter;
+
+        // what evaluate() does not look through is a leaf keeping its range
+        if (op->opcode == OpCode::Leaf || op->isFixed()) {
+            if (auto* A = dyn_cast_or_null<Argument>(op->value); A && op->opcode == OpCode::Leaf && !op->isFixed()) {
+                node.argNo = A->getArgNo();
+            }
+        } else if (op->opcode == OpCode::Call) {
+            node.opcode = OpCode::Call;
+            node.callee = calleeName(op->call->callee);
+            for (Operand* arg : op->call->args) node.callArgs.push_back(number(arg));
+        } else {
+            node.opcode = op->opcode;
+            node.numDeps = op->numDeps;
+            for (unsigned i = 0; i < op->numDeps; ++i) node.deps[i] = number(op->dependencies[i]);
+        }
+
+        nodes[position.lookup(op)] = std::move(node);
+    }
+
+    return nodes;
+}
+
+std::unique_ptr<FunctionSummary> FunctionSummary::rebuild(const Function& F, ArrayRef<SummaryNode> nodes,
+    function_ref<const FunctionSummary*(StringRef)> findCallee, AnalysisArena& arena,
+    std::deque<CallBinding>& bindings, SummaryContextCache* contexts) {
+
+    if (nodes.empty()) return std::make_unique<FunctionSummary>(nullptr, contexts);
+
+    // every operand first, then the edges: dependencies can come later (cycles)
+    std::vector<Operand*> ops;
+    ops.reserve(nodes.size());
+    for (const SummaryNode& node : nodes) {
+        const Value* value = node.argNo >= 0 && unsigned(node.argNo) < F.arg_size() ? F.getArg(node.argNo) : nullptr;
+        ops.push_back(node.range
+            ? arena.makeOperand("summary", *node.range, VarType::Local, value)
+            : arena.makeOperand("summary", VarType::Local, value));
+    }
+
+    auto at = [&ops](int32_t i) -> Operand* {
+        return i >= 0 && size_t(i) < ops.size() ? ops[i] : nullptr;
+    };
+
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        const SummaryNode& node = nodes[i];
+        Operand* op = ops[i];
+        op->minIter = node.minIter;
+        op->maxIter = node.maxIter;
+
+        if (node.opcode == OpCode::Call) {
+            const FunctionSummary* callee = findCallee(node.callee);
+            if (!callee) continue;
+
+            CallBinding binding;
+            binding.callee = callee;
+            for (int32_t arg : node.callArgs) binding.args.push_back(at(arg));
+            bindings.push_back(std::move(binding));
+            op->call = &bindings.back();
+            op->opcode = OpCode::Call;
+
+        } else if (node.opcode != OpCode::Leaf && node.numDeps >= 1 && node.numDeps <= 2) {
+            bool valid = true;
+            for (unsigned d = 0; d < node.numDeps; ++d) valid &= at(node.deps[d]) != nullptr;
+            if (!valid) continue;
+
+            op->opcode = node.opcode;
+            op->numDeps = node.numDeps;
+            for (unsigned d = 0; d < node.numDeps; ++d) op->dependencies[d] = at(node.deps[d]);
+        }
+    }
+
+    return std::make_unique<FunctionSummary>(ops[0], contexts);
+}
@@ -0,0 +1,122 @@
+#ifndef FUNCTION_SUMMARY_H
+#define FUNCTION_SUMMARY_H
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/STLFunctionalExtras.h"
+#include "llvm/IR/Function.h"
+
+#include <deque>
+#include <memory>
+
+#include "ScopeHandler.hpp"
+#include "SummaryContextCache.hpp"
+
+using namespace llvm;
+
+class FunctionSummary;
+class AnalysisArena;
+
+/**
+ * Call site of a summarized function: the callee summary and the caller operands passed as arguments
+ */
+struct CallBinding {
+    const FunctionSummary* callee = nullptr;
+
+    /// @brief operand of each actual argument, nullptr if unknown
+    SmallVector<Operand*, 4> args;
+};
+
+/**
+ * Operand of the graph of a summary, flattened to be stored in the result cache (see FunctionSummary::flatten)
+ */
+struct SummaryNode {
+    /// @brief Leaf for inputs and for operands evaluated as their solved range (fixed, loop carried)
+    OpCode opcode = OpCode::Leaf;
+
+    std::optional<Range> range;
+
+    /// @brief argument bound by apply() to a leaf, -1 for other operands
+    int32_t argNo = -1;
+
+    uint8_t numDeps = 0;
+
+    /// @brief positions of the dependencies in the flattened graph
+    std::array<int32_t, 2> deps = {-1, -1};
+
+    int32_t minIter = 1;
+    int32_t maxIter = 1;
+
+    /// @brief function called by an OpCode::Call node
+    std::string callee;
+
+    /// @brief positions of the actual arguments of an OpCode::Call node, -1 if unknown
+    std::vector<int32_t> callArgs;
+};
+
+/**
+ * Summary of a function: RETURN range as a function of the argument ranges.
+ *
+ * The summary is the operand graph of the function itself: applying it evaluates again the cone of RETURN
+ * with the argument leaves bound to the given ranges, and the calls it contains applied to their own callees.
+ * Loop carried operands keep the range solved with unknown arguments, which is wider than any binding.
+ */
+class FunctionSummary {
+
+public:
+
+    /**
+     * @param ret       RETURN operand of the function, nullptr for void functions
+     * @param contexts  memo of the applications shared by all the summaries, nullptr to always evaluate
+     */
+    explicit FunctionSummary(Operand* ret, SummaryContextCache* contexts = nullptr) :
+        ret(ret), returnRange(ret ? ret->getRange() : Range(NEG_INF, POS_INF)), contexts(contexts) {}
+
+    /**
+     * RETURN range when the i-th argument is in args[i] (arguments without a range are unknown).
+     * With a context cache, args are first widened to its quantization grid
+     */
+    Range apply(ArrayRef<Range> args) const;
+
+    /**
+     * RETURN range with unknown arguments
+     */
+    Range getReturnRange() const {
+        return returnRange;
+    }
+
+    /**
+     * Cone of RETURN as nodes referring to each other by position, RETURN first (empty for void functions).
+     * Calls refer to their callee by the name given by calleeName
+     */
+    std::vector<SummaryNode> flatten(function_ref<std::string(const FunctionSummary*)> calleeName) const;
+
+    /**
+     * Summary of F applying the same graph as the one flattened. The operands are allocated in arena and the
+     * call bindings appended to bindings: both must outlive the summary. A call whose callee is not found by
+     * findCallee keeps the range it had when it was flattened
+     */
+    static std::unique_ptr<FunctionSummary> rebuild(const Function& F, ArrayRef<SummaryNode> nodes,
+        function_ref<const FunctionSummary*(StringRef)> findCallee, AnalysisArena& arena,
+        std::deque<CallBinding>& bindings, SummaryContextCache* contexts);
+
+private:
+
+    /**
+     * Evaluate the cone of RETURN with args bound to the arguments
+     */
+    Range evaluateReturn(ArrayRef<Range> args) const;
+
+    Range evaluate(const Operand* op, ArrayRef<Range> args, DenseMap<const Operand*, Range>& memo,
+                   SmallPtrSetImpl<const Operand*>& inProgress) const;
+
+    Operand* ret = nullptr;
+
+    Range returnRange;
+
+    SummaryContextCache* contexts = nullptr;
+};
+
+#endif
@@ -1,13 +1,16 @@
 #include "InstructionAnalyzer.hpp"
-#include "BlockClass.hpp"
 
-static int ConstNameCounter = 0;
+#include "llvm/ADT/Statistic.h"
 
-static std::string makeConstName() {
-    return "const" + std::to_string(++ConstNameCounter);
-}
+#include "BlockClass.hpp"
+#include "AnalysisArena.hpp"
+#include "FunctionAnalyzer.hpp"
+#include "VRAPass.h"
 
+#define DEBUG_TYPE "vra"
 
+STATISTIC(NumConstantsShared, "Constant uses sharing an interned operand");
+STATISTIC(NumExpressionsShared, "Instructions sharing the operand of an identical expression");
 
 void InstructionAnalyzer::loadBlock(Block* b) {
     curBlock = b;
@@ -30,6 +33,11 @@ void InstructionAnalyzer::analyzeExpressionNodes(Instruction* I) {
         kind = InstructionType::Boolean;
         handleCmp();
     }
+
+    else if (isa<CallInst>(curInstruction)) {
+        kind = InstructionType::Call;
+        handleCall();
+    }
 }
 
 void InstructionAnalyzer::analyzePHINodes(Instruction* I) {
@@ -39,51 +47,48 @@ void InstructionAnalyzer::analyzePHINodes(Instruction* I) {
     if (phi == nullptr) return;
     
     kind = InstructionType::PHI;
-    std::string varName = I->getName().str();
-    Scope* phiScope = curBlock->getScope();
 
-    std::vector<Operand*> dependencies;
+    SmallVector<Operand*, 4> dependencies;
 
     for (unsigned i = 0; i < phi->getNumIncomingValues(); ++i) {
         
         Value* incoming = phi->getIncomingValue(i);
        
 
-        if (auto op = getConstRange(incoming)) {
-
-            std::string name = makeConstName();
-            dependencies.push_back(new Operand(name, *op, VarType::Constant));
-
-        } else if (Operand* existing = phiScope->lookup(incoming->getName().str())) {
+        if (Operand* constOp = getConstOperand(incoming)) {
+            dependencies.push_back(constOp);
+        } else if (Operand* existing = lookupIncoming(phi, i)) {
             existing->tryResolution();
             dependencies.push_back(existing);
         } else {
             //TODO: gestione situazione
-            errs() << "analyzePhiNodeBranch sconosciuto\n";
+            LLVM_DEBUG(dbgs() << DEBUG_HEAD << " analyzePhiNodeBranch sconosciuto: " << *phi << "\n");
             return;
         }
 
     }
 
-    std::function<Range(const std::vector<Range>&)> callFn = [](const std::vector<Range>& args) {
-        if (args.empty()) {
-            // nessun argomento: potresti restituire un range “infinito” o uno default
-            return Range(NEG_INF, POS_INF);
-        }
-        // inizio dal primo
-        Range acc = args[0];
-        // mergio a cascata tutti gli altri
-        for (size_t i = 1; i < args.size(); ++i) {
-            acc = RangeHandler::Merge(acc, args[i]);
-        }
-        return acc;
-    };
+    if (dependencies.empty()) return;
+
+    // mergio a cascata tutti gli incoming: every merge node has at most two inputs
+    Operand* acc = dependencies[0];
+    for (size_t i = 1; i + 1 < dependencies.size(); ++i) {
+        acc = arena->makeOperand(acc->name, OpCode::Merge, acc, dependencies[i], VarType::Local);
+    }
+    Operand* last = dependencies.size() > 1 ? dependencies.back() : nullptr;
 
     // Now it's time to create the result operand and add it to the scope of the block
-    auto resultOperand = std::make_unique<Operand>(curInstruction->getName().str(), dependencies, callFn, VarType::Local);
+    Operand* resultOperand = arena->makeOperand(curInstruction->getName().str(), OpCode::Merge, acc, last, VarType::Local, curInstruction);
     resultOperand->tryResolution();
 
-    curBlock->getScope()->addOperand(std::move(resultOperand));
+    curBlock->getScope()->addOperand(resultOperand);
+}
+
+Operand* InstructionAnalyzer::lookupIncoming(PHINode* phi, unsigned i) {
+    // the incoming value is defined on the edge: look it up from the predecessor, which may not dominate this block
+    Block* pred = curBlock->getOwner()->getBlockByLLVMBasicBlock(phi->getIncomingBlock(i));
+    Scope* scope = pred && pred->getScope() ? pred->getScope() : curBlock->getScope();
+    return scope->lookup(phi->getIncomingValue(i));
 }
 
 void InstructionAnalyzer::analyzePHINodesLoopHeader(Instruction* I) {
@@ -95,25 +100,27 @@ void InstructionAnalyzer::analyzePHINodesLoopHeader(Instruction* I) {
     
     kind = InstructionType::PHI;
     std::string name = "HEAD_" + I->getName().str();
+
     Value* incoming = phi->getIncomingValue(0);
     Scope* phiScope = curBlock->getScope();
 
-    std::unique_ptr<Operand> resultOp;
-
-    if (auto op = getConstRange(incoming)) {
+    Operand* resultOp = nullptr;
 
-        resultOp = std::make_unique<Operand>(name, *op, VarType::Constant);
-
-    } else if (Operand* existing = phiScope->lookup(incoming->getName().str())) {
-        resultOp = existing->clone();
+    // the values coming from the latches are merged in later by Block::rescaleLoopHeaderScope
+    if (Operand* entryOp = getConstOperand(incoming)) {
+        resultOp = arena->makeOperand(name, OpCode::Merge, entryOp, nullptr, VarType::Local);
+    } else if (Operand* existing = phiScope->lookup(incoming)) {
+        resultOp = arena->makeOperand(name, OpCode::Merge, existing, nullptr, VarType::Local);
     } else {
         //TODO: gestione situazione
-        errs() << "analyzePhiNodeBranch sconosciuto\n";
+        LLVM_DEBUG(dbgs() << DEBUG_HEAD << " analyzePhiNodeBranch sconosciuto: " << *phi << "\n");
         return;
     }
 
+    // on the header the phi takes the value incoming from the loop entry
+    resultOp->value = phi;
     resultOp->tryResolution();
-    curBlock->getScope()->addOperand(std::move(resultOp));
+    curBlock->getScope()->addOperand(resultOp);
 }
 
 void InstructionAnalyzer::handleBinaryOp() {
@@ -121,68 +128,95 @@ void InstructionAnalyzer::handleBinaryOp() {
     Value* op1 = curInstruction->getOperand(0);
     Value* op2 = curInstruction->getOperand(1);
 
-    std::vector<Operand*> dependencies;
-
-    if (auto opt1ConstRange = getConstRange(op1)) {
-        
-        std::string name1 = makeConstName();
-        dependencies.push_back(new Operand(name1, *opt1ConstRange, VarType::Constant));
+    SmallVector<Operand*, 2> dependencies;
 
-    } else if (op1->hasName()) {
+    if (Operand* const1 = getConstOperand(op1)) {
+        dependencies.push_back(const1);
+    } else if (auto* left_op = curBlock->getScope()->lookup(op1)) {
         // è una variabile
-        auto* left_op = curBlock->getScope()->lookup(op1->getName().str());
         left_op->tryResolution();
         dependencies.push_back(left_op);
     }
 
-    if (auto opt2ConstRange = getConstRange(op2)) {
-        std::string name2 = makeConstName();
-        dependencies.push_back(new Operand(name2, *opt2ConstRange, VarType::Constant));
-    } else if (op2->hasName()) {
-        auto* right_op = curBlock->getScope()->lookup(op2->getName().str());
+    if (Operand* const2 = getConstOperand(op2)) {
+        dependencies.push_back(const2);
+    } else if (auto* right_op = curBlock->getScope()->lookup(op2)) {
         right_op->tryResolution();
         dependencies.push_back(right_op);
     }
 
+    // an operand is not tracked yet, nothing to compute
+    if (dependencies.size() != 2) return;
+
 
-    std::function<Range(const std::vector<Range>&)> callFn;
+    OpCode opcode;
     switch (curInstruction->getOpcode()) {
-        case Instruction::Add: {
-            callFn = [this](const std::vector<Range>& args) {
-                    return RA.get()->Add(args[0], args[1], curMinIter, curMaxIter);
-                };
+        case Instruction::Add:
+            opcode = OpCode::Add;
             break;
-        }
-        case Instruction::Sub: {
-            callFn = [this](const std::vector<Range>& args) {
-                    return RA.get()->Sub(args[0], args[1], curMinIter, curMaxIter);
-                };
+        case Instruction::Sub:
+            opcode = OpCode::Sub;
             break;
-        }
-        case Instruction::Mul: {
-            callFn = [this](const std::vector<Range>& args) {
-                    return RA.get()->MulOnLoop(args[0], args[1], curMinIter, curMaxIter);
-                };
+        case Instruction::Mul:
+            opcode = OpCode::Mul;
             break;
-        }
-        case Instruction::SDiv: {
-            // callFn = [this](const std::vector<Range>& args) {
-            //         return RA.get()->Div(args[0], args[1], curMinIter, curMaxIter);
-            //     };
-
+        case Instruction::SDiv:
+            // opcode = OpCode::Div;
+            opcode = OpCode::Leaf;
             break;
-        }
         default:
-            callFn = nullptr;
             //TODO: op not handled yet
             return;
     }
 
+    std::string name = curInstruction->getName().str();
+    if (opcode == OpCode::Leaf) {
+        curBlock->getScope()->addOperand(arena->makeOperand(name, VarType::Local, curInstruction));
+        return;
+    }
+
+    if (handleInductionVariable(name, opcode, dependencies[0], dependencies[1])) return;
+
+    // the range only depends on the key: the same expression anywhere in the function has the same operand.
+    // The operands are not commutative, iterations scale the second one
+    ExpressionKey key(static_cast<unsigned>(opcode), dependencies[0], dependencies[1], curMinIter, curMaxIter);
+    auto [it, inserted] = expressions.try_emplace(key, nullptr);
+    if (!inserted) {
+        ++NumExpressionsShared;
+        curBlock->getScope()->addAlias(curInstruction, it->second);
+        return;
+    }
+
     // Now it's time to create the result operand and add it to the scope of the block
-    auto resultOperand = std::make_unique<Operand>(curInstruction->getName().str(), dependencies, callFn, VarType::Local);
+    Operand* resultOperand = arena->makeOperand(name, opcode, dependencies[0], dependencies[1], VarType::Local, curInstruction, curMinIter, curMaxIter);
     resultOperand->tryResolution();
+    it->second = resultOperand;
+
+    curBlock->getScope()->addOperand(resultOperand);
+}
+
+bool InstructionAnalyzer::handleInductionVariable(const std::string& name, OpCode opcode, Operand* lhs, Operand* rhs) {
+    std::optional<Range> r = curBlock->getOwner()->getInductionRange(curInstruction);
+    if (!r) return false;
 
-    curBlock->getScope()->addOperand(std::move(resultOperand));
+    // an operand is unknown (e.g. an argument): the closed form alone bounds the value
+    if (!lhs->tryResolution() || !rhs->tryResolution()) {
+        curBlock->getScope()->addOperand(arena->makeOperand(name, Range(r->min, r->max), VarType::Local, curInstruction));
+        return true;
+    }
+
+    // the header carries the iterations, the operation is the one of a single iteration; the closed form
+    // bounds it, as the trip count bounds the header (see FunctionAnalyzer::closeLoop)
+    Operand* step = arena->makeOperand(name, opcode, lhs, rhs, VarType::Local);
+    Operand* bound = arena->makeOperand("closed_form", *r, VarType::Constant);
+    Operand* below = arena->makeOperand(name, OpCode::Below, step, bound, VarType::Local);
+    Operand* resultOp = arena->makeOperand(name, OpCode::Above, below, bound, VarType::Local, curInstruction);
+
+    step->tryResolution();
+    below->tryResolution();
+    resultOp->tryResolution();
+    curBlock->getScope()->addOperand(resultOp);
+    return true;
 }
 
 void InstructionAnalyzer::handleUnaryOp() {
@@ -191,19 +225,79 @@ void InstructionAnalyzer::handleUnaryOp() {
 
 void InstructionAnalyzer::handleCmp() {
     std::string resName = curInstruction->getName().str();
-    curBlock->getScope()->addOperand(std::make_unique<Operand>(resName, Range(0.0f, 1.0f), VarType::Constant));
+    curBlock->getScope()->addOperand(arena->makeOperand(resName, Range(0.0f, 1.0f), VarType::Constant, curInstruction));
 }
 
 
+void InstructionAnalyzer::handleCall() {
+    auto* call = cast<CallInst>(curInstruction);
+    FunctionAnalyzer* owner = curBlock->getOwner();
+
+    CallBinding binding;
+
+    for (Value* arg : call->args()) {
+        Operand* argOp = nullptr;
+
+        if ((argOp = getConstOperand(arg))) {
+            // interned constant, nothing to resolve
+        } else if ((argOp = curBlock->getScope()->lookup(arg))) {
+            argOp->tryResolution();
+        }
+
+        binding.args.push_back(argOp);
+    }
+
+    if (call->getType()->isVoidTy()) return;
+
+    std::string name = call->getName().str();
+    const Function* callee = call->getCalledFunction();
+    const FunctionSummary* summary = callee ? owner->getPass()->getSummary(callee) : nullptr;
+
+    if (!summary) {
+        curBlock->getScope()->addOperand(arena->makeOperand(name, VarType::Local, call));
+        return;
+    }
+
+    // the arguments can still be enlarged (e.g. by a loop header): the result is evaluated again with them
+    binding.callee = summary;
+    Operand* resultOperand = arena->makeOperand(name, owner->addCallBinding(std::move(binding)), VarType::Local, call);
+    resultOperand->tryResolution();
+
+    curBlock->getScope()->addOperand(resultOperand);
+}
+
 std::optional<Range> InstructionAnalyzer::getConstRange(Value* val) {
 
     if (auto* k_val = dyn_cast<ConstantInt>(val)) {
         float v = static_cast<float>(k_val->getSExtValue());
         return Range(v, v);
     } else if (auto* k_val = dyn_cast<ConstantFP>(val)) {
-        float v = static_cast<float>(k_val->getValueAPF().convertToFloat());
+        // any format (half, double, x86_fp80...) through double: convertToFloat only takes single precision
+        APFloat value = k_val->getValueAPF();
+        bool losesInfo;
+        value.convert(APFloat::IEEEdouble(), APFloat::rmNearestTiesToEven, &losesInfo);
+        float v = static_cast<float>(value.convertToDouble());
         return Range(v, v);
     }
 
     return std::nullopt;
 }
+
+Operand* InstructionAnalyzer::getConstOperand(Value* val) {
+    auto* k = dyn_cast<Constant>(val);
+    if (!k) return nullptr;
+
+    auto [it, inserted] = seenConstants.try_emplace(k, nullptr);
+    if (!inserted) {
+        if (it->second) ++NumConstantsShared;
+        return it->second;
+    }
+
+    // constants are leaves never enlarged by the solver, so any number of users can share them
+    if (auto r = getConstRange(val)) {
+        it->second = arena->makeOperand(makeConstName(), *r, VarType::Constant);
+    }
+    return it->second;
+}
+
+#undef DEBUG_TYPE
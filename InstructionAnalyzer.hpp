@@ -1,8 +1,13 @@
 #ifndef VRA_INSTRUCTION_ANALYZER_H
 #define VRA_INSTRUCTION_ANALYZER_H
 
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/IR/Constant.h"
 #include "llvm/IR/Instruction.h"
 
+#include <optional>
+#include <tuple>
+
 #include "Utils.hpp"
 #include "RangeHandler.hpp"
 
@@ -13,6 +18,8 @@ enum InstructionType {
 };
 
 class Block;
+class AnalysisArena;
+struct Operand;
 
 class InstructionAnalyzer {
 
@@ -59,11 +66,41 @@ class InstructionAnalyzer {
         
         void handleCmp();
 
-        InstructionAnalyzer(std::shared_ptr<RangeHandler> RA): RA(RA) {}
+        /**
+         * Call: record the argument ranges and, if the callee has a summary, apply it to get the result range
+         */
+        void handleCall();
+
+        /**
+         * If the current instruction is an induction variable with a closed form range, add to the scope
+         * the operation on lhs and rhs done once (no iteration based approximation), bounded by the closed form
+         * @return true if the instruction has been handled
+         */
+        bool handleInductionVariable(const std::string& name, OpCode opcode, Operand* lhs, Operand* rhs);
+
+        InstructionAnalyzer(std::shared_ptr<RangeHandler> RA, AnalysisArena* arena): RA(RA), arena(arena) {}
+
+        /**
+         * Range of val if it is an integer or floating point constant
+         */
+        static std::optional<Range> getConstRange(Value* val);
+
+        /**
+         * Operand of val if it is an integer or floating point constant, nullptr otherwise.
+         * Constants are interned: every use of the same constant in the function shares one operand
+         */
+        Operand* getConstOperand(Value* val);
 
 protected:
 
-    std::optional<Range> getConstRange(Value* val);
+    /**
+     * Operand of the i-th incoming value of phi, searched from the scope of the incoming block
+     */
+    Operand* lookupIncoming(PHINode* phi, unsigned i);
+
+    std::string makeConstName() {
+        return "const" + std::to_string(++constCounter);
+    }
 
 
     private:
@@ -83,15 +120,33 @@ protected:
      */
     std::shared_ptr<RangeHandler> RA;
 
+    /**
+     * Arena of the function, owner of every created operand
+     */
+    AnalysisArena* arena;
+
     /**
      * Kind of last analyzed instruction
      */
     InstructionType kind;
 
     /**
-     * Pool of already seen constants
+     * Pool of the constants of the function. LLVM constants are uniqued by value and type,
+     * so the pointer is the key
+     */
+    DenseMap<const Constant*, Operand*> seenConstants;
+
+    /// @brief opcode, dependencies and iteration bounds of an arithmetic operand
+    using ExpressionKey = std::tuple<unsigned, const Operand*, const Operand*, int, int>;
+
+    /**
+     * Arithmetic operands of the function by expression (hash-consing): an instruction computing the same
+     * expression as a previous one is bound to its operand, which is resolved only once
      */
-    std::set<float> seenConstants;  
+    DenseMap<ExpressionKey, Operand*> expressions;
+
+    /// @brief num of constants created by this analyzer, used to name them
+    int constCounter = 0;
 
     /**
      * How many iterations has this instruction (> 1 is inside loop)
@@ -0,0 +1,236 @@
+#include "LazyRangeQuery.hpp"
+
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/Operator.h"
+
+#include "InstructionAnalyzer.hpp"
+#include "VRAPass.h"
+
+Range LazyRangeQuery::getRange(Value* V) {
+    if (auto r = InstructionAnalyzer::getConstRange(V)) return *r;
+
+    auto it = ranges.find(V);
+    if (it != ranges.end()) return it->second;
+
+    auto* I = dyn_cast<Instruction>(V);
+    if (!I) return scevRange(V);     // arguments and other constants
+
+    // reached again while computing it: loop carried value
+    if (inProgress.count(I)) return cycleRange(I);
+
+    // requested by another value: computed by solve() before that one is computed again
+    if (solving) {
+        missing.push_back(I);
+        return Range(NEG_INF, POS_INF);
+    }
+
+    solve(I);
+    return ranges.find(I)->second;
+}
+
+void LazyRangeQuery::solve(Instruction* root) {
+    solving = true;
+    SmallVector<Instruction*, 32> stack = {root};
+
+    while (!stack.empty()) {
+        Instruction* I = stack.back();
+        if (ranges.count(I)) {
+            stack.pop_back();       // requested more than once before being computed
+            continue;
+        }
+
+        inProgress.insert(I);
+        missing.clear();
+        Range r = compute(I);
+
+        if (!missing.empty()) {
+            // I stays in progress below its operands, the first requested is computed first
+            stack.append(missing.rbegin(), missing.rend());
+            continue;
+        }
+
+        // scalar evolution knows about wrapping and trip counts, keep the tighter bounds
+        Range known = scevRange(I);
+        if (known.min <= r.max && r.min <= known.max) {
+            r.min = std::max(r.min, known.min);
+            r.max = std::min(r.max, known.max);
+        }
+
+        inProgress.erase(I);
+        ranges[I] = r;
+        stack.pop_back();
+    }
+
+    solving = false;
+}
+
+Range LazyRangeQuery::getRangeAt(Value* V, BasicBlock* BB) {
+    return getRangeAt(V, BB, MaxConditionDepth);
+}
+
+Range LazyRangeQuery::getRangeAt(Value* V, BasicBlock* BB, unsigned budget) {
+    size_t numMissing = missing.size();
+    bool fullBudget = budget == MaxConditionDepth;
+    Range r = getRange(V);
+    if (!isa<Instruction>(V) && !isa<Argument>(V)) return r;
+
+    auto key = std::make_pair(static_cast<const Value*>(V), static_cast<const BasicBlock*>(BB));
+    auto it = refined.find(key);
+    if (it != refined.end()) return it->second;
+
+    bool isInteger = V->getType()->isIntegerTy();
+    DomTreeNode* N = DT.getNode(BB);
+
+    for (; N && N->getIDom() && budget; N = N->getIDom(), --budget) {
+        BasicBlock* D = N->getIDom()->getBlock();
+
+        auto* br = dyn_cast<BranchInst>(D->getTerminator());
+        if (!br || !br->isConditional()) continue;
+
+        auto* cmp = dyn_cast<CmpInst>(br->getCondition());
+        if (!cmp || (cmp->getOperand(0) != V && cmp->getOperand(1) != V)) continue;
+
+        bool lhs = cmp->getOperand(0) == V;
+        Value* other = cmp->getOperand(lhs ? 1 : 0);
+
+        for (unsigned s = 0; s < 2; ++s) {
+            // the condition holds in BB only if every path to BB takes this edge
+            if (!DT.dominates(BasicBlockEdge(D, br->getSuccessor(s)), BB)) continue;
+
+            CmpInst::Predicate pred = s == 0 ? cmp->getPredicate() : cmp->getInversePredicate();
+            if (!lhs) pred = CmpInst::getSwappedPredicate(pred);
+
+            r = constrain(r, pred, getRangeAt(other, D, budget - 1), isInteger);
+        }
+    }
+
+    // a value being computed, seen with operands not computed yet or through a reduced budget is not final yet
+    if (!inProgress.count(V) && missing.size() == numMissing && fullBudget) refined[key] = r;
+    return r;
+}
+
+Range LazyRangeQuery::compute(Instruction* I) {
+    BasicBlock* BB = I->getParent();
+    auto operand = [&](unsigned i) { return getRangeAt(I->getOperand(i), BB); };
+
+    switch (I->getOpcode()) {
+        case Instruction::Add:
+        case Instruction::FAdd:
+            return RangeHandler::Add(operand(0), operand(1), 1, 1);
+
+        case Instruction::Sub:
+        case Instruction::FSub:
+            return RangeHandler::Sub(operand(0), operand(1), 1, 1);
+
+        case Instruction::Mul:
+        case Instruction::FMul:
+            return RangeHandler::Mul(operand(0), operand(1));
+
+        case Instruction::SDiv:
+        case Instruction::FDiv: {
+            Range divisor = operand(1);
+            if (divisor.min <= 0 && divisor.max >= 0) break;
+            return RangeHandler::Div(operand(0), divisor);
+        }
+
+        case Instruction::SExt:
+        case Instruction::SIToFP:
+        case Instruction::FPExt:
+        case Instruction::FPTrunc:
+            return operand(0);
+
+        case Instruction::ICmp:
+        case Instruction::FCmp:
+            return Range(0.0f, 1.0f);
+
+        case Instruction::Select:
+            return RangeHandler::Merge(operand(1), operand(2));
+
+        case Instruction::PHI: {
+            auto* phi = cast<PHINode>(I);
+            Range r;
+            for (unsigned i = 0; i < phi->getNumIncomingValues(); ++i) {
+                // the incoming value is seen from the edge it comes from
+                Range in = getRangeAt(phi->getIncomingValue(i), phi->getIncomingBlock(i));
+                r = i == 0 ? in : RangeHandler::Merge(r, in);
+            }
+            if (phi->getNumIncomingValues() > 0) return r;
+            break;
+        }
+
+        case Instruction::Load: {
+            // only constant globals keep their initial value
+            auto* gv = dyn_cast<GlobalVariable>(cast<LoadInst>(I)->getPointerOperand());
+            if (gv && gv->isConstant() && context) {
+                if (Operand* op = context->getGlobalScope()->lookup(gv)) return op->getRange();
+            }
+            break;
+        }
+
+        case Instruction::Call: {
+            auto* call = cast<CallInst>(I);
+            const Function* callee = call->getCalledFunction();
+            const FunctionSummary* summary = callee && context ? context->getSummary(callee) : nullptr;
+            if (!summary) break;
+
+            SmallVector<Range, 4> args;
+            for (Value* arg : call->args()) args.push_back(getRangeAt(arg, BB));
+            return summary->apply(args);
+        }
+
+        default:
+            break;
+    }
+
+    return Range(NEG_INF, POS_INF);
+}
+
+Range LazyRangeQuery::constrain(Range r, CmpInst::Predicate pred, const Range& o, bool isInteger) {
+    // strict comparisons exclude the bound, which for integers means one unit
+    float step = isInteger ? 1.0f : 0.0f;
+
+    // unsigned comparisons are signed ones when both sides are not negative
+    if (CmpInst::isUnsigned(pred)) {
+        if (r.min < 0 || o.min < 0) return r;
+        pred = CmpInst::getSignedPredicate(pred);
+    }
+
+    Range result = r;
+    switch (pred) {
+        case CmpInst::ICMP_SLT: case CmpInst::FCMP_OLT: case CmpInst::FCMP_ULT:
+            result.max = std::min(r.max, o.max - step);
+            break;
+        case CmpInst::ICMP_SLE: case CmpInst::FCMP_OLE: case CmpInst::FCMP_ULE:
+            result.max = std::min(r.max, o.max);
+            break;
+        case CmpInst::ICMP_SGT: case CmpInst::FCMP_OGT: case CmpInst::FCMP_UGT:
+            result.min = std::max(r.min, o.min + step);
+            break;
+        case CmpInst::ICMP_SGE: case CmpInst::FCMP_OGE: case CmpInst::FCMP_UGE:
+            result.min = std::max(r.min, o.min);
+            break;
+        case CmpInst::ICMP_EQ: case CmpInst::FCMP_OEQ: case CmpInst::FCMP_UEQ:
+            result.min = std::max(r.min, o.min);
+            result.max = std::min(r.max, o.max);
+            break;
+        default:
+            break;
+    }
+
+    // contradiction: the block is dead for these ranges, keep the unrefined one
+    return result.min <= result.max ? result : r;
+}
+
+Range LazyRangeQuery::cycleRange(Value* V) {
+    return scevRange(V);
+}
+
+Range LazyRangeQuery::scevRange(Value* V) {
+    if (!V->getType()->isIntegerTy() || !SE.isSCEVable(V->getType())) return Range(NEG_INF, POS_INF);
+
+    ConstantRange CR = SE.getSignedRange(SE.getSCEV(V));
+    if (CR.isFullSet() || CR.isEmptySet()) return Range(NEG_INF, POS_INF);
+
+    return Range(static_cast<float>(CR.getSignedMin().signedRoundToDouble()),
+                 static_cast<float>(CR.getSignedMax().signedRoundToDouble()));
+}
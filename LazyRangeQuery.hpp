@@ -0,0 +1,118 @@
+#ifndef LAZY_RANGE_QUERY_H
+#define LAZY_RANGE_QUERY_H
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/IR/Dominators.h"
+#include "llvm/IR/InstrTypes.h"
+
+#include "RangeHandler.hpp"
+
+using namespace llvm;
+
+namespace llvm {
+    class VRAPass;
+}
+
+/**
+ * Demand driven ranges: the range of a value is computed from the backward slice of its def-use chain only,
+ * refined by the branch conditions dominating each use. Every intermediate range is memoized, so following
+ * queries on the same function only pay for the part of the slice not seen yet.
+ *
+ * Values are not scaled by loop iterations as in FunctionAnalyzer: a cycle in the slice (loop carried value)
+ * takes the range scalar evolution proves for it, or the unbounded one.
+ *
+ * The slice is walked with an explicit stack, so the depth of a def-use chain does not bound the query.
+ */
+class LazyRangeQuery {
+
+public:
+
+    /**
+     * @param F        function of the queried values
+     * @param context  pass providing global ranges and callee summaries (after initialize or analyzeModule)
+     */
+    LazyRangeQuery(Function& F, llvm::VRAPass* context, DominatorTree& DT, ScalarEvolution& SE) :
+        F(F), context(context), DT(DT), SE(SE) {}
+
+    /**
+     * Range of V over all its executions
+     */
+    Range getRange(Value* V);
+
+    /**
+     * Range of V when control is in BB: the branch conditions dominating BB are applied
+     */
+    Range getRangeAt(Value* V, BasicBlock* BB);
+
+    /**
+     * Number of values whose range has been computed so far
+     */
+    unsigned getNumMemoized() const {
+        return ranges.size();
+    }
+
+private:
+
+    /**
+     * getRangeAt visiting at most budget dominators, including the ones of the nested queries on the values
+     * compared with V
+     */
+    Range getRangeAt(Value* V, BasicBlock* BB, unsigned budget);
+
+    /**
+     * Compute root and the part of its slice not memoized yet, deepest values first
+     */
+    void solve(Instruction* root);
+
+    /**
+     * Range of the instruction from its operands, each seen from the block of I.
+     * Operands not computed yet are unbounded and listed in missing
+     */
+    Range compute(Instruction* I);
+
+    /**
+     * Tighten r knowing that (value pred other) holds, with other in otherRange
+     */
+    static Range constrain(Range r, CmpInst::Predicate pred, const Range& otherRange, bool isInteger);
+
+    /**
+     * Sound range of a loop carried value reached again while computing it
+     */
+    Range cycleRange(Value* V);
+
+    /**
+     * Signed range proved by scalar evolution, unbounded if V is not an integer
+     */
+    Range scevRange(Value* V);
+
+    /// Dominators visited looking for conditions on a value, to bound the cost (and the nesting) of a query on
+    /// very deep trees
+    static constexpr unsigned MaxConditionDepth = 64;
+
+    Function& F;
+
+    llvm::VRAPass* context;
+
+    DominatorTree& DT;
+
+    ScalarEvolution& SE;
+
+    /// @brief range of each value over all its executions
+    DenseMap<const Value*, Range> ranges;
+
+    /// @brief range of a value refined for a block
+    DenseMap<std::pair<const Value*, const BasicBlock*>, Range> refined;
+
+    /// @brief values being computed, to detect cycles
+    SmallPtrSet<const Value*, 16> inProgress;
+
+    /// @brief true while solve() runs: values not memoized are not computed on request but listed in missing
+    bool solving = false;
+
+    /// @brief values requested by the current compute() and not memoized yet, in request order
+    SmallVector<Instruction*, 8> missing;
+};
+
+#endif
@@ -2,6 +2,8 @@
 #include "llvm/Passes/PassBuilder.h"
 #include "llvm/Passes/PassPlugin.h"
 #include "VRAPass.h"
+#include "VRAAnalysis.h"
+#include "RangeMetadata.hpp"
 
 using namespace llvm;
 
@@ -12,6 +14,18 @@ extern "C" ::llvm::PassPluginLibraryInfo LLVM_ATTRIBUTE_WEAK llvmGetPassPluginIn
       "Hello",
       "1.0",
       [](PassBuilder &PB) {
+        PB.registerAnalysisRegistrationCallback(
+            [](FunctionAnalysisManager &FAM) {
+              FAM.registerPass([] { return VRAFunctionAnalysis(); });
+              FAM.registerPass([] { return VRALazyAnalysis(); });
+            });
+
+        PB.registerAnalysisRegistrationCallback(
+            [](ModuleAnalysisManager &MAM) {
+              MAM.registerPass([] { return VRAModuleAnalysis(); });
+              MAM.registerPass([] { return VRAGlobalAnalysis(); });
+            });
+
         PB.registerPipelineParsingCallback(
             [](StringRef Name, ModulePassManager &PM, ArrayRef<PassBuilder::PipelineElement>) {
               if (Name == "vra") {
@@ -19,6 +33,35 @@ extern "C" ::llvm::PassPluginLibraryInfo LLVM_ATTRIBUTE_WEAK llvmGetPassPluginIn
                 return true;
               }
 
+              // global scope of the module, shared by the per function analyses that follow
+              if (Name == "require<vra-globals>") {
+                PM.addPass(RequireAnalysisPass<VRAGlobalAnalysis, Module>());
+                return true;
+              }
+
+              return false;
+            });
+
+        // per function ranges, cached by the function analysis manager
+        PB.registerPipelineParsingCallback(
+            [](StringRef Name, FunctionPassManager &PM, ArrayRef<PassBuilder::PipelineElement>) {
+              if (Name == "require<vra>") {
+                PM.addPass(RequireAnalysisPass<VRAFunctionAnalysis, Function>());
+                return true;
+              }
+
+              // demand driven ranges of VRALazyAnalysis
+              if (Name == "print<vra-lazy>") {
+                PM.addPass(VRALazyPrinterPass(errs()));
+                return true;
+              }
+
+              // ranges left in the IR by -vra-write-metadata
+              if (Name == "print<vra-metadata>") {
+                PM.addPass(RangeMetadataPrinterPass(errs()));
+                return true;
+              }
+
               return false;
             });
       }};
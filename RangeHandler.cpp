@@ -4,7 +4,7 @@
 
 #include "RangeHandler.hpp"
 
-
+#define DEBUG_TYPE "vra"
 
 Range RangeHandler::Merge(const Range& a, const Range& b) {
     float min = std::min(a.min, b.min);
@@ -75,7 +75,7 @@ Range RangeHandler::MulOnLoop(Range r1, Range r2, int minIter, int maxIter) {
 Range RangeHandler::Div(Range r1, Range r2) {
     
     if (r2.min <= 0 && r2.max >= 0) {
-        errs() << "  [VRA] Divisione per zero potenziale, salto\n";
+        LLVM_DEBUG(dbgs() << "  [VRA] Divisione per zero potenziale, salto\n");
         return Range();
     } else {
         float a = r1.min, b = r1.max;
@@ -85,4 +85,37 @@ Range RangeHandler::Div(Range r1, Range r2) {
             std::max({a / c, a / d, b / c, b / d})
         );
     }
-}
\ No newline at end of file
+}
+
+Range RangeHandler::Below(const Range& r, const Range& bound) {
+    if (bound.max < r.min) return r;
+    return Range(r.min, std::min(r.max, bound.max));
+}
+
+Range RangeHandler::Above(const Range& r, const Range& bound) {
+    if (bound.min > r.max) return r;
+    return Range(std::max(r.min, bound.min), r.max);
+}
+
+Range RangeHandler::Apply(OpCode op, const Range& r1, const Range& r2, int minIter, int maxIter) {
+    switch (op) {
+    case OpCode::Add:
+        return Add(r1, r2, minIter, maxIter);
+    case OpCode::Sub:
+        return Sub(r1, r2, minIter, maxIter);
+    case OpCode::Mul:
+        return MulOnLoop(r1, r2, minIter, maxIter);
+    case OpCode::Merge:
+        return Merge(r1, r2);
+    case OpCode::Below:
+        return Below(r1, r2);
+    case OpCode::Above:
+        return Above(r1, r2);
+    case OpCode::Leaf:
+    case OpCode::Call:
+        break;
+    }
+    return Range(NEG_INF, POS_INF);
+}
+
+#undef DEBUG_TYPE
@@ -36,6 +36,14 @@ struct Range {
         }
     }
 
+    bool operator==(const Range& other) const {
+        return min == other.min && max == other.max;
+    }
+
+    bool operator!=(const Range& other) const {
+        return !(*this == other);
+    }
+
     /**
      * Enlarge the range after an operation if necessary.
      */
@@ -49,6 +57,20 @@ struct Range {
     }
 };
 
+/**
+ * Operation computing the range of an operand from the ranges of its dependencies
+ */
+enum class OpCode : uint8_t {
+    Leaf,       // no computation: the range is known or it is an unknown input
+    Add,
+    Sub,
+    Mul,
+    Merge,      // join of the incoming values (phi nodes)
+    Below,      // first value, with the upper bound lowered to the one of the second (branch guards)
+    Above,      // first value, with the lower bound raised to the one of the second (branch guards)
+    Call        // callee summary applied to the argument operands (see CallBinding), evaluated by Operand
+};
+
 class RangeHandler {
 
     public:
@@ -80,6 +102,22 @@ class RangeHandler {
      */
     static Range Div(Range r1, Range r2);
 
+    /**
+     * r knowing that it is not above bound.max. If it cannot be, the guarded path is not taken with
+     * these ranges and r is kept
+     */
+    static Range Below(const Range& r, const Range& bound);
+
+    /**
+     * r knowing that it is not below bound.min, see Below
+     */
+    static Range Above(const Range& r, const Range& bound);
+
+    /**
+     * Evaluate the operation op over (up to) two input ranges, done inside loop if iterations are > 1
+     */
+    static Range Apply(OpCode op, const Range& r1, const Range& r2, int minIter, int maxIter);
+
 };
 
 
@@ -0,0 +1,96 @@
+#include "RangeMetadata.hpp"
+
+#include "llvm/Analysis/ValueTracking.h"
+#include "llvm/IR/ConstantRange.h"
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/Metadata.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "Utils.hpp"
+
+void RangeMetadata::set(Instruction* I, const Range& r) {
+    I->setMetadata(RangeKind, encode(I->getContext(), r));
+}
+
+void RangeMetadata::set(GlobalObject* GO, const Range& r) {
+    GO->setMetadata(RangeKind, encode(GO->getContext(), r));
+}
+
+void RangeMetadata::setArguments(Function* F, ArrayRef<std::optional<Range>> ranges) {
+    LLVMContext& C = F->getContext();
+
+    SmallVector<Metadata*, 8> nodes;
+    for (const std::optional<Range>& r : ranges) {
+        nodes.push_back(r ? encode(C, *r) : MDNode::get(C, {}));
+    }
+    F->setMetadata(ArgsKind, MDNode::get(C, nodes));
+}
+
+std::optional<Range> RangeMetadata::get(const Instruction* I) {
+    if (auto r = decode(I->getMetadata(RangeKind))) return r;
+
+    // written by someone else (e.g. the front end)
+    if (const MDNode* N = I->getMetadata(LLVMContext::MD_range)) {
+        ConstantRange CR = getConstantRangeFromMetadata(*N);
+        return Range(static_cast<float>(CR.getSignedMin().signedRoundToDouble()),
+                     static_cast<float>(CR.getSignedMax().signedRoundToDouble()));
+    }
+    return std::nullopt;
+}
+
+std::optional<Range> RangeMetadata::get(const GlobalObject* GO) {
+    return decode(GO->getMetadata(RangeKind));
+}
+
+std::optional<Range> RangeMetadata::get(const Argument* A) {
+    const MDNode* args = A->getParent()->getMetadata(ArgsKind);
+    if (!args || A->getArgNo() >= args->getNumOperands()) return std::nullopt;
+
+    return decode(dyn_cast_or_null<MDNode>(args->getOperand(A->getArgNo()).get()));
+}
+
+std::optional<Range> RangeMetadata::get(const Value* V) {
+    if (auto* I = dyn_cast<Instruction>(V)) return get(I);
+    if (auto* A = dyn_cast<Argument>(V)) return get(A);
+    if (auto* GO = dyn_cast<GlobalObject>(V)) return get(GO);
+    return std::nullopt;
+}
+
+MDNode* RangeMetadata::encode(LLVMContext& C, const Range& r) {
+    // float widens to double exactly, and double constants are printed in decimal
+    Type* T = Type::getDoubleTy(C);
+    return MDNode::get(C, {ConstantAsMetadata::get(ConstantFP::get(T, r.min)),
+                           ConstantAsMetadata::get(ConstantFP::get(T, r.max))});
+}
+
+std::optional<Range> RangeMetadata::decode(const MDNode* N) {
+    if (!N || N->getNumOperands() != 2) return std::nullopt;
+
+    auto* lo = mdconst::dyn_extract_or_null<ConstantFP>(N->getOperand(0));
+    auto* hi = mdconst::dyn_extract_or_null<ConstantFP>(N->getOperand(1));
+    if (!lo || !hi) return std::nullopt;
+
+    Range r;
+    r.min = static_cast<float>(lo->getValueAPF().convertToDouble());
+    r.max = static_cast<float>(hi->getValueAPF().convertToDouble());
+    return r;
+}
+
+PreservedAnalyses RangeMetadataPrinterPass::run(Function& F, FunctionAnalysisManager& FAM) {
+    auto print = [this](const Value& V, const Range& r) {
+        OS << "  ";
+        V.printAsOperand(OS, false);
+        OS << ": [" << Utils::formatFloatSmart(r.min) << ", " << Utils::formatFloatSmart(r.max) << "]\n";
+    };
+
+    OS << "Ranges of " << F.getName() << ":\n";
+    for (const Argument& A : F.args()) {
+        if (auto r = RangeMetadata::get(&A)) print(A, *r);
+    }
+    for (const Instruction& I : instructions(F)) {
+        if (auto r = RangeMetadata::get(&I)) print(I, *r);
+    }
+    return PreservedAnalyses::all();
+}
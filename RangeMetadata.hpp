@@ -0,0 +1,77 @@
+#ifndef RANGE_METADATA_H
+#define RANGE_METADATA_H
+
+#include <optional>
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/Instruction.h"
+#include "llvm/IR/PassManager.h"
+
+#include "RangeHandler.hpp"
+
+using namespace llvm;
+
+/**
+ * Ranges stored in the IR, so that later passes and separate opt runs can read them without running VRA again:
+ *
+ *   instructions and globals:  !taffo.range !{double min, double max}
+ *   arguments:                 !taffo.args on the function, one !{double min, double max} (or !{}) per argument
+ *
+ * Metadata is dropped by passes that do not understand it, a missing range just means unknown.
+ * LLVM !range is never written: optimizations take it as a promise, and the ranges of VRA are estimates
+ * (e.g. loops approximated by their iteration count), not proofs.
+ */
+class RangeMetadata {
+
+public:
+
+    static constexpr const char* RangeKind = "taffo.range";
+    static constexpr const char* ArgsKind = "taffo.args";
+
+    static void set(Instruction* I, const Range& r);
+
+    static void set(GlobalObject* GO, const Range& r);
+
+    /**
+     * Ranges of the arguments of F, in argument order. Unknown ones are nullopt
+     */
+    static void setArguments(Function* F, ArrayRef<std::optional<Range>> ranges);
+
+    /**
+     * Range of I: !taffo.range, or the signed bounds of !range when only that one is present
+     */
+    static std::optional<Range> get(const Instruction* I);
+
+    static std::optional<Range> get(const GlobalObject* GO);
+
+    static std::optional<Range> get(const Argument* A);
+
+    /**
+     * Range of any instruction, argument or global, nullopt for other values or when no range is attached
+     */
+    static std::optional<Range> get(const Value* V);
+
+private:
+
+    static MDNode* encode(LLVMContext& C, const Range& r);
+
+    static std::optional<Range> decode(const MDNode* N);
+};
+
+/**
+ * Print the ranges attached by VRA to the values of a function (print<vra-metadata>)
+ */
+class RangeMetadataPrinterPass : public PassInfoMixin<RangeMetadataPrinterPass> {
+public:
+
+    explicit RangeMetadataPrinterPass(raw_ostream& OS) : OS(OS) {}
+
+    PreservedAnalyses run(Function& F, FunctionAnalysisManager& FAM);
+
+private:
+
+    raw_ostream& OS;
+};
+
+#endif
@@ -4,6 +4,26 @@
 #include "BlockVisitor.hpp"
 #include "FunctionAnalyzer.hpp"
 
+#include "llvm/ADT/Statistic.h"
+#include "llvm/Support/TimeProfiler.h"
+
+#ifndef DEBUG_TYPE
+#define DEBUG_TYPE "vra"
+#endif
+
+STATISTIC(NumLoopHeaders, "Loop headers visited");
+STATISTIC(NumLoopLatches, "Loop latches visited");
+STATISTIC(NumForks, "Fork blocks visited");
+STATISTIC(NumMerges, "Merge blocks visited");
+STATISTIC(NumLoopExits, "Loop exit blocks visited");
+STATISTIC(NumSimpleBlocks, "Simple blocks visited (straight-line, inter-loop forks)");
+
+/**
+ * Time trace region of a callback, detailed with the block name only when the profiler is on
+ */
+#define VRA_VISIT_SCOPE(name, block) \
+    TimeTraceScope visitScope(name, [&]() { return (block)->getLLVMBasicBlock()->getName().str(); })
+
 class RangePropagationVisitor : public BlockVisitor {
 public:
     // reference to the global analyzer state
@@ -13,39 +33,54 @@ public:
 
     void visitLoopHeader(Block* header) override {
         // initialize or merge header scope
-        owner->emplaceBreadcrumb(AggregationType::Loop, header);
+        VRA_VISIT_SCOPE("VRALoopHeader", header);
+        ++NumLoopHeaders;
         owner->initLoop(header);
     }
 
     void visitLoopLatch(Block* latch) override {
         // update ranges on latch
+        VRA_VISIT_SCOPE("VRALoopLatch", latch);
+        ++NumLoopLatches;
         owner->processLoopLatch(latch);
     }
 
     void visitStandardFork(Block* fork) override {
         // merge fork-init comparisons
+        VRA_VISIT_SCOPE("VRAFork", fork);
+        ++NumForks;
         owner->initStandardFork(fork);
     }
 
     void visitStandardMerge(Block* join) override {
         // merge branch scopes
+        VRA_VISIT_SCOPE("VRAMerge", join);
+        ++NumMerges;
         owner->handleStandardMerge(join);
     }
 
     void visitSimple(Block* simple) override {
-        // default successor enqueue
+        // straight-line block
+        VRA_VISIT_SCOPE("VRASimple", simple);
+        ++NumSimpleBlocks;
         owner->processSimpleBlock(simple);
     }
 
     void visitLoopExit(Block* exit) override {
-        // default successor enqueue
-        owner->processSimpleBlock(exit);
+        // join the blocks leaving the loop
+        VRA_VISIT_SCOPE("VRALoopExit", exit);
+        ++NumLoopExits;
+        owner->handleLoopExit(exit);
     }
 
     void visitInterLoopFork(Block* fork) override {
-        // default successor enqueue
+        // successors are ordered by the scheduler, analyze it as a simple block
+        VRA_VISIT_SCOPE("VRAInterLoopFork", fork);
+        ++NumSimpleBlocks;
         owner->processSimpleBlock(fork);
     }
 };
 
+#undef VRA_VISIT_SCOPE
+
 #endif
\ No newline at end of file
@@ -0,0 +1,107 @@
+#include "RangeSolver.hpp"
+
+void RangeSolver::setWidening(std::vector<float> t, unsigned delay) {
+    thresholds = std::move(t);
+    wideningDelay = delay;
+}
+
+bool RangeSolver::widen(Operand* op, const Range& r) {
+    if (!op->isResolvable()) {
+        op->range = r;
+        // the operands depending on op may be resolvable now
+        Operand::invalidateFailures();
+    } else {
+        Range before = *op->range;
+        if (!op->range->tryRangeEnlarging(r) || *op->range == before) return false;
+    }
+
+    notifyUsers(op);
+    propagate();
+    return true;
+}
+
+void RangeSolver::invalidate(Operand* op) {
+    schedule(op);
+    propagate();
+}
+
+void RangeSolver::narrow(Operand* op, const Range& r) {
+    if (!op->isResolvable() || op->isFixed() || *op->range == r) return;
+
+    op->range = r;
+    notifyUsers(op, true);
+    propagate(true);
+}
+
+Range RangeSolver::widenWithThresholds(const Range& cur, const Range& next) const {
+    Range result = cur;
+
+    if (next.min < cur.min) {
+        // largest threshold <= next.min
+        auto it = std::upper_bound(thresholds.begin(), thresholds.end(), next.min);
+        result.min = it == thresholds.begin() ? NEG_INF : *std::prev(it);
+    }
+
+    if (next.max > cur.max) {
+        // smallest threshold >= next.max
+        auto it = std::lower_bound(thresholds.begin(), thresholds.end(), next.max);
+        result.max = it == thresholds.end() ? POS_INF : *it;
+    }
+
+    return result;
+}
+
+bool RangeSolver::isWideningPoint(const Operand* op) {
+    for (unsigned i = 0; i < op->numDeps; ++i) {
+        if (op->dependencies[i]->index > op->index) return true;
+    }
+    return false;
+}
+
+void RangeSolver::schedule(Operand* op) {
+    if (op->dirty) return;
+    op->dirty = true;
+    dirty.push(op);
+}
+
+void RangeSolver::notifyUsers(Operand* op, bool forwardOnly) {
+    if (op->resolvedWith && *op->resolvedWith == *op->range) return;
+    op->resolvedWith = op->range;
+
+    for (Operand* user : op->users) {
+        // users created before op close a loop: they are loop headers, only revisited while going up
+        if (!forwardOnly || user->index > op->index) schedule(user);
+    }
+}
+
+void RangeSolver::propagate(bool narrowing) {
+    while (!dirty.empty()) {
+        Operand* op = dirty.top();
+        dirty.pop();
+        op->dirty = false;
+
+        if (op->opcode == OpCode::Leaf || op->isFixed() || !op->tryResolution()) continue;
+
+        Range cur = *op->range;
+        Range result = op->evaluate();
+        Range next;
+
+        if (narrowing) {
+            // descending step: never go above the current (post-fixpoint) range
+            next = Range(std::max(cur.min, result.min), std::min(cur.max, result.max));
+            if (next.min > next.max) next = cur;
+        } else {
+            // ranges only grow while solving, so a widened operand keeps what it has gained
+            next = RangeHandler::Merge(cur, result);
+            if (next != cur && isWideningPoint(op) && ++op->updates > wideningDelay) {
+                next = widenWithThresholds(cur, next);
+            }
+        }
+
+        numReevaluations++;
+        if (next == cur) continue;
+
+        op->range = next;
+        notifyUsers(op, narrowing);
+    }
+}
@@ -0,0 +1,114 @@
+#ifndef RANGE_SOLVER_H
+#define RANGE_SOLVER_H
+
+#include <queue>
+#include <vector>
+
+#include "ScopeHandler.hpp"
+
+/**
+ * Settings of the loop fixpoint (abstract interpretation of loop headers)
+ */
+struct FixpointConfig {
+    /// @brief solve loop headers to a fixpoint instead of approximating loops by their iteration count
+    bool enabled = false;
+
+    /// @brief updates of a loop header before jumping to the next threshold
+    unsigned wideningDelay = 2;
+
+    /// @brief descending passes done on a loop after the widened fixpoint
+    unsigned narrowingPasses = 2;
+
+    /// @brief values the widening can stop at, besides the infinities (sorted, no duplicates)
+    std::vector<float> thresholds;
+};
+
+/**
+ * Incremental solver over the operand dependency graph of a function.
+ * When the range of an operand is enlarged, only the operands depending on it are evaluated again,
+ * in topological order, and propagation stops as soon as a range does not change.
+ */
+class RangeSolver {
+
+public:
+
+    /**
+     * Set the widening applied to operands closing a loop (their dependency was created after them)
+     */
+    void setWidening(std::vector<float> thresholds, unsigned delay);
+
+    /**
+     * Enlarge the range of op with r and re-evaluate its cone of dependents
+     * @return true if the range of op has changed
+     */
+    bool widen(Operand* op, const Range& r);
+
+    /**
+     * Evaluate again op (e.g. after a dependency has been added) and its cone of dependents
+     */
+    void invalidate(Operand* op);
+
+    /**
+     * Shrink the range of op to r (which must be contained in it) and refine its cone of dependents.
+     * Only forward edges are followed, so a call always terminates
+     */
+    void narrow(Operand* op, const Range& r);
+
+    /**
+     * Widening operator: bounds moving away from cur jump to the next threshold (or to infinity)
+     */
+    Range widenWithThresholds(const Range& cur, const Range& next) const;
+
+    /**
+     * True if op is a loop header: one of its dependencies was created after it (back edge)
+     */
+    static bool isWideningPoint(const Operand* op);
+
+    /// @brief number of operands evaluated again since the solver creation
+    unsigned getNumReevaluations() const {
+        return numReevaluations;
+    }
+
+private:
+
+    struct LaterFirst {
+        bool operator()(const Operand* a, const Operand* b) const {
+            return a->index > b->index;
+        }
+    };
+
+    /**
+     * Put op in the dirty set, if not already there
+     */
+    void schedule(Operand* op);
+
+    /**
+     * Schedule the users of op if its range moved away from the one they were computed with
+     */
+    void notifyUsers(Operand* op, bool forwardOnly = false);
+
+    /**
+     * Evaluate dirty operands until the queue is empty. While narrowing, ranges are refined
+     * (intersection with the new value) instead of enlarged
+     */
+    void propagate(bool narrowing = false);
+
+    /**
+     * Dirty operands, earliest in topological order first
+     */
+    std::priority_queue<Operand*, std::vector<Operand*>, LaterFirst> dirty;
+
+    unsigned numReevaluations = 0;
+
+    /**
+     * Sorted widening thresholds
+     */
+    std::vector<float> thresholds;
+
+    /**
+     * Updates of a widening point before the widening operator is used
+     */
+    unsigned wideningDelay = 2;
+};
+
+#endif
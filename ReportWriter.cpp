@@ -0,0 +1,216 @@
+#include "ReportWriter.hpp"
+
+#include <charconv>
+#include <cmath>
+
+#include "llvm/ADT/SmallString.h"
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/IR/ModuleSlotTracker.h"
+
+#include "VRAPass.h"
+
+static StringRef varTypeName(VarType type) {
+    switch (type) {
+        case VarType::Local:        return "local";
+        case VarType::Argument:     return "argument";
+        case VarType::Constant:     return "constant";
+        case VarType::ArgumentRef:  return "argument_ref";
+        case VarType::Return:       return "return";
+    }
+    return "unknown";
+}
+
+void ReportWriter::writeModule(Module& M, VRAPass& vra) {
+    // unnamed values and blocks are named by their slot number, as the IR printer does
+    ModuleSlotTracker slots(&M);
+    MST = &slots;
+    SmallString<32> blockName;
+
+    if (Scope* global = vra.getGlobalScope()) writeScope(*global, StringRef(), StringRef());
+
+    for (Function& F : M.functions()) {
+        Scope* fscope = vra.getFunctionScope(F.getName().str());
+        if (!fscope) continue;
+
+        slots.incorporateFunction(F);
+        writeScope(*fscope, F.getName(), StringRef());
+
+        DenseMap<const Scope*, BasicBlock*> blockOf;
+        for (BasicBlock& BB : F) {
+            if (Scope* scope = vra.getBlockScope(&BB)) blockOf[scope] = &BB;
+        }
+
+        for (BasicBlock& BB : F) {
+            Scope* scope = vra.getBlockScope(&BB);
+            if (!scope || scopeIds.count(scope)) continue;
+
+            // a block scope can be nested in the one of a block coming later in the layout: write that first
+            SmallVector<const Scope*, 8> chain;
+            for (const Scope* s = scope; s && !scopeIds.count(s) && blockOf.count(s); s = s->getParent()) {
+                chain.push_back(s);
+            }
+
+            for (const Scope* s : llvm::reverse(chain)) {
+                BasicBlock* owner = blockOf.lookup(s);
+                blockName.clear();
+                raw_svector_ostream nameOS(blockName);
+                owner->printAsOperand(nameOS, false, slots);
+                writeScope(*s, F.getName(), StringRef(blockName).drop_front());    // no leading %
+            }
+        }
+    }
+
+    MST = nullptr;
+    OS.flush();
+}
+
+void ReportWriter::writeScope(const Scope& scope) {
+    SmallVector<const Scope*, 8> chain;
+    for (const Scope* s = &scope; s && !scopeIds.count(s); s = s->getParent()) {
+        chain.push_back(s);
+    }
+
+    for (const Scope* s : llvm::reverse(chain)) {
+        writeScope(*s, StringRef(), StringRef());
+    }
+    OS.flush();
+}
+
+void ReportWriter::writeScope(const Scope& scope, StringRef function, StringRef block) {
+    unsigned id = scopeIds.size();
+    scopeIds[&scope] = id;
+
+    beginRecord("scope");
+    key("id");
+    number(id);
+
+    key("parent");
+    auto parent = scopeIds.find(scope.getParent());
+    if (scope.getParent() && parent != scopeIds.end()) number(parent->second);
+    else null();
+
+    key("function");
+    if (!function.empty()) string(function);
+    else null();
+
+    key("block");
+    if (!block.empty()) string(block);
+    else null();
+    endRecord();
+
+    for (const Operand* op : scope.getOperands()) {
+        writeValue(id, op->name, op->value, *op);
+    }
+    for (const auto& [value, op] : scope.getAliases()) {
+        writeValue(id, value->getName(), value, *op);
+    }
+}
+
+StringRef ReportWriter::getValueName(const Value& V, ModuleSlotTracker* MST, SmallVectorImpl<char>& buffer) {
+    if (V.hasName()) return V.getName();
+
+    buffer.clear();
+    raw_svector_ostream nameOS(buffer);
+    if (MST) V.printAsOperand(nameOS, false, *MST);
+    else V.printAsOperand(nameOS, false);
+    return StringRef(buffer.data(), buffer.size()).drop_front();    // no leading % or @
+}
+
+void ReportWriter::writeValue(unsigned scopeId, StringRef name, const Value* value, const Operand& op) {
+    // the operand of an unnamed argument has a name of its own (arg_N), the slot is the one of the IR
+    if (value && !value->hasName()) name = getValueName(*value, MST, slotName);
+
+    beginRecord("value");
+    key("scope");
+    number(scopeId);
+    key("name");
+    string(name);
+    key("kind");
+    string(varTypeName(op.type));
+
+    key("min");
+    if (op.range) number(op.range->min);
+    else null();
+
+    key("max");
+    if (op.range) number(op.range->max);
+    else null();
+
+    key("fixed");
+    OS << (op.range && op.range->isFixed ? "true" : "false");
+    endRecord();
+}
+
+void ReportWriter::beginRecord(StringRef record) {
+    if (format == Format::JsonLines) OS << '{';
+    firstField = true;
+
+    key("schema");
+    number(SchemaVersion);
+    key("record");
+    string(record);
+}
+
+void ReportWriter::endRecord() {
+    if (format == Format::JsonLines) OS << '}';
+    OS << '\n';
+}
+
+void ReportWriter::key(StringRef name) {
+    if (format == Format::JsonLines) {
+        if (!firstField) OS << ',';
+        OS << '"' << name << "\":";
+    } else {
+        // every record is an item of the top level sequence
+        OS << (firstField ? "- " : "\n  ") << name << ": ";
+    }
+    firstField = false;
+}
+
+void ReportWriter::string(StringRef s) {
+    // YAML double quoted scalars use the JSON escapes
+    OS << '"';
+    for (char c : s) {
+        switch (c) {
+            case '"':  OS << "\\\""; break;
+            case '\\': OS << "\\\\"; break;
+            case '\n': OS << "\\n"; break;
+            case '\t': OS << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    OS << "\\u00" << hexdigit((c >> 4) & 0xF, true) << hexdigit(c & 0xF, true);
+                } else {
+                    OS << c;
+                }
+        }
+    }
+    OS << '"';
+}
+
+void ReportWriter::number(float v) {
+    bool json = format == Format::JsonLines;
+
+    if (std::isnan(v)) {
+        if (json) null();
+        else OS << ".nan";
+        return;
+    }
+    if (std::isinf(v)) {
+        if (json) OS << (v < 0 ? "\"-inf\"" : "\"inf\"");
+        else OS << (v < 0 ? "-.inf" : ".inf");
+        return;
+    }
+
+    // shortest text reading back to the same float
+    char buf[32];
+    OS.write(buf, std::to_chars(buf, buf + sizeof(buf), v).ptr - buf);
+}
+
+void ReportWriter::number(unsigned v) {
+    char buf[16];
+    OS.write(buf, std::to_chars(buf, buf + sizeof(buf), v).ptr - buf);
+}
+
+void ReportWriter::null() {
+    OS << (format == Format::JsonLines ? "null" : "~");
+}
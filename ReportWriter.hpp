@@ -0,0 +1,101 @@
+#ifndef REPORT_WRITER_H
+#define REPORT_WRITER_H
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/IR/Module.h"
+#include "llvm/IR/ModuleSlotTracker.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "ScopeHandler.hpp"
+
+using namespace llvm;
+
+namespace llvm {
+    class VRAPass;
+}
+
+/**
+ * Streams the scopes computed by VRA as one record per line (JSON lines) or per sequence item (YAML).
+ * Every record is written straight to the stream, numbers are formatted with std::to_chars in a stack buffer:
+ * nothing is allocated per value.
+ *
+ * Schema (version SchemaVersion), the same keys in both formats:
+ *
+ *   scope:  schema, record: "scope", id, parent (id or null), function (or null), block (or null)
+ *   value:  schema, record: "value", scope (id), name, kind, min, max, fixed
+ *
+ * Ids are given in writing order and a scope is always written before its values and its children, so
+ * the output of the same results is byte for byte the same. Unnamed values are named by their slot number
+ * (see getValueName), as in the results file. Unresolved values have null bounds,
+ * infinities are the strings "-inf"/"inf" in JSON and -.inf/.inf in YAML.
+ */
+class ReportWriter {
+
+public:
+
+    enum class Format { JsonLines, Yaml };
+
+    static constexpr unsigned SchemaVersion = 1;
+
+    ReportWriter(raw_ostream& OS, Format format) : OS(OS), format(format) {}
+
+    /**
+     * The global scope, then every defined function in module order: its scope and its block scopes in layout order
+     */
+    void writeModule(Module& M, VRAPass& vra);
+
+    /**
+     * A scope without function context, after its parents
+     */
+    void writeScope(const Scope& scope);
+
+    /**
+     * Name of V in the report and in the results file: its IR name, or its slot number as the IR printer writes
+     * it, without the leading % or @. MST has incorporated the function of V (nullptr to compute the slots).
+     * An unnamed value is printed in buffer
+     */
+    static StringRef getValueName(const Value& V, ModuleSlotTracker* MST, SmallVectorImpl<char>& buffer);
+
+private:
+
+    /**
+     * Scope record and then its values. Parents not written yet get no id (null)
+     */
+    void writeScope(const Scope& scope, StringRef function, StringRef block);
+
+    /// Value record of op, under name (the value of an alias has its own name), or the slot of value if it is unnamed
+    void writeValue(unsigned scopeId, StringRef name, const Value* value, const Operand& op);
+
+    void beginRecord(StringRef record);
+
+    void endRecord();
+
+    /// Key of the next field, with the separator of the format
+    void key(StringRef name);
+
+    void string(StringRef s);
+
+    void number(float v);
+
+    void number(unsigned v);
+
+    void null();
+
+    raw_ostream& OS;
+
+    Format format;
+
+    bool firstField = true;
+
+    /// @brief Id of each scope written so far
+    DenseMap<const Scope*, unsigned> scopeIds;
+
+    /// @brief Slots of the function being written, nullptr outside writeModule
+    ModuleSlotTracker* MST = nullptr;
+
+    /// @brief Slot name of the last unnamed value
+    SmallString<32> slotName;
+};
+
+#endif
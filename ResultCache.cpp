@@ -0,0 +1,470 @@
+#include "ResultCache.hpp"
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/raw_ostream.h"
+#include "llvm/Support/xxhash.h"
+
+#include <algorithm>
+#include <cstring>
+
+constexpr char ResultCache::Magic[4];
+
+ResultCache::ResultCache(StringRef path) : path(path.str()) {
+    auto fileOrErr = MemoryBuffer::getFile(path, /*IsText=*/false, /*RequiresNullTerminator=*/false);
+    if (!fileOrErr) return;
+
+    std::unique_ptr<MemoryBuffer> file = std::move(*fileOrErr);
+    const char* begin = file->getBufferStart();
+    size_t size = file->getBufferSize();
+
+    if (size < sizeof(Header)) return;
+    const Header* h = reinterpret_cast<const Header*>(begin);
+    if (std::memcmp(h->magic, Magic, sizeof(Magic)) != 0 || h->version != Version) return;
+
+    size_t expected = sizeof(Header) + size_t(h->numEntries) * sizeof(EntryRecord)
+                    + size_t(h->numScopes) * sizeof(ScopeRecord) + size_t(h->numOperands) * sizeof(OperandRecord)
+                    + size_t(h->numNodes) * sizeof(NodeRecord) + size_t(h->numInts) * sizeof(int32_t) + h->stringsSize;
+    if (size != expected) return;
+
+    header = h;
+    entries = reinterpret_cast<const EntryRecord*>(begin + sizeof(Header));
+    scopes = reinterpret_cast<const ScopeRecord*>(entries + h->numEntries);
+    operands = reinterpret_cast<const OperandRecord*>(scopes + h->numScopes);
+    nodes = reinterpret_cast<const NodeRecord*>(operands + h->numOperands);
+    ints = reinterpret_cast<const int32_t*>(nodes + h->numNodes);
+    strings = reinterpret_cast<const char*>(ints + h->numInts);
+    buffer = std::move(file);
+}
+
+const ResultCache::EntryRecord* ResultCache::findMapped(uint64_t key) const {
+    if (!header) return nullptr;
+
+    const EntryRecord* end = entries + header->numEntries;
+    const EntryRecord* it = std::lower_bound(entries, end, key,
+        [](const EntryRecord& e, uint64_t k) { return e.key < k; });
+
+    return it != end && it->key == key ? it : nullptr;
+}
+
+std::optional<Range> ResultCache::readRange(float min, float max, uint8_t flags) {
+    if (!(flags & HasRange)) return std::nullopt;
+
+    // stored as is: the constructor would reorder an empty range
+    Range range(0.0f, 0.0f, flags & IsFixed);
+    range.min = min;
+    range.max = max;
+    return range;
+}
+
+CachedFunction ResultCache::readMapped(const EntryRecord& entry) const {
+    CachedFunction result;
+    if (size_t(entry.firstScope) + entry.numScopes > header->numScopes
+        || size_t(entry.firstNode) + entry.numNodes > header->numNodes
+        || size_t(entry.firstBlock) + entry.numBlocks > header->numInts) return result;
+
+    auto readString = [this](uint32_t offset, uint32_t size) -> std::optional<std::string> {
+        if (size_t(offset) + size > header->stringsSize) return std::nullopt;
+        return std::string(strings + offset, size);
+    };
+
+    result.scopes.reserve(entry.numScopes);
+    for (const ScopeRecord& scopeRec : makeArrayRef(scopes + entry.firstScope, entry.numScopes)) {
+        if (size_t(scopeRec.firstOperand) + scopeRec.numOperands + scopeRec.numAliases > header->numOperands) return {};
+
+        CachedScope scope;
+        scope.parent = scopeRec.parent;
+
+        const OperandRecord* rec = operands + scopeRec.firstOperand;
+        for (unsigned i = 0; i < scopeRec.numOperands + scopeRec.numAliases; ++i, ++rec) {
+            auto name = readString(rec->nameOffset, rec->nameSize);
+            if (!name) return {};
+
+            CachedOperand op;
+            op.name = std::move(*name);
+            op.valueIndex = rec->valueIndex;
+            op.type = static_cast<VarType>(rec->type);
+            op.range = readRange(rec->min, rec->max, rec->flags);
+            (i < scopeRec.numOperands ? scope.operands : scope.aliases).push_back(std::move(op));
+        }
+        result.scopes.push_back(std::move(scope));
+    }
+
+    result.blockScopes.assign(ints + entry.firstBlock, ints + entry.firstBlock + entry.numBlocks);
+
+    result.summary.reserve(entry.numNodes);
+    for (const NodeRecord& rec : makeArrayRef(nodes + entry.firstNode, entry.numNodes)) {
+        auto callee = readString(rec.calleeOffset, rec.calleeSize);
+        if (!callee || size_t(rec.firstCallArg) + rec.numCallArgs > header->numInts) return {};
+
+        SummaryNode node;
+        node.opcode = static_cast<OpCode>(rec.opcode);
+        node.range = readRange(rec.min, rec.max, rec.flags);
+        node.argNo = rec.argNo;
+        node.numDeps = rec.numDeps;
+        node.deps = {rec.deps[0], rec.deps[1]};
+        node.minIter = rec.minIter;
+        node.maxIter = rec.maxIter;
+        node.callee = std::move(*callee);
+        node.callArgs.assign(ints + rec.firstCallArg, ints + rec.firstCallArg + rec.numCallArgs);
+        result.summary.push_back(std::move(node));
+    }
+    return result;
+}
+
+std::optional<CachedFunction> ResultCache::lookup(uint64_t key) const {
+    auto it = pending.find(key);
+    if (it != pending.end()) return it->second;
+
+    if (const EntryRecord* entry = findMapped(key)) return readMapped(*entry);
+
+    return std::nullopt;
+}
+
+void ResultCache::insert(uint64_t key, CachedFunction function) {
+    pending[key] = std::move(function);
+}
+
+bool ResultCache::save() const {
+    // merge the mapped entries still valid with the new ones, keeping the table sorted by key
+    std::map<uint64_t, const CachedFunction*> merged;
+    std::vector<CachedFunction> mappedFunctions;
+
+    if (header) {
+        mappedFunctions.reserve(header->numEntries);
+        for (const EntryRecord& e : makeArrayRef(entries, header->numEntries)) {
+            if (pending.count(e.key)) continue;
+            mappedFunctions.push_back(readMapped(e));
+            merged[e.key] = &mappedFunctions.back();
+        }
+    }
+    for (auto& kv : pending) {
+        merged[kv.first] = &kv.second;
+    }
+
+    std::vector<EntryRecord> entryTable;
+    std::vector<ScopeRecord> scopeTable;
+    std::vector<OperandRecord> operandTable;
+    std::vector<NodeRecord> nodeTable;
+    std::vector<int32_t> intTable;
+    std::string stringTable;
+    entryTable.reserve(merged.size());
+
+    auto writeOperand = [&](const CachedOperand& op) {
+        OperandRecord rec = {};
+        rec.nameOffset = stringTable.size();
+        rec.nameSize = op.name.size();
+        rec.valueIndex = op.valueIndex;
+        rec.type = static_cast<uint8_t>(op.type);
+        if (op.range) {
+            rec.min = op.range->min;
+            rec.max = op.range->max;
+            rec.flags = HasRange | (op.range->isFixed ? IsFixed : 0);
+        }
+        stringTable += op.name;
+        operandTable.push_back(rec);
+    };
+
+    for (auto& kv : merged) {
+        const CachedFunction& function = *kv.second;
+
+        EntryRecord entry = {};
+        entry.key = kv.first;
+        entry.firstScope = scopeTable.size();
+        entry.numScopes = function.scopes.size();
+        entry.firstNode = nodeTable.size();
+        entry.numNodes = function.summary.size();
+        entry.firstBlock = intTable.size();
+        entry.numBlocks = function.blockScopes.size();
+        entryTable.push_back(entry);
+
+        for (const CachedScope& scope : function.scopes) {
+            scopeTable.push_back({scope.parent, static_cast<uint32_t>(operandTable.size()),
+                                  static_cast<uint32_t>(scope.operands.size()), static_cast<uint32_t>(scope.aliases.size())});
+            for (const CachedOperand& op : scope.operands) writeOperand(op);
+            for (const CachedOperand& op : scope.aliases) writeOperand(op);
+        }
+
+        intTable.insert(intTable.end(), function.blockScopes.begin(), function.blockScopes.end());
+
+        for (const SummaryNode& node : function.summary) {
+            NodeRecord rec = {};
+            if (node.range) {
+                rec.min = node.range->min;
+                rec.max = node.range->max;
+                rec.flags = HasRange | (node.range->isFixed ? IsFixed : 0);
+            }
+            rec.argNo = node.argNo;
+            rec.deps[0] = node.deps[0];
+            rec.deps[1] = node.deps[1];
+            rec.minIter = node.minIter;
+            rec.maxIter = node.maxIter;
+            rec.calleeOffset = stringTable.size();
+            rec.calleeSize = node.callee.size();
+            rec.firstCallArg = intTable.size();
+            rec.numCallArgs = node.callArgs.size();
+            rec.opcode = static_cast<uint8_t>(node.opcode);
+            rec.numDeps = node.numDeps;
+
+            stringTable += node.callee;
+            intTable.insert(intTable.end(), node.callArgs.begin(), node.callArgs.end());
+            nodeTable.push_back(rec);
+        }
+    }
+
+    Header h = {};
+    std::memcpy(h.magic, Magic, sizeof(Magic));
+    h.version = Version;
+    h.numEntries = entryTable.size();
+    h.numScopes = scopeTable.size();
+    h.numOperands = operandTable.size();
+    h.numNodes = nodeTable.size();
+    h.numInts = intTable.size();
+    h.stringsSize = stringTable.size();
+
+    SmallString<128> tmpPath;
+    int fd;
+    if (sys::fs::createUniqueFile(path + ".tmp-%%%%%%", fd, tmpPath)) return false;
+
+    {
+        raw_fd_ostream out(fd, /*shouldClose=*/true);
+        auto writeTable = [&out](const auto& table) {
+            out.write(reinterpret_cast<const char*>(table.data()), table.size() * sizeof(table[0]));
+        };
+        out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+        writeTable(entryTable);
+        writeTable(scopeTable);
+        writeTable(operandTable);
+        writeTable(nodeTable);
+        writeTable(intTable);
+        out.write(stringTable.data(), stringTable.size());
+        out.close();
+
+        if (out.has_error()) {
+            out.clear_error();
+            sys::fs::remove(tmpPath);
+            return false;
+        }
+    }
+
+    if (sys::fs::rename(tmpPath, path)) {
+        sys::fs::remove(tmpPath);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Append the raw bytes of v to the hashed stream
+ */
+template<typename T>
+static void hashRaw(raw_ostream& os, const T& v) {
+    os.write(reinterpret_cast<const char*>(&v), sizeof(T));
+}
+
+static void hashType(raw_ostream& os, Type* T, SmallPtrSetImpl<Type*>& namedSeen) {
+    hashRaw(os, static_cast<uint8_t>(T->getTypeID()));
+    hashRaw(os, T->isIntegerTy() ? T->getIntegerBitWidth() : 0u);
+    if (T->isArrayTy()) hashRaw(os, T->getArrayNumElements());
+    if (auto* VT = dyn_cast<FixedVectorType>(T)) hashRaw(os, VT->getNumElements());
+
+    // named structs can contain themselves (through pointers): their body is hashed once per function
+    if (auto* ST = dyn_cast<StructType>(T); ST && ST->hasName()) {
+        hashRaw(os, static_cast<uint32_t>(ST->getName().size()));
+        os << ST->getName();
+        if (!namedSeen.insert(T).second) return;
+    }
+
+    hashRaw(os, T->getNumContainedTypes());
+    for (Type* contained : T->subtypes()) hashType(os, contained, namedSeen);
+}
+
+static void hashName(raw_ostream& os, const Value* V) {
+    StringRef name = V->getName();
+    hashRaw(os, static_cast<uint32_t>(name.size()));
+    os << name;
+}
+
+std::vector<const Value*> ResultCache::numberValues(const Function& F) {
+    std::vector<const Value*> values;
+    for (const Argument& A : F.args()) values.push_back(&A);
+    for (const BasicBlock& BB : F) {
+        values.push_back(&BB);
+        for (const Instruction& I : BB) values.push_back(&I);
+    }
+    return values;
+}
+
+uint64_t ResultCache::hashFunction(const Function& F) {
+    // values are referred to by position, so that the hash does not depend on addresses
+    DenseMap<const Value*, uint32_t> position;
+    uint32_t next = 0;
+    for (const Value* V : numberValues(F)) position[V] = next++;
+
+    SmallString<4096> bytes;
+    raw_svector_ostream os(bytes);
+    SmallPtrSet<Type*, 8> namedSeen;
+
+    hashRaw(os, F.isVarArg());
+    hashType(os, F.getReturnType(), namedSeen);
+    for (const Argument& A : F.args()) {
+        hashType(os, A.getType(), namedSeen);
+        hashName(os, &A);
+    }
+
+    for (const BasicBlock& BB : F) {
+        hashRaw(os, static_cast<uint32_t>(BB.size()));
+        hashName(os, &BB);
+
+        for (const Instruction& I : BB) {
+            hashRaw(os, I.getOpcode());
+            hashType(os, I.getType(), namedSeen);
+            hashName(os, &I);
+            // nsw/nuw/exact/inbounds and the fast-math flags
+            hashRaw(os, I.getRawSubclassOptionalData());
+            if (auto* cmp = dyn_cast<CmpInst>(&I)) hashRaw(os, static_cast<uint32_t>(cmp->getPredicate()));
+
+            // types and indices that are not operands
+            if (auto* GEP = dyn_cast<GetElementPtrInst>(&I)) hashType(os, GEP->getSourceElementType(), namedSeen);
+            if (auto* AI = dyn_cast<AllocaInst>(&I)) hashType(os, AI->getAllocatedType(), namedSeen);
+            if (auto* CB = dyn_cast<CallBase>(&I)) hashType(os, CB->getFunctionType(), namedSeen);
+            if (auto* EV = dyn_cast<ExtractValueInst>(&I)) {
+                for (unsigned idx : EV->indices()) hashRaw(os, idx);
+            }
+            if (auto* IV = dyn_cast<InsertValueInst>(&I)) {
+                for (unsigned idx : IV->indices()) hashRaw(os, idx);
+            }
+
+            hashRaw(os, I.getNumOperands());
+            for (const Value* V : I.operand_values()) {
+                auto it = position.find(V);
+                if (it != position.end()) {
+                    hashRaw(os, 'P');
+                    hashRaw(os, it->second);
+                } else if (auto* CI = dyn_cast<ConstantInt>(V)) {
+                    hashRaw(os, 'I');
+                    os << CI->getValue();
+                } else if (auto* CF = dyn_cast<ConstantFP>(V)) {
+                    hashRaw(os, 'F');
+                    os << CF->getValueAPF().bitcastToAPInt();
+                } else {
+                    // globals by name, other constants by kind
+                    hashRaw(os, 'G');
+                    hashRaw(os, V->getValueID());
+                    hashName(os, V);
+                }
+                hashType(os, V->getType(), namedSeen);
+            }
+        }
+    }
+
+    return xxHash64(bytes);
+}
+
+uint64_t ResultCache::combine(ArrayRef<uint64_t> hashes) {
+    return xxHash64(StringRef(reinterpret_cast<const char*>(hashes.data()), hashes.size() * sizeof(uint64_t)));
+}
+
+CachedFunction ResultCache::capture(const Function& F, const Scope& functionScope,
+                                   function_ref<const Scope*(const BasicBlock&)> blockScope, std::vector<SummaryNode> summary) {
+    std::vector<const Value*> values = numberValues(F);
+    DenseMap<const Value*, int32_t> position;
+    for (size_t i = 0; i < values.size(); ++i) position[values[i]] = i;
+
+    auto indexOf = [](const auto& map, const auto* key) -> int32_t {
+        auto it = map.find(key);
+        return it != map.end() ? it->second : -1;
+    };
+
+    auto copy = [&](const Value* value, const Operand* op) {
+        CachedOperand cached;
+        cached.name = op->name;
+        cached.type = op->type;
+        cached.range = op->range;
+        cached.valueIndex = indexOf(position, value);
+        return cached;
+    };
+
+    CachedFunction result;
+    DenseMap<const Scope*, int32_t> scopeIndex;
+    auto add = [&](const Scope& scope) {
+        scopeIndex[&scope] = result.scopes.size();
+
+        CachedScope cached;
+        cached.parent = indexOf(scopeIndex, scope.getParent());
+        for (const Operand* op : scope.getOperands()) cached.operands.push_back(copy(op->value, op));
+        for (const auto& [value, op] : scope.getAliases()) cached.aliases.push_back(copy(value, op));
+        result.scopes.push_back(std::move(cached));
+    };
+    add(functionScope);
+
+    SmallPtrSet<const Scope*, 32> ownedByBlock;
+    for (const BasicBlock& BB : F) {
+        if (const Scope* scope = blockScope(BB)) ownedByBlock.insert(scope);
+    }
+
+    // parents first: a block scope can be nested in the one of a block coming later in the layout
+    for (const BasicBlock& BB : F) {
+        SmallVector<const Scope*, 8> chain;
+        for (const Scope* s = blockScope(BB); s && !scopeIndex.count(s) && ownedByBlock.count(s); s = s->getParent()) {
+            chain.push_back(s);
+        }
+        for (const Scope* s : llvm::reverse(chain)) add(*s);
+
+        const Scope* scope = blockScope(BB);
+        result.blockScopes.push_back(indexOf(scopeIndex, scope));
+    }
+
+    result.summary = std::move(summary);
+    return result;
+}
+
+Scope* ResultCache::restore(const Function& F, const CachedFunction& cached, Scope* global, AnalysisArena& arena,
+                            std::vector<std::unique_ptr<Scope>>& scopes, DenseMap<const BasicBlock*, Scope*>& blockScopes) {
+    if (cached.scopes.empty()) return nullptr;
+
+    std::vector<const Value*> values = numberValues(F);
+    auto valueAt = [&values](int32_t index) -> const Value* {
+        return index >= 0 && size_t(index) < values.size() ? values[index] : nullptr;
+    };
+
+    std::vector<Scope*> restored;
+    restored.reserve(cached.scopes.size());
+
+    for (const CachedScope& c : cached.scopes) {
+        // only the function scope is nested in the global one
+        Scope* parent = c.parent >= 0 && size_t(c.parent) < restored.size() ? restored[c.parent]
+                      : restored.empty() ? global : nullptr;
+        auto scope = std::make_unique<Scope>(parent, arena);
+
+        for (const CachedOperand& op : c.operands) {
+            const Value* value = valueAt(op.valueIndex);
+            scope->addOperand(op.range
+                ? arena.makeOperand(op.name, *op.range, op.type, value)
+                : arena.makeOperand(op.name, op.type, value));
+        }
+        for (const CachedOperand& op : c.aliases) {
+            const Value* value = valueAt(op.valueIndex);
+            if (!value) continue;
+            scope->addAlias(value, op.range
+                ? arena.makeOperand(op.name, *op.range, op.type)
+                : arena.makeOperand(op.name, op.type));
+        }
+
+        restored.push_back(scope.get());
+        scopes.push_back(std::move(scope));
+    }
+
+    size_t block = 0;
+    for (const BasicBlock& BB : F) {
+        if (block >= cached.blockScopes.size()) break;
+        int32_t index = cached.blockScopes[block++];
+        if (index > 0 && size_t(index) < restored.size()) blockScopes[&BB] = restored[index];
+    }
+
+    return restored.front();
+}
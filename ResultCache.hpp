@@ -0,0 +1,270 @@
+#ifndef RESULT_CACHE_H
+#define RESULT_CACHE_H
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/IR/Function.h"
+#include "llvm/Support/MemoryBuffer.h"
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "llvm/ADT/DenseMap.h"
+
+#include "ScopeHandler.hpp"
+#include "AnalysisArena.hpp"
+#include "FunctionSummary.hpp"
+
+using namespace llvm;
+
+/**
+ * Operand (or alias) of a scope as stored in the cache
+ */
+struct CachedOperand {
+    std::string name;
+
+    /// @brief position of the IR value (arguments first, then instructions), -1 if the operand has no value
+    int32_t valueIndex = -1;
+
+    VarType type = VarType::Local;
+
+    /// @brief solved range, empty if the operand was never resolved
+    std::optional<Range> range;
+};
+
+/**
+ * Scope of a function (the function scope or the scope of a block) as stored in the cache
+ */
+struct CachedScope {
+    /// @brief position of the parent in CachedFunction::scopes, always before this one (-1 for the global scope)
+    int32_t parent = -1;
+
+    std::vector<CachedOperand> operands;
+
+    /// @brief values bound to operands of other scopes, each stored with a copy of its operand
+    std::vector<CachedOperand> aliases;
+};
+
+/**
+ * Everything the outputs of VRA and the analysis of the callers need from a function
+ */
+struct CachedFunction {
+    /// @brief function scope first, then the block scopes in report order
+    std::vector<CachedScope> scopes;
+
+    /// @brief scope of each block of the function in layout order, -1 if the block has none
+    std::vector<int32_t> blockScopes;
+
+    /// @brief flattened summary (see FunctionSummary::flatten)
+    std::vector<SummaryNode> summary;
+};
+
+/**
+ * Persistent cache of the scopes and summaries computed by VRA, keyed by a hash of the function and of its inputs.
+ *
+ * The file is a flat image, read in place from the mapped buffer:
+ *   Header | EntryRecord[numEntries] (sorted by key) | ScopeRecord[numScopes] | OperandRecord[numOperands] |
+ *   NodeRecord[numNodes] | int32_t[numInts] (block scopes and call arguments) | string table
+ * Entries computed during the run are kept apart and written back, with the still valid mapped ones, by save().
+ */
+class ResultCache {
+
+public:
+
+    /**
+     * Map the cache file at path. A missing or malformed file gives an empty cache
+     */
+    explicit ResultCache(StringRef path);
+
+    /**
+     * Function stored for key, if any (an unreadable entry has no scopes)
+     */
+    std::optional<CachedFunction> lookup(uint64_t key) const;
+
+    /**
+     * Whether lookup(key) finds an entry
+     */
+    bool contains(uint64_t key) const {
+        return pending.count(key) || findMapped(key);
+    }
+
+    /**
+     * Count a function restored from its entry
+     */
+    void noteHit() {
+        ++hits;
+    }
+
+    /**
+     * Count a function analyzed because it has no (readable) entry: the cache has to be written back
+     */
+    void noteMiss() {
+        ++misses;
+    }
+
+    /**
+     * Count a function analyzed although it has an entry, because a callee (or a function of its SCC) was analyzed
+     */
+    void noteStale() {
+        ++stale;
+    }
+
+    /**
+     * Store (or replace) the function of key, written on the next save()
+     */
+    void insert(uint64_t key, CachedFunction function);
+
+    /**
+     * Write the whole cache to its file (through a temporary file, so that concurrent readers never see it partial)
+     * @return false if the file cannot be written
+     */
+    bool save() const;
+
+    unsigned getNumHits() const {
+        return hits;
+    }
+
+    unsigned getNumMisses() const {
+        return misses;
+    }
+
+    unsigned getNumStale() const {
+        return stale;
+    }
+
+    /**
+     * Structural hash of F: types, opcodes, flags (wrapping, exact, fast-math), operands (constants by value, other
+     * values by position) and names, so that any change that can alter the analysis changes the hash
+     */
+    static uint64_t hashFunction(const Function& F);
+
+    /**
+     * Combine hashes into a key, e.g. the structural hash of a function with the hash of the analysis inputs
+     */
+    static uint64_t combine(ArrayRef<uint64_t> hashes);
+
+    /**
+     * Copy the function scope of F, the scopes of its blocks (blockScope gives nullptr for blocks without one)
+     * and its flattened summary
+     */
+    static CachedFunction capture(const Function& F, const Scope& functionScope,
+                                  function_ref<const Scope*(const BasicBlock&)> blockScope, std::vector<SummaryNode> summary);
+
+    /**
+     * Rebuild the scopes captured from F, nested in global, with their operands allocated in arena.
+     * The scopes are appended to scopes and the block ones indexed in blockScopes
+     * @return the function scope, nullptr if nothing was stored
+     */
+    static Scope* restore(const Function& F, const CachedFunction& cached, Scope* global, AnalysisArena& arena,
+                          std::vector<std::unique_ptr<Scope>>& scopes, DenseMap<const BasicBlock*, Scope*>& blockScopes);
+
+    /**
+     * Values of F in the order used for valueIndex: arguments, then each block followed by its instructions
+     */
+    static std::vector<const Value*> numberValues(const Function& F);
+
+private:
+
+    struct Header {
+        char magic[4];
+        uint32_t version;
+        uint32_t numEntries;
+        uint32_t numScopes;
+        uint32_t numOperands;
+        uint32_t numNodes;
+        uint32_t numInts;
+        uint32_t stringsSize;   // the header size keeps the entry table 8 byte aligned
+    };
+
+    struct EntryRecord {
+        uint64_t key;
+        uint32_t firstScope;
+        uint32_t numScopes;
+        uint32_t firstNode;
+        uint32_t numNodes;
+        uint32_t firstBlock;
+        uint32_t numBlocks;
+    };
+
+    struct ScopeRecord {
+        int32_t parent;
+        uint32_t firstOperand;
+        uint32_t numOperands;
+        uint32_t numAliases;    // stored after the operands
+    };
+
+    struct OperandRecord {
+        uint32_t nameOffset;
+        uint32_t nameSize;
+        int32_t valueIndex;
+        float min;
+        float max;
+        uint8_t type;
+        uint8_t flags;
+        uint16_t reserved;
+    };
+
+    struct NodeRecord {
+        float min;
+        float max;
+        int32_t argNo;
+        int32_t deps[2];
+        int32_t minIter;
+        int32_t maxIter;
+        uint32_t calleeOffset;
+        uint32_t calleeSize;
+        uint32_t firstCallArg;
+        uint32_t numCallArgs;
+        uint8_t opcode;
+        uint8_t numDeps;
+        uint8_t flags;
+        uint8_t reserved;
+    };
+
+    enum OperandFlags : uint8_t { HasRange = 1, IsFixed = 2 };
+
+    static constexpr char Magic[4] = {'V', 'R', 'A', 'C'};
+    static constexpr uint32_t Version = 2;
+
+    /**
+     * Mapped entry of key, nullptr if not found
+     */
+    const EntryRecord* findMapped(uint64_t key) const;
+
+    CachedFunction readMapped(const EntryRecord& entry) const;
+
+    /**
+     * Range stored with flags, empty if it has none
+     */
+    static std::optional<Range> readRange(float min, float max, uint8_t flags);
+
+    std::string path;
+
+    /**
+     * Content of the file, nullptr if it was missing or invalid
+     */
+    std::unique_ptr<MemoryBuffer> buffer;
+
+    const Header* header = nullptr;
+    const EntryRecord* entries = nullptr;
+    const ScopeRecord* scopes = nullptr;
+    const OperandRecord* operands = nullptr;
+    const NodeRecord* nodes = nullptr;
+    const int32_t* ints = nullptr;
+    const char* strings = nullptr;
+
+    /**
+     * Entries computed in this run, they replace the mapped ones with the same key
+     */
+    std::map<uint64_t, CachedFunction> pending;
+
+    /// @brief functions restored, analyzed without an entry, and analyzed with one: they add up to the defined ones
+    unsigned hits = 0;
+    unsigned misses = 0;
+    unsigned stale = 0;
+};
+
+#endif
@@ -0,0 +1,196 @@
+#include "ResultFile.hpp"
+
+#include "llvm/ADT/SmallString.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <string>
+
+using namespace ResultFormat;
+
+void ResultFileWriter::addFunction(StringRef name, ArrayRef<Entry> values) {
+    functions.push_back({name, values.vec()});
+}
+
+/**
+ * Write the raw bytes of the elements of v
+ */
+template<typename T>
+static void writeArray(raw_ostream& out, const std::vector<T>& v) {
+    out.write(reinterpret_cast<const char*>(v.data()), v.size() * sizeof(T));
+}
+
+bool ResultFileWriter::write(StringRef path) const {
+    // sorted copies: the file does not depend on the order functions and values were added
+    std::vector<const FunctionEntries*> sorted;
+    for (const FunctionEntries& F : functions) sorted.push_back(&F);
+    std::sort(sorted.begin(), sorted.end(),
+        [](const FunctionEntries* a, const FunctionEntries* b) { return a->name < b->name; });
+
+    std::vector<FunctionRecord> functionTable;
+    std::vector<uint32_t> ids, nameOffsets, nameSizes, byName;
+    std::vector<float> mins, maxs;
+    std::vector<uint8_t> flags;
+    std::string stringTable;
+
+    auto addString = [&stringTable](StringRef s) {
+        uint32_t offset = stringTable.size();
+        stringTable += s;
+        return offset;
+    };
+
+    for (const FunctionEntries* F : sorted) {
+        uint32_t first = ids.size();
+        functionTable.push_back({addString(F->name), static_cast<uint32_t>(F->name.size()), first,
+                                 static_cast<uint32_t>(F->values.size())});
+
+        std::vector<Entry> values = F->values;
+        std::stable_sort(values.begin(), values.end(), [](const Entry& a, const Entry& b) {
+            return a.id != b.id ? a.id < b.id : a.name < b.name;
+        });
+
+        for (const Entry& v : values) {
+            ids.push_back(v.id);
+            nameOffsets.push_back(addString(v.name));
+            nameSizes.push_back(v.name.size());
+            mins.push_back(v.range ? v.range->min : 0.0f);
+            maxs.push_back(v.range ? v.range->max : 0.0f);
+            flags.push_back(v.range ? HasRange | (v.range->isFixed ? IsFixed : 0) : 0);
+        }
+
+        // secondary index of the function by name
+        byName.resize(ids.size());
+        std::iota(byName.begin() + first, byName.end(), first);
+        std::stable_sort(byName.begin() + first, byName.end(), [&values, first](uint32_t a, uint32_t b) {
+            return values[a - first].name < values[b - first].name;
+        });
+    }
+
+    Header h = {};
+    std::memcpy(h.magic, Magic, sizeof(Magic));
+    h.version = Version;
+    h.numFunctions = functionTable.size();
+    h.numValues = ids.size();
+    h.stringsSize = stringTable.size();
+
+    SmallString<128> tmpPath;
+    int fd;
+    if (sys::fs::createUniqueFile(path + ".tmp-%%%%%%", fd, tmpPath)) return false;
+
+    {
+        raw_fd_ostream out(fd, /*shouldClose=*/true);
+        out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+        writeArray(out, functionTable);
+        writeArray(out, ids);
+        writeArray(out, nameOffsets);
+        writeArray(out, nameSizes);
+        writeArray(out, byName);
+        writeArray(out, mins);
+        writeArray(out, maxs);
+        writeArray(out, flags);
+        out.write(stringTable.data(), stringTable.size());
+        out.close();
+
+        if (out.has_error()) {
+            out.clear_error();
+            sys::fs::remove(tmpPath);
+            return false;
+        }
+    }
+
+    if (sys::fs::rename(tmpPath, path)) {
+        sys::fs::remove(tmpPath);
+        return false;
+    }
+    return true;
+}
+
+ResultFile::ResultFile(StringRef path) {
+    // large files are mapped, not read
+    auto fileOrErr = MemoryBuffer::getFile(path, /*IsText=*/false, /*RequiresNullTerminator=*/false);
+    if (!fileOrErr) return;
+
+    std::unique_ptr<MemoryBuffer> file = std::move(*fileOrErr);
+    const char* begin = file->getBufferStart();
+    size_t size = file->getBufferSize();
+
+    if (size < sizeof(Header)) return;
+    const Header* h = reinterpret_cast<const Header*>(begin);
+    if (std::memcmp(h->magic, Magic, sizeof(Magic)) != 0 || h->version != Version) return;
+
+    size_t n = h->numValues;
+    size_t expected = sizeof(Header) + size_t(h->numFunctions) * sizeof(FunctionRecord)
+                    + n * (4 * sizeof(uint32_t) + 2 * sizeof(float) + sizeof(uint8_t)) + h->stringsSize;
+    if (size != expected) return;
+
+    header = h;
+    functions = reinterpret_cast<const FunctionRecord*>(begin + sizeof(Header));
+    ids = reinterpret_cast<const uint32_t*>(functions + h->numFunctions);
+    nameOffsets = ids + n;
+    nameSizes = nameOffsets + n;
+    byName = nameSizes + n;
+    mins = reinterpret_cast<const float*>(byName + n);
+    maxs = mins + n;
+    flags = reinterpret_cast<const uint8_t*>(maxs + n);
+    strings = reinterpret_cast<const char*>(flags + n);
+    buffer = std::move(file);
+}
+
+StringRef ResultFile::getString(uint32_t offset, uint32_t size) const {
+    if (size_t(offset) + size > header->stringsSize) return StringRef();
+    return StringRef(strings + offset, size);
+}
+
+const FunctionRecord* ResultFile::findFunction(StringRef name) const {
+    if (!header) return nullptr;
+
+    const FunctionRecord* end = functions + header->numFunctions;
+    const FunctionRecord* it = std::lower_bound(functions, end, name,
+        [this](const FunctionRecord& F, StringRef n) { return getString(F.nameOffset, F.nameSize) < n; });
+
+    if (it == end || getString(it->nameOffset, it->nameSize) != name) return nullptr;
+    if (size_t(it->firstValue) + it->numValues > header->numValues) return nullptr;
+    return it;
+}
+
+std::optional<Range> ResultFile::getRange(uint32_t index) const {
+    if (!(flags[index] & HasRange)) return std::nullopt;
+
+    // stored as is: the constructor would reorder an empty range
+    Range r(0.0f, 0.0f, flags[index] & IsFixed);
+    r.min = mins[index];
+    r.max = maxs[index];
+    return r;
+}
+
+std::optional<Range> ResultFile::lookup(StringRef function, uint32_t id) const {
+    const FunctionRecord* F = findFunction(function);
+    if (!F) return std::nullopt;
+
+    const uint32_t* first = ids + F->firstValue;
+    const uint32_t* last = first + F->numValues;
+    const uint32_t* it = std::lower_bound(first, last, id);
+    if (it == last || *it != id) return std::nullopt;
+
+    return getRange(it - ids);
+}
+
+std::optional<Range> ResultFile::lookup(StringRef function, StringRef name) const {
+    const FunctionRecord* F = findFunction(function);
+    if (!F) return std::nullopt;
+
+    auto nameOf = [this](uint32_t index) {
+        return index < header->numValues ? getString(nameOffsets[index], nameSizes[index]) : StringRef();
+    };
+
+    const uint32_t* first = byName + F->firstValue;
+    const uint32_t* last = first + F->numValues;
+    const uint32_t* it = std::lower_bound(first, last, name,
+        [&nameOf](uint32_t index, StringRef n) { return nameOf(index) < n; });
+    if (it == last || *it >= header->numValues || nameOf(*it) != name) return std::nullopt;
+
+    return getRange(*it);
+}
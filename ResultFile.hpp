@@ -0,0 +1,148 @@
+#ifndef RESULT_FILE_H
+#define RESULT_FILE_H
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/MemoryBuffer.h"
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "RangeHandler.hpp"
+
+using namespace llvm;
+
+/**
+ * Binary file with the ranges of a module, written by VRAPass (-vra-results) and read in place by ResultFile.
+ *
+ * Values are grouped by function (globals are the function with the empty name) and identified by their
+ * position in the function, in the order of ResultCache::numberValues (module order for globals).
+ * Operands without IR value (e.g. RETURN) have id NoValue and are found by name.
+ *
+ * Layout, every section 4 byte aligned:
+ *   Header
+ *   FunctionRecord[numFunctions]                  sorted by name
+ *   uint32 ids[numValues]                         sorted by id inside each function
+ *   uint32 nameOffsets[numValues], nameSizes[numValues]
+ *   uint32 byName[numValues]                      indexes sorted by name inside each function
+ *   float  mins[numValues], maxs[numValues]
+ *   uint8  flags[numValues]
+ *   string table
+ */
+namespace ResultFormat {
+
+    struct Header {
+        char magic[4];
+        uint32_t version;
+        uint32_t numFunctions;
+        uint32_t numValues;
+        uint32_t stringsSize;
+        uint32_t reserved;
+    };
+
+    struct FunctionRecord {
+        uint32_t nameOffset;
+        uint32_t nameSize;
+        uint32_t firstValue;
+        uint32_t numValues;
+    };
+
+    enum ValueFlags : uint8_t { HasRange = 1, IsFixed = 2 };
+
+    constexpr char Magic[4] = {'V', 'R', 'A', 'R'};
+    constexpr uint32_t Version = 1;
+
+} // namespace ResultFormat
+
+class ResultFileWriter {
+
+public:
+
+    static constexpr uint32_t NoValue = UINT32_MAX;
+
+    struct Entry {
+        uint32_t id;
+
+        /// @brief must stay valid until write()
+        StringRef name;
+
+        /// @brief empty if the value was never resolved
+        std::optional<Range> range;
+    };
+
+    /**
+     * Values of the function named name, in any order. Each function must be added once
+     */
+    void addFunction(StringRef name, ArrayRef<Entry> values);
+
+    /**
+     * Write the file at path, through a temporary file replaced atomically
+     * @return false if the file cannot be written
+     */
+    bool write(StringRef path) const;
+
+private:
+
+    struct FunctionEntries {
+        StringRef name;
+        std::vector<Entry> values;
+    };
+
+    std::vector<FunctionEntries> functions;
+};
+
+/**
+ * Reader of a result file: the file is mapped and the lookups are binary searches on it, with no parsing
+ * and no allocation
+ */
+class ResultFile {
+
+public:
+
+    /**
+     * Map the file at path. A missing or malformed file gives an invalid (empty) result file
+     */
+    explicit ResultFile(StringRef path);
+
+    bool isValid() const {
+        return header != nullptr;
+    }
+
+    /**
+     * Range of the value at position id of function
+     */
+    std::optional<Range> lookup(StringRef function, uint32_t id) const;
+
+    /**
+     * Range of the value named name in function (e.g. "RETURN")
+     */
+    std::optional<Range> lookup(StringRef function, StringRef name) const;
+
+    std::optional<Range> lookupGlobal(StringRef name) const {
+        return lookup(StringRef(), name);
+    }
+
+private:
+
+    const ResultFormat::FunctionRecord* findFunction(StringRef name) const;
+
+    StringRef getString(uint32_t offset, uint32_t size) const;
+
+    std::optional<Range> getRange(uint32_t index) const;
+
+    std::unique_ptr<MemoryBuffer> buffer;
+
+    const ResultFormat::Header* header = nullptr;
+    const ResultFormat::FunctionRecord* functions = nullptr;
+    const uint32_t* ids = nullptr;
+    const uint32_t* nameOffsets = nullptr;
+    const uint32_t* nameSizes = nullptr;
+    const uint32_t* byName = nullptr;
+    const float* mins = nullptr;
+    const float* maxs = nullptr;
+    const uint8_t* flags = nullptr;
+    const char* strings = nullptr;
+};
+
+#endif
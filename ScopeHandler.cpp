@@ -1,121 +1,194 @@
 #include "ScopeHandler.hpp"
+#include "AnalysisArena.hpp"
+#include "ReportWriter.hpp"
+#include "FunctionSummary.hpp"
 #include <algorithm>
 
-std::string Scope::formatFloatSmart(float val) const {
-    std::ostringstream oss;
-
-    // Evita notazione scientifica per valori "normali"
-    if (std::abs(val) < 1e6 && std::abs(val) > 1e-4) {
-        if (std::floor(val) == val) {
-            // Valore intero, stampa come intero
-            oss << static_cast<int>(val);
-        } else if (std::abs(val) < 1.0f) {
-            // Valore piccolo, usa 4 decimali
-            oss << std::fixed << std::setprecision(4) << val;
-        } else {
-            // Valore normale, usa 2 decimali
-            oss << std::fixed << std::setprecision(2) << val;
-        }
-    } else {
-        // Valore molto grande o molto piccolo: usa notazione scientifica
-        oss << std::scientific << std::setprecision(2) << val;
-    }
+#include "llvm/ADT/Statistic.h"
+
+#define DEBUG_TYPE "vra"
+
+STATISTIC(NumLookups, "Scope lookups");
+STATISTIC(NumLookupHops, "Parent scopes visited by lookups of synthetic variables");
+STATISTIC(NumMergedValues, "Values merged by scope joins");
+STATISTIC(NumResolutions, "Operands resolved");
+
+void Scope::addOperand(Operand* op) {
+    // a later definition in the same scope shadows the previous one
+    if (op->value)
+        symbols.insert(op->value, op, *arena);
+    else
+        namedSymbols[op->name] = op;
 
-    return oss.str();
+    operands.push_back(op);
 }
 
-void Scope::addOperand(std::unique_ptr<Operand> op) {
-    operands.push_back(std::move(op));
+void Scope::refine(const Value* value, Operand* op) {
+    symbols.insert(value, op, *arena);
 }
 
-Operand* Scope::lookup(const std::string& name) {
-    for (const auto& op : operands) {
-        if (op->name == name)
-            return op.get();
+void Scope::addAlias(const Value* value, Operand* op) {
+    symbols.insert(value, op, *arena);
+    aliases.emplace_back(value, op);
+}
+
+Operand* Scope::lookup(const Value* value) {
+    ++NumLookups;
+    return symbols.lookup(value);
+}
+
+Operand* Scope::lookup(StringRef name) {
+    ++NumLookups;
+    for (Scope* s = this; s; s = s->parent) {
+        auto it = s->namedSymbols.find(name);
+        if (it != s->namedSymbols.end())
+            return it->second;
+        ++NumLookupHops;
     }
-    if (parent)
-        return parent->lookup(name);
     return nullptr;
 }
 
-std::vector<Operand*> Scope::getOperands() {
-    std::vector<Operand*> result;
-    for (auto& v : operands) {
-        result.push_back(v.get());
-    }
-    return result;
+const std::vector<Operand*>& Scope::getOperands() const {
+    return operands;
 }
 
-//TODO: da controllare
 void Scope::mergeWith(Scope* otherScope) {
-    if (!otherScope) return;
-
-    // Prendiamo tutte le Var* dichiarate (solo locali)
-    // auto otherOperands = otherScope->getOperands();
-    // for (Operand* v : otherOperands) {
-    //     // Cerco in this->variables
-    //     auto it = std::find_if(
-    //         operands.begin(), operands.end(),
-    //         [&](const std::unique_ptr<Operand>& varPtr){
-    //             return varPtr->name == v->name;
-    //         }
-    //     );
-
-    //     if (it != operands.end()) {
-    //         // existing var: check if enlargin is needed
-
-    //         Operand* existing = it->get();
-    //         if (!existing->getRange()->isFixed) {
-    //             existing->getRange()->min = std::min(existing->getRange()->min, v->getRange()->min);
-    //             existing->getRange()->max = std::max(existing->getRange()->max, v->getRange()->max);
-    //         }
-    //     } else {
-    //         // new var: add it
-
-    //         operands.emplace_back(std::make_unique<Operand>(v->name, v->range, VarType::Local));
-    //     }
-    // }
+    if (otherScope) mergeWith(ArrayRef<Scope*>(otherScope));
+}
+
+void Scope::mergeWith(ArrayRef<Scope*> otherScopes) {
+    SmallVector<ScopeMap*, 8> maps;
+    for (Scope* other : otherScopes) {
+        if (other && other != this) maps.push_back(&other->symbols);
+    }
+    if (maps.empty()) return;
+
+    symbols.merge(maps, [this](ArrayRef<Operand*> values) {
+        ++NumMergedValues;
+
+        // a merge node has at most two inputs: merge in cascade, as for phi nodes
+        Operand* acc = values[0];
+        for (size_t i = 1; i + 1 < values.size(); ++i) {
+            acc = arena->makeOperand(acc->name, OpCode::Merge, acc, values[i], VarType::Local);
+        }
+
+        Operand* merged = arena->makeOperand(values[0]->name, OpCode::Merge, acc, values.back(), values[0]->type,
+                                             values[0]->value);
+        merged->tryResolution();
+        operands.push_back(merged);
+        return merged;
+    }, *arena);
 }
 
 void Scope::printJson() const {
-    errs() << toJson() << "\n";
+    ReportWriter(errs(), ReportWriter::Format::JsonLines).writeScope(*this);
 }
 
-bool Operand::tryResolution() {
-    if (isResolvable()) return true;
+Operand::Operand(const std::string& name, const CallBinding* call, VarType type, const Value* value) :
+    name(name), value(value), opcode(OpCode::Call), call(call), type(type) {
+    for (Operand* arg : call->args) {
+        if (arg) arg->addUser(this);
+    }
+}
 
-    std::vector<Range> args;
-    for (Operand* dep : dependencies) {
-        if (!dep->tryResolution())
-            return false;            // se anche una sola fallisce, non risolvo
-        args.push_back(*dep->getRange());
+Range Operand::evaluate() const {
+    if (opcode == OpCode::Call) {
+        SmallVector<Range, 4> args;
+        for (const Operand* arg : call->args) {
+            args.push_back(arg ? arg->getRange() : Range(NEG_INF, POS_INF));
+        }
+        return call->callee->apply(args);
     }
 
-    // Chiamo la funzione simbolica
-    Range result = call(args);
+    const Range lhs = dependencies[0]->getRange();
+    const Range rhs = numDeps > 1 ? dependencies[1]->getRange() : lhs;
+    return RangeHandler::Apply(opcode, lhs, rhs, minIter, maxIter);
+}
+
+namespace {
+
+/// @brief failures recorded in an older epoch are tried again. Operands are never shared by threads, except
+/// the fixed globals which are always resolved
+thread_local unsigned resolutionEpoch = 1;
 
-    // Alloco il risultato nello heap e lo assegno al unique_ptr
-    range = std::make_unique<Range>(result);
+}
 
-    return true;
+void Operand::invalidateFailures() {
+    ++resolutionEpoch;
 }
 
-void Operand::forceResolution() {
-    if (isResolvable()) return;
+bool Operand::tryResolution() {
+    if (isResolvable()) return true;
+    if (opcode == OpCode::Leaf || failedEpoch == resolutionEpoch) return false;    // unknown input (e.g. argument without range)
+
+    // the operands on the stack are marked as failed until they are resolved: a cycle fails too
+    struct Frame {
+        Operand* op;
+        /// @brief call argument: its failure does not prevent the resolution of the call
+        bool optional;
+    };
+    SmallVector<Frame, 16> stack;
+    auto push = [&stack](Operand* op, bool optional) {
+        op->failedEpoch = resolutionEpoch;
+        stack.push_back({op, optional});
+    };
+    push(this, false);
+
+    while (!stack.empty()) {
+        Operand* op = stack.back().op;
+        Operand* next = nullptr;
+        bool optional = false;
+        bool failed = false;
+
+        for (unsigned i = 0; i < op->numDeps; ++i) {
+            Operand* dep = op->dependencies[i];
+            if (dep->isResolvable()) continue;
+            if (dep->opcode == OpCode::Leaf || dep->failedEpoch == resolutionEpoch) failed = true;
+            else next = dep;
+            break;
+        }
 
-    std::vector<Range> args;
-    for (Operand* dep : dependencies) {
-        dep->forceResolution();
-        args.push_back(*dep->getRange());
-    }
+        // arguments without a range are unknown to the callee summary, they do not prevent the resolution
+        if (!next && !failed && op->call) {
+            for (Operand* arg : op->call->args) {
+                if (arg && !arg->isResolvable() && arg->opcode != OpCode::Leaf && arg->failedEpoch != resolutionEpoch) {
+                    next = arg;
+                    optional = true;
+                    break;
+                }
+            }
+        }
+
+        if (failed) {
+            // se anche una sola fallisce, non risolvo: up to the first call argument
+            while (!stack.empty() && !stack.pop_back_val().optional) {}
+            continue;
+        }
+
+        if (next) {
+            push(next, optional);
+            continue;
+        }
 
-    // Chiamo la funzione simbolica
-    Range result = call(args);
+        op->range = op->evaluate();
+        op->resolvedWith = op->range;
+        ++NumResolutions;
+        stack.pop_back();
+    }
 
-    // Alloco il risultato nello heap e lo assegno al unique_ptr
-    range = std::make_unique<Range>(result);
+    return isResolvable();
 }
 
 void Operand::addDepencendy(Operand* op) {
-    dependencies.push_back(op);
-}
\ No newline at end of file
+    assert(numDeps < dependencies.size() && "operands have at most two dependencies");
+    dependencies[numDeps++] = op;
+    op->addUser(this);
+}
+
+void Operand::addUser(Operand* user) {
+    // fixed operands (globals) never change and are shared by functions analyzed in parallel
+    if (isFixed()) return;
+    users.push_back(user);
+}
+
+#undef DEBUG_TYPE
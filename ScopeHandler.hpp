@@ -9,73 +9,145 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <optional>
+#include <array>
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/IR/Value.h"
 
 #include "Utils.hpp"
 #include "RangeHandler.hpp"
+#include "ScopeMap.hpp"
 
 using namespace llvm;
 
 enum class VarType { Local, Argument, Constant, ArgumentRef, Return };
 
+struct CallBinding;
+
 
 struct Operand {
 
     /// @brief name of this operand
     std::string name;
+
+    /// @brief IR value this operand describes, used as symbol key (nullptr for synthetic operands as RETURN)
+    const Value* value;
     
-    /// @brief current solved range
-    std::unique_ptr<Range> range;
+    /// @brief current solved range, empty until resolution
+    std::optional<Range> range;
+
+    /// @brief operation computing the range from the dependencies
+    OpCode opcode = OpCode::Leaf;
+
+    /// @brief number of used dependencies (0 for leaves, 1 or 2 otherwise)
+    uint8_t numDeps = 0;
 
     /// @brief pointers to dependences, pair in case of binary op
-    std::vector<Operand*> dependencies;
+    std::array<Operand*, 2> dependencies = {nullptr, nullptr};
+
+    /// @brief callee and arguments of an OpCode::Call operand, whose dependencies are the arguments
+    const CallBinding* call = nullptr;
+
+    /// @brief operands computed from this one, to re-evaluate when this range is enlarged
+    SmallVector<Operand*, 2> users;
 
-    /// @brief function to call as soon as all dependences are resolved
-    std::function<Range(const std::vector<Range>&)> call;
+    /// @brief position in creation order, which is a topological order of the dependency graph
+    unsigned index = 0;
+
+    /// @brief true while waiting for re-evaluation in the solver
+    bool dirty = false;
+
+    /// @brief times the solver enlarged this operand, used to delay widening on loop headers
+    unsigned updates = 0;
+
+    /// @brief resolution epoch in which tryResolution failed (or is in progress), 0 if never
+    unsigned failedEpoch = 0;
+
+    /// @brief iterations of the instruction when the operand was created (> 1 is inside loop)
+    int minIter = 1;
+    int maxIter = 1;
     
-    /// @brief if the range has been already solved, this is the initial range to to it. If a new input range expand this, then new computation must be done.
-    std::unique_ptr<Range> resolvedWith;
+    /// @brief range the users have been computed with. If the range expands this, then users must be computed again.
+    std::optional<Range> resolvedWith;
 
     VarType type;
 
-    Operand(const std::string& name, std::vector<Operand*> dependencies, std::function<Range(const std::vector<Range>&)> callFn, VarType type) : 
-        name(name), type(type), call(std::move(callFn)), dependencies(dependencies), resolvedWith(nullptr) {  }
+    /**
+     * @brief Constructor for operands computed from other operands
+     * @param name     Name of the operand
+     * @param opcode   Operation to apply to the dependencies
+     * @param lhs      First dependency
+     * @param rhs      Second dependency, nullptr for unary operations
+     * @param type     Variable type
+     * @param value    IR value described by the operand, if any
+     * @param minIter  Minimum iterations of the operation
+     * @param maxIter  Maximum iterations of the operation
+     */
+    Operand(const std::string& name, OpCode opcode, Operand* lhs, Operand* rhs, VarType type, const Value* value = nullptr, int minIter = 1, int maxIter = 1) :
+        name(name), value(value), opcode(opcode), numDeps(rhs ? 2 : 1), dependencies{lhs, rhs}, minIter(minIter), maxIter(maxIter), type(type) {
+        for (unsigned i = 0; i < numDeps; ++i) {
+            dependencies[i]->addUser(this);
+        }
+    }
+
+    /**
+     * @brief Constructor for the result of a call to a summarized function, evaluated again when an argument changes
+     * @param name     Name of the operand
+     * @param call     Callee summary and argument operands, owned by the function analyzer
+     * @param type     Variable type
+     * @param value    Call instruction
+     */
+    Operand(const std::string& name, const CallBinding* call, VarType type, const Value* value);
+
+    /**
+     * @brief Constructor for unknown inputs (e.g. arguments), never resolvable
+     */
+    Operand(const std::string& name, VarType type, const Value* value = nullptr) : name(name), value(value), type(type) {}
 
     /**
      * @brief Constructor for concrete operands with a known initial range
      * @param name         Name of the operand
      * @param initialRange Known range (by value)
      * @param type         Variable type (Local or Argument)
+     * @param value        IR value described by the operand, if any
      */
-    Operand(const std::string& name, const Range& initialRange, VarType type) : name(name), range(std::make_unique<Range>(initialRange)),
-        call(nullptr), resolvedWith(std::make_unique<Range>(initialRange)), type(type) {}
+    Operand(const std::string& name, const Range& initialRange, VarType type, const Value* value = nullptr) : name(name), value(value), range(initialRange),
+        resolvedWith(initialRange), type(type) {}
+
+    bool isFixed() const {
+        return range && range->isFixed;
+    }
 
     bool isResolvable() {
-        return range != nullptr;
+        return range.has_value();
     }
 
-    Range* getRange() {
-        if (!range) return new Range(NEG_INF, POS_INF);
-        return range.get();
+    /// @brief solved range, unbounded if not resolved yet
+    Range getRange() const {
+        return range ? *range : Range(NEG_INF, POS_INF);
     }
 
-    void addDepencendy(Operand* op);
+    /// @brief apply opcode to the current ranges of the dependencies
+    Range evaluate() const;
 
-    bool tryResolution();
+    void addDepencendy(Operand* op);
 
-    void forceResolution();
+    /// @brief record that user is computed from this operand
+    void addUser(Operand* user);
 
-    /// Deep copy constructor
-    Operand(const Operand& other)
-      : name(other.name),
-        range(other.range ? std::make_unique<Range>(*other.range) : nullptr),
-        dependencies(other.dependencies), call(other.call), 
-        resolvedWith(other.resolvedWith ? std::make_unique<Range>(*other.resolvedWith) : nullptr),
-        type(other.type) {}
+    /**
+     * Compute the range from the dependencies, resolving them first (depth first, with an explicit stack).
+     * Fails if a dependency needs an unknown input: the failure is remembered until invalidateFailures()
+     * @return true if the operand has a range
+     */
+    bool tryResolution();
 
-    /// Ritorna un unique_ptr a un clone deep di *this
-    std::unique_ptr<Operand> clone() const {
-        return std::make_unique<Operand>(*this);
-    }
+    /// @brief Start a new resolution epoch: call it when an operand gets a range outside tryResolution,
+    /// so that the operands which failed are tried again
+    static void invalidateFailures();
 };
 
 
@@ -118,42 +190,81 @@ class Scope {
 
 public:
 
-    std::string formatFloatSmart(float val) const;
+    /// @brief Append a new var (you have to ensure this is never created before). The scope does not own it
+    /// @param op operand allocated in the function arena
+    void addOperand(Operand* op);
 
-    /// @brief Create and append a new var (you have to ensure this is never created before)
-    /// @param name name of this var
-    /// @param range range of this var
-    void addOperand(std::unique_ptr<Operand> op);
+    /// @brief Bind value to an operand already computed for another value (same expression), without a new operand
+    /// @param value IR value defined in this scope
+    /// @param op    shared operand, listed in the scope of its own value
+    void addAlias(const Value* value, Operand* op);
+
+    /// @brief Bind value to op in this scope and its children, without listing op among the operands of the scope
+    /// (e.g. the value refined by a branch condition: the operand defining it is still the reported one)
+    void refine(const Value* value, Operand* op);
 
     /// @brief get the lists of all variable in the scope, without consider parent scope
     /// @return all variable in this level of scope
-    std::vector<Operand*> getOperands();
+    const std::vector<Operand*>& getOperands() const;
+
+    /// @brief values of this scope level bound to the operand of another value, see addAlias
+    const std::vector<std::pair<const Value*, Operand*>>& getAliases() const {
+        return aliases;
+    }
 
     // template<size_t N>
     // void addFixVector(const std::string& name, std::array<float, N> vals) {
     //     variables.emplace_back(std::make_unique<FixVector>(name, vals));
     // }
 
-    /// @brief Search a variable recursively on parents in bottom-up
+    /// @brief Search a variable in this scope and in its parents, as they were when this scope was created
+    /// @param value IR value to search
+    /// @return object if found, nullptr otherwise
+    Operand* lookup(const Value* value);
+
+    /// @brief Search a synthetic variable (not bound to an IR value, e.g. RETURN) recursively on parents
     /// @param name symbol to search
     /// @return object if found, nullptr otherwise
-    Operand* lookup(const std::string& name);
+    Operand* lookup(StringRef name);
 
     /**
-     * Merge this scope by adding new variables and enlarging range of existings
+     * Merge this scope by adding new variables and enlarging range of existings: a value bound to different
+     * operands gets a merge operand (the interval hull), added to this scope. Only the values that differ
+     * between the two scopes are visited. Synthetic variables (lookup by name) are not merged
      */
     void mergeWith(Scope* otherScope);
 
+    /**
+     * Merge all the scopes at once (e.g. the predecessors of a join), in a single pass over their symbol
+     * tables. A value bound to different operands gets the interval hull of all of them
+     */
+    void mergeWith(ArrayRef<Scope*> otherScopes);
+
+    /// @brief nodes visited by the lookup of a value in the worst case
+    unsigned getLookupDepth() const {
+        return symbols.getHeight();
+    }
+
     /// Stampa in console la struttura dello scope in modo ordinato
     void prettyPrint(int depth = 0) const;
 
-    /// Ritorna una stringa JSON che descrive questo scope (e ricorsivamente i genitori)
-    std::string toJson() const;
-
-    /// Stampa in console la rappresentazione JSON di questo scope
+    /// Stampa in console questo scope (e ricorsivamente i genitori) come record JSON, vedi ReportWriter
     void printJson() const;
 
-    Scope(Scope* parent): parent(parent) {}
+    Scope* getParent() const {
+        return parent;
+    }
+
+    /// @brief New scope seeing the values of parent in O(1): they share the symbol table until one of them changes
+    /// @param arena arena of the function, where the symbol table grows
+    Scope(Scope* parent, AnalysisArena& arena): parent(parent), arena(&arena),
+        symbols(parent ? (parent->freeze(), parent->symbols.fork()) : ScopeMap()) {}
+
+    /// @brief Share the symbol table with the scopes created from now on. Only the first call after a change writes
+    /// the scope: call it once before children are created concurrently (e.g. on the global scope)
+    void freeze() {
+        symbols.freeze();
+    }
 
 protected:
 
@@ -162,14 +273,31 @@ protected:
 private:
 
     /**
-     * Scope parent for lookups
+     * Scope parent, whose values are also in symbols
      */
     Scope* parent;
 
+    AnalysisArena* arena;
+
+    /**
+     * List of variables in this scope, owned by the arena of the function
+     */
+    std::vector<Operand*> operands;
+
+    /**
+     * Values defined in this scope sharing the operand of an identical expression
+     */
+    std::vector<std::pair<const Value*, Operand*>> aliases;
+
+    /**
+     * Symbol table of this scope and its parents, indexed by IR value
+     */
+    ScopeMap symbols;
+
     /**
-     * List of variables in this scope
+     * Symbol table of this scope level for operands without IR value, the parents are searched one by one
      */
-    std::vector<std::unique_ptr<Operand>> operands;
+    StringMap<Operand*> namedSymbols;
 
 };
 
@@ -0,0 +1,267 @@
+#include "ScopeMap.hpp"
+
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/MathExtras.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstring>
+
+#include "AnalysisArena.hpp"
+
+static constexpr unsigned BitsPerLevel = 5;
+static constexpr uint64_t LevelMask = (1u << BitsPerLevel) - 1;
+
+/**
+ * Unique for the whole process: maps of different functions (and threads) share the nodes of the global scope
+ */
+static uint64_t newToken() {
+    static std::atomic<uint64_t> next{1};
+    return next.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * splitmix64 finalizer. It is a bijection, so two keys never have the same 64 bits and always end up in
+ * different slots within the 13 levels of the trie
+ */
+static uint64_t hashKey(const Value* key) {
+    uint64_t x = reinterpret_cast<uintptr_t>(key);
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+static unsigned slotIndex(uint32_t bitmap, uint32_t bit) {
+    return countPopulation(bitmap & (bit - 1));
+}
+
+bool ScopeMap::sameSlot(const Slot& a, const Slot& b) {
+    return a.key == b.key && (a.key ? a.value == b.value : a.child == b.child);
+}
+
+ScopeMap::ScopeMap() : token(newToken()) {}
+
+ScopeMap::Slot ScopeMap::leaf(const Value* key, Operand* value) {
+    Slot s;
+    s.key = key;
+    s.value = value;
+    return s;
+}
+
+ScopeMap::Slot ScopeMap::child(Node* node) {
+    Slot s;
+    s.key = nullptr;
+    s.child = node;
+    return s;
+}
+
+ScopeMap::Node* ScopeMap::makeNode(unsigned size, unsigned capacity, AnalysisArena& arena) {
+    void* mem = arena.allocate(sizeof(Node) + capacity * sizeof(Slot), alignof(Node));
+    Node* node = new (mem) Node();
+    node->token = token;
+    node->bitmap = 0;
+    node->size = size;
+    node->capacity = capacity;
+    return node;
+}
+
+ScopeMap::Node* ScopeMap::editable(Node* node, unsigned extra, AnalysisArena& arena) {
+    bool mine = token && node->token == token;
+    if (mine && node->size + extra <= node->capacity) return node;
+
+    // nodes growing in this map get some room, copies of shared nodes are exact
+    unsigned capacity = node->size + extra;
+    if (mine) capacity = std::min(32u, std::max(capacity, 2u * node->size));
+
+    Node* copy = makeNode(node->size, capacity, arena);
+    copy->bitmap = node->bitmap;
+    std::memcpy(copy->slots(), node->slots(), node->size * sizeof(Slot));
+    return copy;
+}
+
+ScopeMap::Node* ScopeMap::makePair(unsigned shift, Slot a, uint64_t hashA, Slot b, uint64_t hashB,
+                                   AnalysisArena& arena) {
+    uint32_t bitA = 1u << ((hashA >> shift) & LevelMask);
+    uint32_t bitB = 1u << ((hashB >> shift) & LevelMask);
+
+    if (bitA == bitB) {
+        Node* node = makeNode(1, 1, arena);
+        node->bitmap = bitA;
+        node->slots()[0] = child(makePair(shift + BitsPerLevel, a, hashA, b, hashB, arena));
+        return node;
+    }
+
+    Node* node = makeNode(2, 2, arena);
+    node->bitmap = bitA | bitB;
+    node->slots()[0] = bitA < bitB ? a : b;
+    node->slots()[1] = bitA < bitB ? b : a;
+    return node;
+}
+
+ScopeMap::Node* ScopeMap::insert(Node* node, unsigned shift, uint64_t hash, const Value* key, Operand* value,
+                                 AnalysisArena& arena) {
+    uint32_t bit = 1u << ((hash >> shift) & LevelMask);
+    unsigned index = slotIndex(node->bitmap, bit);
+
+    if (!(node->bitmap & bit)) {
+        Node* out = editable(node, 1, arena);
+        Slot* slots = out->slots();
+        std::memmove(slots + index + 1, slots + index, (out->size - index) * sizeof(Slot));
+        slots[index] = leaf(key, value);
+        out->bitmap |= bit;
+        ++out->size;
+        return out;
+    }
+
+    Slot slot = node->slots()[index];
+    Slot replacement;
+
+    if (slot.key == key) {
+        if (slot.value == value) return node;
+        replacement = leaf(key, value);
+    } else if (slot.key) {
+        replacement = child(makePair(shift + BitsPerLevel, slot, hashKey(slot.key), leaf(key, value), hash, arena));
+    } else {
+        Node* updated = insert(slot.child, shift + BitsPerLevel, hash, key, value, arena);
+        if (updated == slot.child) return node;
+        replacement = child(updated);
+    }
+
+    Node* out = editable(node, 0, arena);
+    out->slots()[index] = replacement;
+    return out;
+}
+
+void ScopeMap::insert(const Value* key, Operand* value, AnalysisArena& arena) {
+    if (!token) token = newToken();
+    if (!root) root = makeNode(0, 4, arena);
+    root = insert(root, 0, hashKey(key), key, value, arena);
+}
+
+Operand* ScopeMap::lookup(const Node* node, unsigned shift, uint64_t hash, const Value* key) {
+    while (node) {
+        uint32_t bit = 1u << ((hash >> shift) & LevelMask);
+        if (!(node->bitmap & bit)) return nullptr;
+
+        const Slot& slot = node->slots()[slotIndex(node->bitmap, bit)];
+        if (slot.key) return slot.key == key ? slot.value : nullptr;
+
+        node = slot.child;
+        shift += BitsPerLevel;
+    }
+    return nullptr;
+}
+
+Operand* ScopeMap::lookup(const Value* key) const {
+    return lookup(root, 0, hashKey(key), key);
+}
+
+void ScopeMap::freeze() {
+    if (token) token = 0;
+}
+
+ScopeMap ScopeMap::fork() const {
+    assert(!token && "only frozen maps can be forked");
+    ScopeMap copy;
+    copy.root = root;
+    return copy;
+}
+
+ScopeMap::Slot ScopeMap::mergeSlots(ArrayRef<Slot> slots, unsigned shift, Combine combine, AnalysisArena& arena) {
+    bool sameKey = true;
+    for (const Slot& s : slots) sameKey &= s.key && s.key == slots[0].key;
+
+    if (sameKey) {
+        SmallVector<Operand*, 8> values;
+        for (const Slot& s : slots) {
+            if (!is_contained(values, s.value)) values.push_back(s.value);
+        }
+        return values.size() == 1 ? slots[0] : leaf(slots[0].key, combine(values));
+    }
+
+    // different keys or a subtrie: the bindings go one level down, as single leaf nodes
+    SmallVector<Node*, 8> children;
+    for (const Slot& s : slots) {
+        if (!s.key) {
+            children.push_back(s.child);
+            continue;
+        }
+        Node* single = makeNode(1, 1, arena);
+        single->bitmap = 1u << ((hashKey(s.key) >> shift) & LevelMask);
+        single->slots()[0] = s;
+        children.push_back(single);
+    }
+    return child(merge(children, shift, combine, arena));
+}
+
+ScopeMap::Node* ScopeMap::merge(ArrayRef<Node*> nodes, unsigned shift, Combine combine, AnalysisArena& arena) {
+    Node* mine = nodes[0];
+
+    // the nodes shared by all the tries (e.g. what the common dominator defined) are not visited
+    SmallVector<Node*, 8> distinct;
+    uint32_t bitmap = 0;
+    for (Node* node : nodes) {
+        if (!node || is_contained(distinct, node)) continue;
+        distinct.push_back(node);
+        bitmap |= node->bitmap;
+    }
+    if (distinct.empty()) return nullptr;
+    if (distinct.size() == 1) return distinct[0];
+
+    bool changed = !mine || bitmap != mine->bitmap;
+
+    Slot result[32];
+    unsigned size = 0;
+    SmallVector<Slot, 8> slots;
+
+    for (uint32_t rest = bitmap; rest; rest &= rest - 1) {
+        uint32_t bit = rest & -rest;
+
+        slots.clear();
+        for (Node* node : distinct) {
+            if (node->bitmap & bit) slots.push_back(node->slots()[slotIndex(node->bitmap, bit)]);
+        }
+
+        bool same = true;
+        for (const Slot& s : slots) same &= sameSlot(s, slots[0]);
+
+        Slot s = same ? slots[0] : mergeSlots(slots, shift + BitsPerLevel, combine, arena);
+        if (mine && (mine->bitmap & bit) && !sameSlot(s, mine->slots()[slotIndex(mine->bitmap, bit)])) changed = true;
+        result[size++] = s;
+    }
+
+    if (!changed) return mine;
+
+    Node* out = makeNode(size, size, arena);
+    out->bitmap = bitmap;
+    std::memcpy(out->slots(), result, size * sizeof(Slot));
+    return out;
+}
+
+void ScopeMap::merge(ArrayRef<ScopeMap*> others, Combine combine, AnalysisArena& arena) {
+    SmallVector<Node*, 8> roots = {root};
+    for (ScopeMap* other : others) roots.push_back(other->root);
+
+    root = merge(roots, 0, combine, arena);
+
+    // the nodes of the others are now shared: no map may write them in place any more
+    token = newToken();
+    for (ScopeMap* other : others) other->freeze();
+}
+
+unsigned ScopeMap::getHeight(const Node* node) {
+    if (!node) return 0;
+
+    unsigned height = 0;
+    for (unsigned i = 0; i < node->size; ++i) {
+        const Slot& s = node->slots()[i];
+        if (!s.key) height = std::max(height, getHeight(s.child));
+    }
+    return height + 1;
+}
+
+unsigned ScopeMap::getHeight() const {
+    return getHeight(root);
+}
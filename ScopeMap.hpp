@@ -0,0 +1,133 @@
+#ifndef SCOPE_MAP_H
+#define SCOPE_MAP_H
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/STLFunctionalExtras.h"
+#include "llvm/IR/Value.h"
+
+#include <cstdint>
+
+using namespace llvm;
+
+struct Operand;
+class AnalysisArena;
+
+/**
+ * Persistent symbol table of a scope: IR value -> operand, as a hash array mapped trie (32 way nodes indexed by
+ * 5 bits of the hash of the key).
+ *
+ * Maps share their nodes: fork() is O(1), and a map only writes nodes it created after it was last frozen or merged.
+ * Every other node is copied on the path to the change (copy on write), so snapshots never see later edits.
+ * Forking only reads the frozen map, so maps of different threads can fork the same one (e.g. the global scope).
+ * Lookups visit at most 13 nodes (64 bits of hash), O(log32 n) whatever the nesting of the scopes.
+ * Nodes are allocated in an AnalysisArena and released with it: they must outlive every map using them.
+ */
+class ScopeMap {
+
+public:
+
+    /// @brief combines the different values bound to a key by the merged maps (this map first)
+    using Combine = function_ref<Operand*(ArrayRef<Operand*>)>;
+
+    ScopeMap();
+
+    ScopeMap(ScopeMap&&) = default;
+    ScopeMap& operator=(ScopeMap&&) = default;
+    ScopeMap(const ScopeMap&) = delete;
+    ScopeMap& operator=(const ScopeMap&) = delete;
+
+    /// @return operand bound to key, nullptr if missing
+    Operand* lookup(const Value* key) const;
+
+    /**
+     * Bind key to value, replacing the previous binding. New nodes are allocated in arena
+     */
+    void insert(const Value* key, Operand* value, AnalysisArena& arena);
+
+    /**
+     * Stop writing the current nodes in place, so that they can be shared by fork(). The next write takes a new token.
+     * Freezing a frozen map writes nothing
+     */
+    void freeze();
+
+    /**
+     * Snapshot sharing every node with this map, which must be frozen. Both maps copy on write from now on
+     */
+    ScopeMap fork() const;
+
+    /**
+     * Union with others, in a single pass over all the tries together (keys in hash order). Keys bound to
+     * different operands get combine(operands). Subtrees shared by all the maps are skipped, so only the paths
+     * to the keys that differ are visited and copied
+     */
+    void merge(ArrayRef<ScopeMap*> others, Combine combine, AnalysisArena& arena);
+
+    /// @return most nodes visited by a lookup (0 for an empty map)
+    unsigned getHeight() const;
+
+private:
+
+    struct Node;
+
+    /// @brief a binding, or a child node when key is nullptr
+    struct Slot {
+        const Value* key;
+        union {
+            Operand* value;
+            Node* child;
+        };
+    };
+
+    struct Node {
+        /// @brief token of the map allowed to write the node in place
+        uint64_t token;
+
+        /// @brief which of the 32 positions are used, the slots are packed in bit order
+        uint32_t bitmap;
+
+        uint8_t size;
+        uint8_t capacity;
+
+        Slot* slots() {
+            return reinterpret_cast<Slot*>(this + 1);
+        }
+
+        const Slot* slots() const {
+            return reinterpret_cast<const Slot*>(this + 1);
+        }
+    };
+
+    static Slot leaf(const Value* key, Operand* value);
+
+    static Slot child(Node* node);
+
+    static bool sameSlot(const Slot& a, const Slot& b);
+
+    Node* makeNode(unsigned size, unsigned capacity, AnalysisArena& arena);
+
+    /// @brief node itself if this map can write it and it has room for extra slots, otherwise a bigger copy
+    Node* editable(Node* node, unsigned extra, AnalysisArena& arena);
+
+    /// @brief node of the two bindings, whose hashes are equal below shift
+    Node* makePair(unsigned shift, Slot a, uint64_t hashA, Slot b, uint64_t hashB, AnalysisArena& arena);
+
+    Node* insert(Node* node, unsigned shift, uint64_t hash, const Value* key, Operand* value, AnalysisArena& arena);
+
+    /// @brief union of nodes at the same position of the tries (nullptr where a trie has none), nodes[0] is mine
+    Node* merge(ArrayRef<Node*> nodes, unsigned shift, Combine combine, AnalysisArena& arena);
+
+    /// @brief union of the slots at the same position of the nodes, whose children are at shift
+    Slot mergeSlots(ArrayRef<Slot> slots, unsigned shift, Combine combine, AnalysisArena& arena);
+
+    static Operand* lookup(const Node* node, unsigned shift, uint64_t hash, const Value* key);
+
+    static unsigned getHeight(const Node* node);
+
+    Node* root = nullptr;
+
+    /// @brief changed on every merge and on the first write after freeze(), 0 while frozen: the nodes created with
+    /// another token are shared
+    uint64_t token;
+};
+
+#endif
@@ -0,0 +1,74 @@
+#include "SummaryContextCache.hpp"
+
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/xxhash.h"
+
+#include <algorithm>
+#include <cmath>
+
+float SummaryContextCache::roundDown(float v) const {
+    if (!std::isfinite(v) || v == 0.0f) return v;
+
+    int exp;
+    float scale = std::ldexp(1.0f, mantissaBits);
+    float m = std::frexp(v, &exp);
+    return std::ldexp(std::floor(m * scale) / scale, exp);
+}
+
+float SummaryContextCache::roundUp(float v) const {
+    return -roundDown(-v);
+}
+
+SmallVector<Range, 4> SummaryContextCache::quantize(ArrayRef<Range> args) const {
+    SmallVector<Range, 4> result;
+    for (const Range& r : args) {
+        result.push_back(Range(roundDown(r.min), roundUp(r.max)));
+    }
+    return result;
+}
+
+SummaryContextCache::Key SummaryContextCache::makeKey(const FunctionSummary* summary, ArrayRef<Range> args) {
+    SmallVector<float, 8> bounds;
+    for (const Range& r : args) {
+        bounds.push_back(r.min);
+        bounds.push_back(r.max);
+    }
+    return Key(summary, xxHash64(StringRef(reinterpret_cast<const char*>(bounds.data()), bounds.size() * sizeof(float))));
+}
+
+bool SummaryContextCache::Entry::matches(ArrayRef<Range> other) const {
+    return std::equal(args.begin(), args.end(), other.begin(), other.end(),
+        [](const Range& a, const Range& b) { return a.min == b.min && a.max == b.max; });
+}
+
+std::optional<Range> SummaryContextCache::lookup(const FunctionSummary* summary, ArrayRef<Range> args) {
+    Key key = makeKey(summary, args);
+    std::lock_guard<std::mutex> guard(lock);
+
+    auto it = index.find(key);
+    if (it == index.end() || !it->second->matches(args)) {
+        ++misses;
+        return std::nullopt;
+    }
+
+    ++hits;
+    entries.splice(entries.begin(), entries, it->second);
+    return it->second->result;
+}
+
+void SummaryContextCache::insert(const FunctionSummary* summary, ArrayRef<Range> args, const Range& result) {
+    Key key = makeKey(summary, args);
+    std::lock_guard<std::mutex> guard(lock);
+
+    // computed meanwhile by another thread, or another context with the same hash: the first one stays
+    if (index.count(key)) return;
+
+    if (entries.size() >= capacity) {
+        index.erase(entries.back().key);
+        entries.pop_back();
+        ++evictions;
+    }
+
+    entries.push_front({key, SmallVector<Range, 4>(args.begin(), args.end()), result});
+    index[key] = entries.begin();
+}
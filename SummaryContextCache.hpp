@@ -0,0 +1,108 @@
+#ifndef SUMMARY_CONTEXT_CACHE_H
+#define SUMMARY_CONTEXT_CACHE_H
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallVector.h"
+
+#include <list>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "RangeHandler.hpp"
+
+using namespace llvm;
+
+class FunctionSummary;
+
+/**
+ * Bounded LRU memo of summary applications, keyed by (summary, quantized argument ranges).
+ * The index holds the summary and a hash of the ranges, the ranges themselves are compared on lookup only.
+ *
+ * Argument ranges are widened outward to a few mantissa bits before the lookup, so that nearby contexts share
+ * an entry; the summary is applied to the widened ranges, which keeps the stored RETURN range sound for
+ * every context of the bucket. Shared by the functions analyzed in parallel.
+ */
+class SummaryContextCache {
+
+public:
+
+    /**
+     * @param capacity       maximum number of entries, 0 disables the cache
+     * @param mantissaBits   mantissa bits kept by the quantization
+     */
+    SummaryContextCache(unsigned capacity, unsigned mantissaBits) : capacity(capacity), mantissaBits(mantissaBits) {}
+
+    bool isEnabled() const {
+        return capacity > 0;
+    }
+
+    /**
+     * Widen every range outward to the quantization grid
+     */
+    SmallVector<Range, 4> quantize(ArrayRef<Range> args) const;
+
+    /**
+     * RETURN range stored for summary applied to args (already quantized), counts a hit or a miss
+     */
+    std::optional<Range> lookup(const FunctionSummary* summary, ArrayRef<Range> args);
+
+    /**
+     * Store the RETURN range of summary applied to args (already quantized), evicting the least recently used entry if full
+     */
+    void insert(const FunctionSummary* summary, ArrayRef<Range> args, const Range& result);
+
+    unsigned getNumHits() const {
+        return hits;
+    }
+
+    unsigned getNumMisses() const {
+        return misses;
+    }
+
+    unsigned getNumEvictions() const {
+        return evictions;
+    }
+
+private:
+
+    /// @brief summary and hash of the quantized argument ranges
+    using Key = std::pair<const FunctionSummary*, uint64_t>;
+
+    static Key makeKey(const FunctionSummary* summary, ArrayRef<Range> args);
+
+    float roundDown(float v) const;
+
+    float roundUp(float v) const;
+
+    struct Entry {
+        Key key;
+
+        /// @brief ranges the key was made from, two contexts with the same hash are still different entries
+        SmallVector<Range, 4> args;
+
+        Range result;
+
+        bool matches(ArrayRef<Range> other) const;
+    };
+
+    unsigned capacity;
+
+    unsigned mantissaBits;
+
+    /**
+     * Entries from the most to the least recently used
+     */
+    std::list<Entry> entries;
+
+    DenseMap<Key, std::list<Entry>::iterator> index;
+
+    std::mutex lock;
+
+    unsigned hits = 0;
+    unsigned misses = 0;
+    unsigned evictions = 0;
+};
+
+#endif
@@ -1,22 +1,27 @@
 #include "Utils.hpp"
-#include <sstream>
-#include <iomanip>
+#include <charconv>
 #include <cmath>
 
 std::string Utils::formatFloatSmart(float val) {
-    std::ostringstream oss;
+    char buf[32];
+    return std::string(buf, formatFloatSmart(buf, buf + sizeof(buf), val));
+}
 
+char* Utils::formatFloatSmart(char* first, char* last, float val) {
+    // Evita notazione scientifica per valori "normali"
     if (std::abs(val) < 1e6 && std::abs(val) > 1e-4) {
         if (std::floor(val) == val) {
-            oss << static_cast<int>(val);
+            // Valore intero, stampa come intero
+            return std::to_chars(first, last, static_cast<int>(val)).ptr;
         } else if (std::abs(val) < 1.0f) {
-            oss << std::fixed << std::setprecision(4) << val;
+            // Valore piccolo, usa 4 decimali
+            return std::to_chars(first, last, val, std::chars_format::fixed, 4).ptr;
         } else {
-            oss << std::fixed << std::setprecision(2) << val;
+            // Valore normale, usa 2 decimali
+            return std::to_chars(first, last, val, std::chars_format::fixed, 2).ptr;
         }
-    } else {
-        oss << std::scientific << std::setprecision(2) << val;
     }
 
-    return oss.str();
+    // Valore molto grande o molto piccolo: usa notazione scientifica
+    return std::to_chars(first, last, val, std::chars_format::scientific, 2).ptr;
 }
@@ -6,6 +6,12 @@
 class Utils {
 public:
     static std::string formatFloatSmart(float val);
+
+    /**
+     * Same as above, written in [first, last) without allocating. Returns the end of the text.
+     * 32 chars are always enough
+     */
+    static char* formatFloatSmart(char* first, char* last, float val);
 };
 
-#endif // UTILS_HPP
\ No newline at end of file
+#endif // UTILS_HPP
@@ -0,0 +1,109 @@
+#include "VRAAnalysis.h"
+
+#include "llvm/IR/InstIterator.h"
+
+#include "Utils.hpp"
+
+namespace llvm
+{
+
+    AnalysisKey VRAGlobalAnalysis::Key;
+    AnalysisKey VRAFunctionAnalysis::Key;
+    AnalysisKey VRAModuleAnalysis::Key;
+    AnalysisKey VRALazyAnalysis::Key;
+
+    VRAGlobalResult VRAGlobalAnalysis::run(Module& M, ModuleAnalysisManager& MAM) {
+        auto context = std::make_shared<VRAPass>();
+        context->initialize(M);
+        return VRAGlobalResult(std::move(context));
+    }
+
+    bool VRAGlobalResult::invalidate(Module& M, const PreservedAnalyses& PA, ModuleAnalysisManager::Invalidator& Inv) {
+        auto PAC = PA.getChecker<VRAGlobalAnalysis>();
+        return !(PAC.preserved() || PAC.preservedSet<AllAnalysesOn<Module>>());
+    }
+
+    template<typename Inner>
+    std::shared_ptr<VRAPass> VRAGlobalAnalysis::getContext(Function& F, FunctionAnalysisManager& FAM) {
+        Module& M = *F.getParent();
+        auto& MAMProxy = FAM.getResult<ModuleAnalysisManagerFunctionProxy>(F);
+
+        if (VRAGlobalResult* globals = MAMProxy.getCachedResult<VRAGlobalAnalysis>(M)) {
+            MAMProxy.registerOuterAnalysisInvalidation<VRAGlobalAnalysis, Inner>();
+            return globals->getContext();
+        }
+
+        // a function pipeline cannot compute module analyses: require<vra-globals> before it avoids this
+        auto context = std::make_shared<VRAPass>();
+        context->initialize(M);
+        return context;
+    }
+
+    VRAFunctionResult VRAFunctionAnalysis::run(Function& F, FunctionAnalysisManager& FAM) {
+        std::shared_ptr<VRAPass> context = VRAGlobalAnalysis::getContext<VRAFunctionAnalysis>(F, FAM);
+
+        std::unique_ptr<FunctionAnalyzer> analyzer = context->analyzeFunction(F, FAM);
+        return VRAFunctionResult(std::move(context), std::move(analyzer));
+    }
+
+    Scope* VRAFunctionResult::getBlockScope(BasicBlock* BB) const {
+        Block* block = analyzer->getBlockByLLVMBasicBlock(BB);
+        return block ? block->getScope() : nullptr;
+    }
+
+    bool VRAFunctionResult::invalidate(Function& F, const PreservedAnalyses& PA, FunctionAnalysisManager::Invalidator& Inv) {
+        // the analyzer keeps pointers to the LLVM analyses it was built with
+        auto PAC = PA.getChecker<VRAFunctionAnalysis>();
+        return !(PAC.preserved() || PAC.preservedSet<AllAnalysesOn<Function>>()) ||
+               Inv.invalidate<DominatorTreeAnalysis>(F, PA) || Inv.invalidate<LoopAnalysis>(F, PA) ||
+               Inv.invalidate<ScalarEvolutionAnalysis>(F, PA);
+    }
+
+    VRALazyResult VRALazyAnalysis::run(Function& F, FunctionAnalysisManager& FAM) {
+        std::shared_ptr<VRAPass> context = VRAGlobalAnalysis::getContext<VRALazyAnalysis>(F, FAM);
+
+        auto query = std::make_unique<LazyRangeQuery>(F, context.get(),
+            FAM.getResult<DominatorTreeAnalysis>(F), FAM.getResult<ScalarEvolutionAnalysis>(F));
+        return VRALazyResult(std::move(context), std::move(query));
+    }
+
+    bool VRALazyResult::invalidate(Function& F, const PreservedAnalyses& PA, FunctionAnalysisManager::Invalidator& Inv) {
+        // the query keeps using the dominator tree and scalar evolution
+        auto PAC = PA.getChecker<VRALazyAnalysis>();
+        return !(PAC.preserved() || PAC.preservedSet<AllAnalysesOn<Function>>()) ||
+               Inv.invalidate<DominatorTreeAnalysis>(F, PA) || Inv.invalidate<ScalarEvolutionAnalysis>(F, PA);
+    }
+
+    PreservedAnalyses VRALazyPrinterPass::run(Function& F, FunctionAnalysisManager& FAM) {
+        VRALazyResult& lazy = FAM.getResult<VRALazyAnalysis>(F);
+
+        std::vector<Value*> values;
+        for (Argument& A : F.args()) values.push_back(&A);
+        for (Instruction& I : instructions(F)) {
+            if (I.getType()->isIntOrIntVectorTy() || I.getType()->isFPOrFPVectorTy()) values.push_back(&I);
+        }
+
+        std::vector<Range> ranges(values.size());
+        for (size_t i = values.size(); i-- > 0;) ranges[i] = lazy.getRange(values[i]);
+
+        OS << "Lazy ranges of " << F.getName() << ":\n";
+        for (size_t i = 0; i < values.size(); ++i) {
+            OS << "  ";
+            values[i]->printAsOperand(OS, false);
+            OS << ": [" << Utils::formatFloatSmart(ranges[i].min) << ", " << Utils::formatFloatSmart(ranges[i].max) << "]\n";
+        }
+        return PreservedAnalyses::all();
+    }
+
+    VRAModuleResult VRAModuleAnalysis::run(Module& M, ModuleAnalysisManager& MAM) {
+        auto engine = std::make_unique<VRAPass>();
+        engine->analyzeModule(M, MAM);
+        return VRAModuleResult(std::move(engine));
+    }
+
+    bool VRAModuleResult::invalidate(Module& M, const PreservedAnalyses& PA, ModuleAnalysisManager::Invalidator& Inv) {
+        auto PAC = PA.getChecker<VRAModuleAnalysis>();
+        return !(PAC.preserved() || PAC.preservedSet<AllAnalysesOn<Module>>());
+    }
+
+} // namespace llvm
@@ -0,0 +1,200 @@
+#ifndef VRA_ANALYSIS_H
+#define VRA_ANALYSIS_H
+
+#include "VRAPass.h"
+#include "LazyRangeQuery.hpp"
+
+namespace llvm {
+
+    /*
+     * Settings and global scope of a module, shared by the per function analyses so that the globals are
+     * analyzed once per module and not once per function
+     */
+    class VRAGlobalResult {
+    public:
+
+        explicit VRAGlobalResult(std::shared_ptr<VRAPass> context) : context(std::move(context)) {}
+
+        std::shared_ptr<VRAPass> getContext() const {
+            return context;
+        }
+
+        /// @brief Invalidated when any function or global of the module is changed
+        bool invalidate(Module& M, const PreservedAnalyses& PA, ModuleAnalysisManager::Invalidator& Inv);
+
+    private:
+
+        std::shared_ptr<VRAPass> context;
+    };
+
+    class VRAGlobalAnalysis : public AnalysisInfoMixin<VRAGlobalAnalysis> {
+        friend AnalysisInfoMixin<VRAGlobalAnalysis>;
+        static AnalysisKey Key;
+
+    public:
+
+        using Result = VRAGlobalResult;
+
+        Result run(Module& M, ModuleAnalysisManager& MAM);
+
+        /**
+         * Context of the module of F: the cached VRAGlobalAnalysis (whose invalidation then invalidates the
+         * analysis Inner of F), or one built for F alone when the module analysis has not been computed
+         */
+        template<typename Inner>
+        static std::shared_ptr<VRAPass> getContext(Function& F, FunctionAnalysisManager& FAM);
+    };
+
+    /*
+     * Ranges of a single function, owned by the result: they stay valid as long as the function manager caches it.
+     * The function is analyzed alone, so calls are unknown: use VRAModuleAnalysis for interprocedural ranges.
+     */
+    class VRAFunctionResult {
+    public:
+
+        VRAFunctionResult(std::shared_ptr<VRAPass> context, std::unique_ptr<FunctionAnalyzer> analyzer) :
+            context(std::move(context)), analyzer(std::move(analyzer)) {}
+
+        /// @brief Scope of the function (arguments and RETURN)
+        Scope* getScope() const {
+            return analyzer->getScope();
+        }
+
+        /// @brief Scope at the end of BB, nullptr if BB was not analyzed (unreachable)
+        Scope* getBlockScope(BasicBlock* BB) const;
+
+        /// @brief Invalidated when the function, or the dominator tree, loop info or scalar evolution kept by the
+        /// analyzer change
+        bool invalidate(Function& F, const PreservedAnalyses& PA, FunctionAnalysisManager::Invalidator& Inv);
+
+    private:
+
+        /// @brief Settings and global scope the function was analyzed with, must outlive the analyzer
+        std::shared_ptr<VRAPass> context;
+
+        std::unique_ptr<FunctionAnalyzer> analyzer;
+    };
+
+    class VRAFunctionAnalysis : public AnalysisInfoMixin<VRAFunctionAnalysis> {
+        friend AnalysisInfoMixin<VRAFunctionAnalysis>;
+        static AnalysisKey Key;
+
+    public:
+
+        using Result = VRAFunctionResult;
+
+        Result run(Function& F, FunctionAnalysisManager& FAM);
+    };
+
+    /*
+     * Demand driven ranges of the values of a function: nothing is computed until the first getRange
+     */
+    class VRALazyResult {
+    public:
+
+        VRALazyResult(std::shared_ptr<VRAPass> context, std::unique_ptr<LazyRangeQuery> query) :
+            context(std::move(context)), query(std::move(query)) {}
+
+        Range getRange(Value* V) {
+            return query->getRange(V);
+        }
+
+        Range getRangeAt(Value* V, BasicBlock* BB) {
+            return query->getRangeAt(V, BB);
+        }
+
+        /// @brief Invalidated when the function, its dominator tree or its scalar evolution change
+        bool invalidate(Function& F, const PreservedAnalyses& PA, FunctionAnalysisManager::Invalidator& Inv);
+
+    private:
+
+        /// @brief Global scope the ranges are computed with, must outlive the query
+        std::shared_ptr<VRAPass> context;
+
+        std::unique_ptr<LazyRangeQuery> query;
+    };
+
+    class VRALazyAnalysis : public AnalysisInfoMixin<VRALazyAnalysis> {
+        friend AnalysisInfoMixin<VRALazyAnalysis>;
+        static AnalysisKey Key;
+
+    public:
+
+        using Result = VRALazyResult;
+
+        Result run(Function& F, FunctionAnalysisManager& FAM);
+    };
+
+    /*
+     * Print the ranges of the arguments and instructions of a function given by VRALazyAnalysis (print<vra-lazy>).
+     * Values are queried from the last to the first, so that the first queries walk the longest slices
+     */
+    class VRALazyPrinterPass : public PassInfoMixin<VRALazyPrinterPass> {
+    public:
+
+        explicit VRALazyPrinterPass(raw_ostream& OS) : OS(OS) {}
+
+        PreservedAnalyses run(Function& F, FunctionAnalysisManager& FAM);
+
+    private:
+
+        raw_ostream& OS;
+    };
+
+    /*
+     * Ranges of every function of the module, computed bottom-up on the call graph
+     */
+    class VRAModuleResult {
+    public:
+
+        explicit VRAModuleResult(std::unique_ptr<VRAPass> engine) : engine(std::move(engine)) {}
+
+        /// @brief Scope of F (arguments and RETURN), nullptr if F is a declaration
+        Scope* getFunctionScope(const Function& F) const {
+            return engine->getFunctionScope(F.getName().str());
+        }
+
+        /// @brief Summary of F to apply to call site argument ranges, nullptr if F is a declaration
+        const FunctionSummary* getSummary(const Function& F) const {
+            return engine->getSummary(&F);
+        }
+
+        Scope* getGlobalScope() const {
+            return engine->getGlobalScope();
+        }
+
+        /// @brief Store the ranges in the module as metadata, returns the number of values annotated
+        unsigned writeMetadata() {
+            return engine->writeMetadata();
+        }
+
+        void writeReport(raw_ostream& OS, ReportWriter::Format format) const {
+            engine->writeReport(OS, format);
+        }
+
+        bool writeResults(StringRef path) const {
+            return engine->writeResults(path);
+        }
+
+        /// @brief Invalidated when any function or global of the module is changed
+        bool invalidate(Module& M, const PreservedAnalyses& PA, ModuleAnalysisManager::Invalidator& Inv);
+
+    private:
+
+        std::unique_ptr<VRAPass> engine;
+    };
+
+    class VRAModuleAnalysis : public AnalysisInfoMixin<VRAModuleAnalysis> {
+        friend AnalysisInfoMixin<VRAModuleAnalysis>;
+        static AnalysisKey Key;
+
+    public:
+
+        using Result = VRAModuleResult;
+
+        Result run(Module& M, ModuleAnalysisManager& MAM);
+    };
+
+} // namespace llvm
+
+#endif
@@ -1,46 +1,540 @@
+#include <llvm/ADT/DenseSet.h>
+#include <llvm/ADT/SCCIterator.h>
+#include <llvm/ADT/Statistic.h>
+#include <llvm/Analysis/CallGraph.h>
+#include <llvm/IR/InstIterator.h>
+#include <llvm/IR/ModuleSlotTracker.h>
 #include <llvm/Support/CommandLine.h>
 #include <llvm/Support/Debug.h>
+#include <llvm/Support/StringSaver.h>
+#include <llvm/Support/ThreadPool.h>
+#include <llvm/Support/TimeProfiler.h>
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/Support/xxhash.h>
 
 #include "VRAPass.h"
+#include "VRAAnalysis.h"
+#include "InstructionAnalyzer.hpp"
+#include "RangeMetadata.hpp"
+#include "ReportWriter.hpp"
+#include "ResultFile.hpp"
 
 #define DEBUG_TYPE "vra"
 
+STATISTIC(NumFunctionsFromCache, "Functions restored from the result cache");
+STATISTIC(NumCacheMisses, "Functions analyzed without an entry in the result cache");
+STATISTIC(NumCacheStale, "Functions with an entry in the result cache analyzed again after a callee");
+STATISTIC(NumSummaryContextHits, "Summary applications served by the context memo");
+
 namespace llvm
 {
 
+    /// Granularity of the time trace recorded by the worker threads, the one of -time-trace-granularity is not visible
+    static constexpr unsigned TimeTraceGranularity = 500;
+
+    static cl::opt<unsigned> VRAThreads("vra-threads",
+        cl::desc("Number of functions analyzed in parallel by VRA (1 = serial)"),
+        cl::init(1));
+
+    static cl::opt<bool> VRAScevRanges("vra-scev-ranges",
+        cl::desc("Take the range of loop induction variables from scalar evolution instead of approximating it by iterations"),
+        cl::init(false));
+
+    static cl::opt<bool> VRALoopFixpoint("vra-loop-fixpoint",
+        cl::desc("Solve loop headers with widening and narrowing instead of approximating loops by iterations"),
+        cl::init(false));
+
+    static cl::opt<unsigned> VRAWideningDelay("vra-widening-delay",
+        cl::desc("Updates of a loop header before widening is applied"),
+        cl::init(2));
+
+    static cl::opt<unsigned> VRANarrowingPasses("vra-narrowing-passes",
+        cl::desc("Narrowing passes done on each loop after the widened fixpoint"),
+        cl::init(2));
+
+    static cl::list<float> VRAWideningThresholds("vra-widening-thresholds",
+        cl::desc("Additional values where widening stops (loop bound constants and type limits are always used)"),
+        cl::CommaSeparated);
+
+    static cl::opt<std::string> VRACache("vra-cache",
+        cl::desc("File where function results are cached across runs, keyed by function structure and analysis inputs"),
+        cl::value_desc("filename"), cl::init(""));
+
+    static cl::opt<unsigned> VRAContextCacheSize("vra-context-cache-size",
+        cl::desc("Entries of the LRU memo of summaries applied to call site argument ranges (0 = disabled)"),
+        cl::init(4096));
+
+    static cl::opt<unsigned> VRAContextMantissaBits("vra-context-mantissa-bits",
+        cl::desc("Mantissa bits kept when argument ranges are quantized for the summary memo"),
+        cl::init(12));
+
+    static cl::opt<bool> VRAWriteMetadata("vra-write-metadata",
+        cl::desc("Attach the computed ranges to instructions, arguments and globals as !taffo.range metadata"),
+        cl::init(false));
+
+    static cl::opt<std::string> VRAResults("vra-results",
+        cl::desc("Binary file where the ranges of the module are written, to be read with ResultFile"),
+        cl::value_desc("filename"), cl::init(""));
+
+    static cl::opt<std::string> VRAReport("vra-report",
+        cl::desc("File where the ranges of every scope of the module are written ('-' for stdout)"),
+        cl::value_desc("filename"), cl::init(""));
+
+    static cl::opt<ReportWriter::Format> VRAReportFormat("vra-report-format",
+        cl::desc("Format of -vra-report"),
+        cl::values(clEnumValN(ReportWriter::Format::JsonLines, "jsonl", "one JSON object per line"),
+                   clEnumValN(ReportWriter::Format::Yaml, "yaml", "one YAML sequence item per record")),
+        cl::init(ReportWriter::Format::JsonLines));
+
     PreservedAnalyses VRAPass::run(llvm::Module& M, ModuleAnalysisManager& AM) {
+        // results are owned and cached by the module analysis, later passes query it without recomputing
+        VRAModuleResult& result = AM.getResult<VRAModuleAnalysis>(M);
+
+        if (!VRAResults.empty() && !result.writeResults(VRAResults)) {
+            errs() << DEBUG_HEAD << " cannot write results file " << VRAResults << "\n";
+        }
+
+        if (!VRAReport.empty()) {
+            std::error_code EC;
+            raw_fd_ostream out(VRAReport, EC);
+            if (EC) {
+                errs() << DEBUG_HEAD << " cannot write report " << VRAReport << ": " << EC.message() << "\n";
+            } else {
+                out.SetBufferSize(1 << 16);
+                result.writeReport(out, VRAReportFormat);
+            }
+        }
+
+        if (!VRAWriteMetadata || !result.writeMetadata()) return PreservedAnalyses::all();
+
+        // only metadata changed: the CFG and the ranges still hold
+        PreservedAnalyses PA;
+        PA.preserveSet<CFGAnalyses>();
+        PA.preserve<VRAModuleAnalysis>();
+        return PA;
+    }
+
+    void VRAPass::initialize(Module& M) {
         this->M = &M;
-        MAM = &AM;
+
+        fixpointConfig.enabled = VRALoopFixpoint;
+        fixpointConfig.wideningDelay = VRAWideningDelay;
+        fixpointConfig.narrowingPasses = VRANarrowingPasses;
+        fixpointConfig.thresholds.assign(VRAWideningThresholds.begin(), VRAWideningThresholds.end());
 
         // forse un super global scope
         setGlobalScope();
+    }
 
+    void VRAPass::analyzeModule(Module& M, ModuleAnalysisManager& AM) {
+        MAM = &AM;
+        initialize(M);
         processModule();
+    }
 
-        return PreservedAnalyses::all();
+    std::unique_ptr<FunctionAnalyzer> VRAPass::analyzeFunction(Function& F, FunctionAnalysisManager& FAM) {
+        auto FAN = std::make_unique<FunctionAnalyzer>(&F, this, FAM);
+        FAN->precomputeLoopIterBounds();
+        if (VRAScevRanges) FAN->precomputeInductionRanges();
+        if (fixpointConfig.enabled || VRAScevRanges) FAN->precomputeHeaderRanges();
+        FAN->analyze();
+        return FAN;
     }
 
     void VRAPass::processModule() {
-        bool FoundVisitableFunction = false;
+        TimeTraceScope timeScope("VRAModule", M->getName());
+
+        functionAnalyzers.clear();
+        analyzers.clear();
+        summaries.clear();
+        cachedCallBindings.clear();
+        cachedScopes.clear();
+        cachedBlockScopes.clear();
+        contextCache = std::make_unique<SummaryContextCache>(VRAContextCacheSize, std::min(23u, unsigned(VRAContextMantissaBits)));
+
+        resultCache.reset();
+        if (!VRACache.empty()) {
+            resultCache = std::make_unique<ResultCache>(VRACache);
+            cacheArena = std::make_unique<AnalysisArena>();
+        }
+        uint64_t inputsHash = resultCache ? hashAnalysisInputs() : 0;
+
+        // bottom-up order of the call graph: callees before callers, mutually recursive functions together.
+        // The level of an SCC is the longest chain of calls below it, SCCs of the same level are independent
+        CallGraph CG(*M);
+        std::vector<std::vector<Function*>> sccs;
+        std::vector<unsigned> sccLevels;
+        DenseMap<const Function*, unsigned> levels;
+        DenseMap<const Function*, uint64_t> keys;
+        DenseMap<const Function*, SmallVector<const Function*, 4>> callees;
+        unsigned numLevels = 0;
+
+        for (auto I = scc_begin(&CG); !I.isAtEnd(); ++I) {
+            std::vector<Function*> scc;
+            for (CallGraphNode* N : *I) {
+                Function* F = N->getFunction();
+                if (F && !F->empty()) scc.push_back(F);
+            }
+            if (scc.empty()) continue;
+
+            unsigned level = 0;
+            SmallVector<uint64_t, 4> hashes;
+            SmallVector<uint64_t, 8> keyParts = {inputsHash};
+            for (Function* F : scc) {
+                if (resultCache) {
+                    hashes.push_back(ResultCache::hashFunction(*F));
+                    keyParts.push_back(hashes.back());
+                }
+
+                for (const CallGraphNode::CallRecord& call : *CG[F]) {
+                    const Function* callee = call.second->getFunction();
+                    auto it = levels.find(callee);
+                    if (it == levels.end()) continue;   // declaration or same SCC
+
+                    level = std::max(level, it->second + 1);
+                    // results depend on the summaries of the callees, so do the cache keys
+                    if (resultCache) {
+                        keyParts.push_back(keys.lookup(callee));
+                        callees[F].push_back(callee);
+                    }
+                }
+            }
+
+            uint64_t sccKey = ResultCache::combine(keyParts);
+            for (size_t i = 0; i < scc.size(); ++i) {
+                levels[scc[i]] = level;
+                if (resultCache) keys[scc[i]] = ResultCache::combine({hashes[i], sccKey});
+            }
+            sccs.push_back(std::move(scc));
+            sccLevels.push_back(level);
+            numLevels = std::max(numLevels, level + 1);
+        }
+
+        // bottom-up: a function is restored from the cache with its scopes and its summary, which its callers
+        // apply, so only when all its callees were restored too (an analyzed one may no longer match the cache)
+        DenseSet<const Function*> fromCache;
+        DenseSet<const Function*> unreadable;
+        if (resultCache) {
+            auto findCallee = [this](StringRef name) -> const FunctionSummary* {
+                const Function* callee = M->getFunction(name);
+                return callee ? getSummary(callee) : nullptr;
+            };
+
+            for (const std::vector<Function*>& scc : sccs) {
+                bool restore = llvm::all_of(scc, [&](const Function* F) {
+                    return resultCache->contains(keys.lookup(F)) && llvm::all_of(callees.lookup(F),
+                        [&](const Function* callee) { return fromCache.count(callee); });
+                });
+                if (!restore) continue;
+
+                std::vector<CachedFunction> cached;
+                for (Function* F : scc) {
+                    cached.push_back(*resultCache->lookup(keys.lookup(F)));
+                    if (cached.back().scopes.empty()) {
+                        unreadable.insert(F);
+                        break;
+                    }
+                }
+                if (cached.back().scopes.empty()) continue;
+
+                // hit: no analysis at all, not even the LLVM ones
+                for (size_t i = 0; i < scc.size(); ++i) {
+                    Function& F = *scc[i];
+                    Scope* fscope = ResultCache::restore(F, cached[i], getGlobalScope(), *cacheArena, cachedScopes, cachedBlockScopes);
+                    // callees in the same SCC come first, as when they were analyzed
+                    summaries[&F] = FunctionSummary::rebuild(F, cached[i].summary, findCallee, *cacheArena,
+                                                             cachedCallBindings, contextCache.get());
+                    emplaceFunctionScope(F.getName().str(), fscope);
+                    fromCache.insert(&F);
+                    resultCache->noteHit();
+                    ++NumFunctionsFromCache;
+                }
+            }
+        }
+
+        FunctionAnalysisManager& FAM = MAM->getResult<FunctionAnalysisManagerModuleProxy>(*M).getManager();
+
+        // LLVM analyses (DT, LoopInfo, SE) are not thread safe: get them serially for every function
         for (Function& F : M->functions()) {
             // if (!F.empty() && (PropagateAll || TaffoInfo::getInstance().isStartingPoint(F))) {
+            if (F.empty() || fromCache.count(&F)) continue;
 
-                FunctionAnalyzer FAN = FunctionAnalyzer(&F, this);
+            // every slot exists before the analysis starts: functions analyzed in parallel only fill their own
+            summaries[&F] = nullptr;
 
-                FAN.analyze();
-                emplaceFunctionScope(FAN.getName(), FAN.getScope());
+            if (resultCache) {
+                // only misses make the cache be written back: a stale entry is computed again the same
+                if (!resultCache->contains(keys.lookup(&F)) || unreadable.count(&F)) {
+                    resultCache->noteMiss();
+                    ++NumCacheMisses;
+                } else {
+                    resultCache->noteStale();
+                    ++NumCacheStale;
+                }
+            }
 
-                FoundVisitableFunction = true;
-            // }
+            auto FAN = std::make_unique<FunctionAnalyzer>(&F, this, FAM);
+            FAN->precomputeLoopIterBounds();
+            if (VRAScevRanges) FAN->precomputeInductionRanges();
+            if (fixpointConfig.enabled || VRAScevRanges) FAN->precomputeHeaderRanges();
+            analyzers[&F] = FAN.get();
+            functionAnalyzers.push_back(std::move(FAN));
         }
 
-        if (!FoundVisitableFunction)
+        if (functionAnalyzers.empty() && cachedScopes.empty()) {
             LLVM_DEBUG(dbgs() << DEBUG_HEAD << " No visitable functions found.\n");
+            return;
+        }
+
+        // one task per SCC, grouped by level
+        std::vector<std::vector<std::vector<FunctionAnalyzer*>>> tasks(numLevels);
+        for (size_t i = 0; i < sccs.size(); ++i) {
+            std::vector<FunctionAnalyzer*> task;
+            for (Function* F : sccs[i]) {
+                if (FunctionAnalyzer* fn = analyzers.lookup(F)) task.push_back(fn);
+            }
+            if (!task.empty()) tasks[sccLevels[i]].push_back(std::move(task));
+        }
+
+        auto analyzeSCC = [this](const std::vector<FunctionAnalyzer*>& scc) {
+            // inside an SCC, calls to functions not summarized yet are unknown
+            for (FunctionAnalyzer* fn : scc) {
+                fn->analyze();
+                summaries.find(fn->getFunction())->second =
+                    std::make_unique<FunctionSummary>(fn->getReturnOperand(), contextCache.get());
+            }
+        };
+
+        // a level only reads the summaries of the previous ones (and the global scope)
+        if (VRAThreads > 1) {
+            bool trace = timeTraceProfilerEnabled();
+            ThreadPool pool(hardware_concurrency(VRAThreads));
+            for (auto& level : tasks) {
+                for (auto& scc : level) {
+                    pool.async([&analyzeSCC, &scc, trace]() {
+                        // the profiler is per thread: each task records its own events, merged on finish
+                        if (trace) timeTraceProfilerInitialize(TimeTraceGranularity, "vra");
+                        analyzeSCC(scc);
+                        if (trace) timeTraceProfilerFinishThread();
+                    });
+                }
+                pool.wait();
+            }
+        } else {
+            for (auto& level : tasks) {
+                for (auto& scc : level) {
+                    analyzeSCC(scc);
+                }
+            }
+        }
+
+        // gather the results in module order, whatever the scheduling was
+        for (auto& FAN : functionAnalyzers) {
+            emplaceFunctionScope(FAN->getName(), FAN->getScope());
+        }
+
+        NumSummaryContextHits += contextCache->getNumHits();
+        LLVM_DEBUG(dbgs() << DEBUG_HEAD << " summary contexts: " << contextCache->getNumHits() << " hits, "
+                          << contextCache->getNumMisses() << " misses, " << contextCache->getNumEvictions() << " evictions\n");
+
+        if (resultCache) {
+            // calls are stored by callee name
+            DenseMap<const FunctionSummary*, const Function*> summaryOwners;
+            for (auto& [F, summary] : summaries) {
+                if (summary) summaryOwners[summary.get()] = F;
+            }
+            auto calleeName = [&summaryOwners](const FunctionSummary* summary) {
+                const Function* callee = summaryOwners.lookup(summary);
+                return callee ? callee->getName().str() : std::string();
+            };
+            auto blockScope = [this](const BasicBlock& BB) -> const Scope* { return getBlockScope(&BB); };
+
+            for (auto& FAN : functionAnalyzers) {
+                const Function& F = *FAN->getFunction();
+                resultCache->insert(keys.lookup(&F), ResultCache::capture(F, *FAN->getScope(), blockScope,
+                                                                          getSummary(&F)->flatten(calleeName)));
+            }
+
+            LLVM_DEBUG(dbgs() << DEBUG_HEAD << " cache: " << resultCache->getNumHits() << " hits, "
+                              << resultCache->getNumMisses() << " misses, "
+                              << resultCache->getNumStale() << " analyzed again after a callee\n");
+
+            if (resultCache->getNumMisses() && !resultCache->save()) {
+                errs() << DEBUG_HEAD << " cannot write cache file " << VRACache << "\n";
+            }
+        }
+    }
+
+    /**
+     * Add the resolved ranges of the operands of scope (not of its parents) to ranges
+     */
+    static void collectRanges(const Scope* scope, DenseMap<const Value*, Range>& ranges) {
+        if (!scope) return;
+
+        // a value can be seen by more than one block (e.g. loop header and latch): keep what holds in all
+        auto add = [&ranges](const Value* value, const Operand* op) {
+            if (!value || !op->range) return;
+            auto res = ranges.try_emplace(value, *op->range);
+            if (!res.second) res.first->second = RangeHandler::Merge(res.first->second, *op->range);
+        };
+
+        for (const Operand* op : scope->getOperands()) add(op->value, op);
+        for (const auto& [value, op] : scope->getAliases()) add(value, op);
+    }
+
+    void VRAPass::collectFunctionRanges(const Function& F, DenseMap<const Value*, Range>& ranges) const {
+        collectRanges(getFunctionScope(F.getName().str()), ranges);
+
+        for (const BasicBlock& BB : F) collectRanges(getBlockScope(&BB), ranges);
+    }
+
+    unsigned VRAPass::writeMetadata() {
+        DenseMap<const Value*, Range> ranges;
+
+        collectRanges(globalScope.get(), ranges);
+        for (Function& F : M->functions()) {
+            collectFunctionRanges(F, ranges);
+        }
+
+        // unbounded ranges say nothing, a missing one means the same
+        auto lookup = [&ranges](const Value* V) -> const Range* {
+            auto it = ranges.find(V);
+            if (it == ranges.end() || (it->second.min == NEG_INF && it->second.max == POS_INF)) return nullptr;
+            return &it->second;
+        };
+
+        // module order, so that the output does not depend on the map
+        unsigned annotated = 0;
+        for (GlobalVariable& gv : M->globals()) {
+            if (const Range* r = lookup(&gv)) {
+                RangeMetadata::set(&gv, *r);
+                ++annotated;
+            }
+        }
+
+        for (Function& F : M->functions()) {
+            SmallVector<std::optional<Range>, 8> args;
+            bool anyArg = false;
+            for (Argument& A : F.args()) {
+                const Range* r = lookup(&A);
+                args.push_back(r ? std::optional<Range>(*r) : std::nullopt);
+                anyArg |= r != nullptr;
+            }
+            if (anyArg) {
+                RangeMetadata::setArguments(&F, args);
+                annotated += llvm::count_if(args, [](const std::optional<Range>& r) { return r.has_value(); });
+            }
+
+            for (Instruction& I : instructions(F)) {
+                if (const Range* r = lookup(&I)) {
+                    RangeMetadata::set(&I, *r);
+                    ++annotated;
+                }
+            }
+        }
+
+        LLVM_DEBUG(dbgs() << DEBUG_HEAD << " ranges written as metadata: " << annotated << "\n");
+        return annotated;
+    }
+
+    void VRAPass::writeReport(raw_ostream& OS, ReportWriter::Format format) {
+        ReportWriter(OS, format).writeModule(*M, *this);
+    }
+
+    bool VRAPass::writeResults(StringRef path) const {
+        ResultFileWriter writer;
+        std::vector<ResultFileWriter::Entry> values;
+
+        // unnamed values are named by their slot, as in the report: the names must live until write()
+        ModuleSlotTracker MST(M);
+        BumpPtrAllocator nameAllocator;
+        StringSaver names(nameAllocator);
+        SmallString<32> buffer;
+        auto nameOf = [&](const Value* V) {
+            return V->hasName() ? V->getName() : names.save(ReportWriter::getValueName(*V, &MST, buffer));
+        };
+
+        // globals are the function with no name, numbered in module order
+        uint32_t id = 0;
+        for (GlobalVariable& gv : M->globals()) {
+            if (Operand* op = globalScope->lookup(&gv)) values.push_back({id, nameOf(&gv), op->range});
+            ++id;
+        }
+        writer.addFunction("", values);
+
+        for (Function& F : M->functions()) {
+            Scope* fscope = getFunctionScope(F.getName().str());
+            if (!fscope) continue;
+
+            DenseMap<const Value*, Range> ranges;
+            collectFunctionRanges(F, ranges);
+            MST.incorporateFunction(F);
+
+            values.clear();
+            id = 0;
+            for (const Value* V : ResultCache::numberValues(F)) {
+                auto it = ranges.find(V);
+                if (it != ranges.end()) values.push_back({id, nameOf(V), it->second});
+                ++id;
+            }
+            // RETURN and the other operands without IR value
+            for (const Operand* op : fscope->getOperands()) {
+                if (!op->value) values.push_back({ResultFileWriter::NoValue, op->name, op->range});
+            }
+            writer.addFunction(F.getName(), values);
+        }
+
+        return writer.write(path);
+    }
+
+    FunctionAnalyzer* VRAPass::getFunctionAnalyzer(const Function* F) const {
+        return analyzers.lookup(F);
+    }
+
+    Scope* VRAPass::getBlockScope(const BasicBlock* BB) const {
+        if (FunctionAnalyzer* FAN = getFunctionAnalyzer(BB->getParent())) {
+            Block* block = FAN->getBlockByLLVMBasicBlock(const_cast<BasicBlock*>(BB));
+            return block ? block->getScope() : nullptr;
+        }
+        return cachedBlockScopes.lookup(BB);
+    }
+
+    const FunctionSummary* VRAPass::getSummary(const Function* F) const {
+        auto it = summaries.find(F);
+        return it == summaries.end() ? nullptr : it->second.get();
+    }
+
+    uint64_t VRAPass::hashAnalysisInputs() const {
+        SmallString<256> bytes;
+        raw_svector_ostream os(bytes);
+
+        auto raw = [&os](const auto& v) { os.write(reinterpret_cast<const char*>(&v), sizeof(v)); };
+
+        // options changing the results
+        raw(static_cast<bool>(VRAScevRanges));
+        raw(fixpointConfig.enabled);
+        raw(fixpointConfig.wideningDelay);
+        raw(fixpointConfig.narrowingPasses);
+        for (float t : fixpointConfig.thresholds) raw(t);
+        // the context memo applies the summaries to quantized argument ranges
+        raw(unsigned(VRAContextCacheSize));
+        raw(std::min(23u, unsigned(VRAContextMantissaBits)));
+
+        // globals are the only inputs shared by all the functions
+        for (const Operand* op : globalScope->getOperands()) {
+            os << op->name << '\0';
+            Range r = op->getRange();
+            raw(r.min);
+            raw(r.max);
+        }
+
+        return xxHash64(bytes);
     }
 
     void VRAPass::setGlobalScope() {
 
-        auto global = std::make_unique<Scope>(nullptr);
+        globalArena = std::make_unique<AnalysisArena>();
+        auto global = std::make_unique<Scope>(nullptr, *globalArena);
 
         for (auto& gv : M->globals()) {
             std::string name = gv.getName().str();
@@ -55,14 +549,11 @@ namespace llvm
             if (auto* cInt = llvm::dyn_cast<llvm::ConstantInt>(initializer)) {
                 float val = static_cast<float>(cInt->getSExtValue());
 
-                auto op = std::make_unique<Operand>(name, Range(val, val, true), VarType::Local);
-
-                global->addOperand(std::move(op));
+                global->addOperand(globalArena->makeOperand(name, Range(val, val, true), VarType::Local, &gv));
 
             } else if (auto* cFP = llvm::dyn_cast<llvm::ConstantFP>(initializer)) {
-                float val = cFP->getValueAPF().convertToFloat();
-                auto op = std::make_unique<Operand>(name, Range(val, val, true), VarType::Local);
-                global->addOperand(std::move(op));
+                float val = InstructionAnalyzer::getConstRange(cFP)->min;
+                global->addOperand(globalArena->makeOperand(name, Range(val, val, true), VarType::Local, &gv));
 
             } else {
                 // TODO: Gestisci altri tipi se servono (array, struct...)
@@ -70,6 +561,8 @@ namespace llvm
 
         }
 
+        // the function scopes of the threads fork it: from now on they only read it
+        global->freeze();
         globalScope = std::move(global);
     }
     
@@ -2,6 +2,8 @@
 #define PASS_VRA_H
 
 #include "FunctionAnalyzer.hpp"
+#include "ResultCache.hpp"
+#include "ReportWriter.hpp"
 
 #define DEBUG_HEAD "[TAFFO][VRA]"
 
@@ -13,16 +15,70 @@ namespace llvm {
     class VRAPass : public PassInfoMixin<VRAPass> {
     public:
 
+        /**
+         * Compute (or reuse) the cached VRAModuleAnalysis of M
+         */
         PreservedAnalyses run(Module& M, ModuleAnalysisManager& AM);
 
+        /**
+         * Analyze every function of M, callees before callers. The results are owned by this object
+         */
+        void analyzeModule(Module& M, ModuleAnalysisManager& AM);
+
+        /**
+         * Settings and global scope of M, enough to analyze single functions with analyzeFunction
+         */
+        void initialize(Module& M);
+
+        /**
+         * Analyze F alone (calls are unknown), after initialize
+         */
+        std::unique_ptr<FunctionAnalyzer> analyzeFunction(Function& F, FunctionAnalysisManager& FAM);
+
         void emplaceFunctionScope(const std::string& fname, Scope* fscope);
 
         Scope* getFunctionScope(const std::string& fname) const;
 
         Scope* getGlobalScope();
 
+        /**
+         * Analyzer of F with its block scopes, nullptr if F is a declaration or was restored from the cache
+         */
+        FunctionAnalyzer* getFunctionAnalyzer(const Function* F) const;
+
+        /**
+         * Scope of BB, analyzed or restored from the cache. nullptr if its function has not been analyzed
+         */
+        Scope* getBlockScope(const BasicBlock* BB) const;
+
+        /**
+         * Summary of F, nullptr if F is a declaration or has not been analyzed yet
+         */
+        const FunctionSummary* getSummary(const Function* F) const;
+
+        /**
+         * Attach the ranges computed by analyzeModule to the values of the module (see RangeMetadata).
+         * Returns the number of values annotated
+         */
+        unsigned writeMetadata();
+
+        /**
+         * Stream the scopes computed by analyzeModule to OS (see ReportWriter)
+         */
+        void writeReport(raw_ostream& OS, ReportWriter::Format format);
+
+        /**
+         * Write the ranges computed by analyzeModule to a binary file at path (see ResultFile)
+         * @return false if the file cannot be written
+         */
+        bool writeResults(StringRef path) const;
+
         ModuleAnalysisManager* getMAM();
 
+        const FixpointConfig& getFixpointConfig() const {
+            return fixpointConfig;
+        }
+
     protected:
 
     
@@ -30,20 +86,64 @@ namespace llvm {
 
         void processModule();
 
+        /**
+         * Hash of what the analysis of a function depends on besides the function itself:
+         * global scope ranges and analysis options
+         */
+        uint64_t hashAnalysisInputs() const;
+
+        /**
+         * Resolved ranges of the values of F, merged over the function scope and all the block scopes
+         */
+        void collectFunctionRanges(const Function& F, DenseMap<const Value*, Range>& ranges) const;
+
     private:
         
 
+        /// @brief Owner of the global variable operands
+        std::unique_ptr<AnalysisArena> globalArena;
+
         /// @brief Scope for global variables
         std::unique_ptr<Scope> globalScope;
 
         /// @brief Scope for each function computed by VRA
         std::unordered_map<std::string, Scope*> functionScopes;
 
+        /// @brief Analyzers of the module functions, owners of the scopes in functionScopes
+        std::vector<std::unique_ptr<FunctionAnalyzer>> functionAnalyzers;
+
+        /// @brief Index of functionAnalyzers by function
+        DenseMap<const Function*, FunctionAnalyzer*> analyzers;
+
+        /// @brief Summary of each defined function, filled in bottom-up call graph order
+        DenseMap<const Function*, std::unique_ptr<FunctionSummary>> summaries;
+
+        /// @brief Memo of summaries applied to call site contexts, shared by all the summaries
+        std::unique_ptr<SummaryContextCache> contextCache;
+
+        /// @brief Results of previous runs, null when the cache is disabled
+        std::unique_ptr<ResultCache> resultCache;
+
+        /// @brief Owner of the operands of the scopes and summaries rehydrated from the cache
+        std::unique_ptr<AnalysisArena> cacheArena;
+
+        /// @brief Function and block scopes rehydrated from the cache
+        std::vector<std::unique_ptr<Scope>> cachedScopes;
+
+        /// @brief Index of the block scopes in cachedScopes
+        DenseMap<const BasicBlock*, Scope*> cachedBlockScopes;
+
+        /// @brief Calls of the summaries rebuilt from the cache
+        std::deque<CallBinding> cachedCallBindings;
+
         /// Module of this pass
         Module* M;
 
         /// @brief Global module analysis manager
         ModuleAnalysisManager* MAM;
+
+        /// @brief Loop fixpoint settings shared by all the functions
+        FixpointConfig fixpointConfig;
         
     };
     
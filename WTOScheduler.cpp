@@ -0,0 +1,38 @@
+#include "WTOScheduler.hpp"
+
+#include "llvm/ADT/PostOrderIterator.h"
+
+WTOScheduler::WTOScheduler(Function& F, LoopInfo& LI) : LI(LI) {
+    // group the blocks by innermost loop, keeping reverse post order inside each group
+    ReversePostOrderTraversal<Function*> RPOT(&F);
+    for (BasicBlock* BB : RPOT) {
+        Loop* L = LI.getLoopFor(BB);
+
+        // a header represents its loop in the region of the parent loop
+        if (L && L->getHeader() == BB) {
+            regionBlocks[L->getParentLoop()].push_back(BB);
+        }
+        regionBlocks[L].push_back(BB);
+    }
+
+    steps.reserve(F.size() + LI.getLoopsInPreorder().size());
+    emitRegion(nullptr);
+}
+
+void WTOScheduler::emitRegion(Loop* L) {
+    auto it = regionBlocks.find(L);
+    if (it == regionBlocks.end()) return;
+
+    for (BasicBlock* BB : it->second) {
+        Loop* inner = LI.getLoopFor(BB);
+
+        // header of a nested loop: emit the whole loop here, so that its blocks stay contiguous
+        if (inner != L && inner->getHeader() == BB) {
+            emitRegion(inner);
+            steps.push_back({Step::CloseLoop, BB});
+            continue;
+        }
+
+        steps.push_back({Step::Visit, BB});
+    }
+}
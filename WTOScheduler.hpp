@@ -0,0 +1,56 @@
+#ifndef WTO_SCHEDULER_H
+#define WTO_SCHEDULER_H
+
+#include "llvm/IR/Function.h"
+#include "llvm/Analysis/LoopInfo.h"
+
+#include <vector>
+
+using namespace llvm;
+
+/**
+ * Weak topological ordering of the blocks of a function (Bourdoncle), computed from reverse post order
+ * and the loop nest: every block comes after its predecessors (back edges excluded), and the blocks of a
+ * loop are contiguous, starting with the header. The analyzer follows it once, without revisits.
+ */
+class WTOScheduler {
+
+public:
+
+    struct Step {
+        enum Kind {
+            Visit,      // analyze bb
+            CloseLoop   // all blocks of the loop headed by bb are analyzed: solve the header
+        };
+
+        Kind kind;
+        BasicBlock* bb;
+    };
+
+    /**
+     * Compute the order of F. Blocks unreachable from the entry are not scheduled
+     */
+    WTOScheduler(Function& F, LoopInfo& LI);
+
+    const std::vector<Step>& getSteps() const {
+        return steps;
+    }
+
+private:
+
+    /**
+     * Append the steps of loop L (or of the whole function if L is null), nested loops included
+     */
+    void emitRegion(Loop* L);
+
+    LoopInfo& LI;
+
+    /**
+     * Blocks of each loop in reverse post order. The header of a nested loop stands for the whole loop
+     */
+    DenseMap<const Loop*, std::vector<BasicBlock*>> regionBlocks;
+
+    std::vector<Step> steps;
+};
+
+#endif
@@ -0,0 +1,342 @@
+/**
+ * In process benchmark of VRA over a corpus of IR files (bench/corpus).
+ *
+ * For every input: best time of the whole module analysis (LLVM analyses included, as in a real run),
+ * blocks per second, peak RSS of the process, memory retained by the results, operands created (nodes of the
+ * range graphs), and the best time of each function analyzed alone (LLVM analyses already cached). The cost of Scope::lookup is measured on the final
+ * scopes, with the most nodes a lookup can visit: both should stay flat as inputs grow (see bench/scaling.sh).
+ * The results can be written as a JSON baseline and compared with a previous one.
+ *
+ * usage: vra-bench [-repeat=N] [-baseline-out=file] [-compare=file [-tolerance=0.1]] [-vra-...] inputs...
+ */
+
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Module.h"
+#include "llvm/IRReader/IRReader.h"
+#include "llvm/Passes/PassBuilder.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/InitLLVM.h"
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/Process.h"
+#include "llvm/Support/SourceMgr.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <sys/resource.h>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "BlockClass.hpp"
+#include "FunctionAnalyzer.hpp"
+#include "VRAPass.h"
+
+using namespace llvm;
+
+static cl::list<std::string> Inputs(cl::Positional, cl::desc("<IR files>"), cl::OneOrMore);
+
+static cl::opt<unsigned> Repeat("repeat",
+    cl::desc("Runs of each measure, the fastest one is reported"), cl::init(3));
+
+static cl::opt<unsigned> TopFunctions("top-functions",
+    cl::desc("Slowest functions printed for each input"), cl::init(5));
+
+static cl::opt<std::string> BaselineOut("baseline-out",
+    cl::desc("Write the results as a JSON baseline"), cl::value_desc("filename"));
+
+static cl::opt<std::string> Compare("compare",
+    cl::desc("Compare the module times with a baseline written by -baseline-out"), cl::value_desc("filename"));
+
+static cl::opt<double> Tolerance("tolerance",
+    cl::desc("Slowdown over the baseline reported as a regression (0.1 = 10%)"), cl::init(0.1));
+
+static constexpr unsigned SchemaVersion = 1;
+
+struct FunctionResult {
+    std::string name;
+    unsigned blocks;
+    double seconds;
+};
+
+struct InputResult {
+    std::string name;
+    unsigned functions = 0;
+    unsigned blocks = 0;
+    double seconds = 0;
+    uint64_t peakRSS = 0;
+    size_t retained = 0;
+    unsigned operands = 0;
+    unsigned maxLookupDepth = 0;
+    double lookupNanos = 0;
+    std::vector<FunctionResult> functionResults;
+
+    double blocksPerSecond() const {
+        return seconds > 0 ? blocks / seconds : 0;
+    }
+};
+
+static double elapsedSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/// Peak resident set size of the process in KiB
+static uint64_t peakRSS() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+/**
+ * Time lookups from the block scopes of the functions analyzed by vra: the instructions of the block and the
+ * arguments, defined in the function scope. Up to MaxLookupBlocks blocks per function are
+ * sampled, evenly spaced, or a quadratic lookup would make the measure itself quadratic
+ */
+static constexpr size_t MaxLookupBlocks = 1000;
+
+static void measureLookups(Module& M, VRAPass& vra, InputResult& result) {
+    uint64_t lookups = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (Function& F : M) {
+        FunctionAnalyzer* FAN = vra.getFunctionAnalyzer(&F);
+        if (!FAN) continue;
+
+        const std::vector<std::unique_ptr<Block>>& blocks = FAN->getBlocks();
+        size_t stride = std::max<size_t>(1, blocks.size() / MaxLookupBlocks);
+
+        for (size_t i = 0; i < blocks.size(); i += stride) {
+            Block* block = blocks[i].get();
+            Scope* scope = block->getScope();
+            if (!scope) continue;
+
+            for (Instruction& I : *block->getLLVMBasicBlock()) {
+                scope->lookup(&I);
+                ++lookups;
+            }
+            for (Argument& A : F.args()) {
+                scope->lookup(&A);
+                ++lookups;
+            }
+        }
+    }
+
+    if (lookups) result.lookupNanos = elapsedSince(start) * 1e9 / lookups;
+
+    for (Function& F : M) {
+        if (FunctionAnalyzer* FAN = vra.getFunctionAnalyzer(&F)) {
+            for (const std::unique_ptr<Block>& block : FAN->getBlocks()) {
+                if (Scope* scope = block->getScope()) {
+                    result.maxLookupDepth = std::max(result.maxLookupDepth, scope->getLookupDepth());
+                }
+            }
+        }
+    }
+}
+
+/// Bytes allocated by malloc, big blocks (e.g. arena slabs) included
+static size_t mallocUsage() {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+#else
+    return sys::Process::GetMallocUsage();
+#endif
+}
+
+static bool runInput(StringRef path, InputResult& result) {
+    LLVMContext C;
+    SMDiagnostic err;
+    std::unique_ptr<Module> M = parseIRFile(path, err, C);
+    if (!M) {
+        err.print("vra-bench", errs());
+        return false;
+    }
+
+    result.name = sys::path::filename(path).str();
+    for (Function& F : *M) {
+        if (F.empty()) continue;
+        ++result.functions;
+        result.blocks += F.size();
+    }
+
+    LoopAnalysisManager LAM;
+    FunctionAnalysisManager FAM;
+    CGSCCAnalysisManager CGAM;
+    ModuleAnalysisManager MAM;
+    PassBuilder PB;
+    PB.registerModuleAnalyses(MAM);
+    PB.registerCGSCCAnalyses(CGAM);
+    PB.registerFunctionAnalyses(FAM);
+    PB.registerLoopAnalyses(LAM);
+    PB.crossRegisterProxies(LAM, FAM, CGAM, MAM);
+
+    std::unique_ptr<VRAPass> vra;
+    result.seconds = -1;
+    for (unsigned r = 0; r < std::max(1u, unsigned(Repeat)); ++r) {
+        // nothing cached from the previous run
+        vra.reset();
+        FAM.clear();
+        MAM.clear();
+
+        size_t before = mallocUsage();
+        auto start = std::chrono::steady_clock::now();
+
+        vra = std::make_unique<VRAPass>();
+        vra->analyzeModule(*M, MAM);
+
+        double seconds = elapsedSince(start);
+        if (result.seconds < 0 || seconds < result.seconds) result.seconds = seconds;
+        result.retained = mallocUsage() - before;
+    }
+    result.peakRSS = peakRSS();
+    for (Function& F : *M) {
+        if (FunctionAnalyzer* FAN = vra->getFunctionAnalyzer(&F)) result.operands += FAN->getArena().getNumOperands();
+    }
+    measureLookups(*M, *vra, result);
+    vra.reset();
+
+    // each function alone, its LLVM analyses are cached by the first run
+    VRAPass context;
+    context.initialize(*M);
+    for (Function& F : *M) {
+        if (F.empty()) continue;
+
+        double best = -1;
+        for (unsigned r = 0; r < std::max(1u, unsigned(Repeat)); ++r) {
+            auto start = std::chrono::steady_clock::now();
+            std::unique_ptr<FunctionAnalyzer> FAN = context.analyzeFunction(F, FAM);
+            double seconds = elapsedSince(start);
+            if (best < 0 || seconds < best) best = seconds;
+        }
+        result.functionResults.push_back({F.getName().str(), static_cast<unsigned>(F.size()), best});
+    }
+
+    std::stable_sort(result.functionResults.begin(), result.functionResults.end(),
+        [](const FunctionResult& a, const FunctionResult& b) { return a.seconds > b.seconds; });
+    return true;
+}
+
+static void printResults(const std::vector<InputResult>& results) {
+    outs() << "input                          funcs   blocks     seconds     blocks/s  peak RSS KiB  retained KiB  depth  ns/lookup   operands\n";
+
+    for (const InputResult& r : results) {
+        outs() << format("%-28s %7u %8u %11.6f %12.0f %13llu %13llu %6u %10.1f %10u\n", r.name.c_str(), r.functions,
+                         r.blocks, r.seconds, r.blocksPerSecond(), (unsigned long long)r.peakRSS,
+                         (unsigned long long)(r.retained / 1024), r.maxLookupDepth, r.lookupNanos, r.operands);
+
+        for (size_t i = 0; i < r.functionResults.size() && i < TopFunctions; ++i) {
+            const FunctionResult& f = r.functionResults[i];
+            outs() << format("    %-40s %8u blocks %11.6f s\n", f.name.c_str(), f.blocks, f.seconds);
+        }
+    }
+}
+
+static bool writeBaseline(StringRef path, const std::vector<InputResult>& results) {
+    std::error_code EC;
+    raw_fd_ostream out(path, EC);
+    if (EC) {
+        errs() << "vra-bench: cannot write " << path << ": " << EC.message() << "\n";
+        return false;
+    }
+
+    json::OStream J(out, 2);
+    J.object([&] {
+        J.attribute("schema", SchemaVersion);
+        J.attribute("repeat", int64_t(Repeat));
+        J.attributeArray("inputs", [&] {
+            for (const InputResult& r : results) {
+                J.object([&] {
+                    J.attribute("name", r.name);
+                    J.attribute("functions", r.functions);
+                    J.attribute("blocks", r.blocks);
+                    J.attribute("seconds", r.seconds);
+                    J.attribute("blocks_per_second", r.blocksPerSecond());
+                    J.attribute("peak_rss_kib", int64_t(r.peakRSS));
+                    J.attribute("retained_bytes", int64_t(r.retained));
+                    J.attribute("operands", r.operands);
+                    J.attribute("max_lookup_depth", r.maxLookupDepth);
+                    J.attribute("lookup_ns", r.lookupNanos);
+                    J.attributeArray("functions_detail", [&] {
+                        for (const FunctionResult& f : r.functionResults) {
+                            J.object([&] {
+                                J.attribute("name", f.name);
+                                J.attribute("blocks", f.blocks);
+                                J.attribute("seconds", f.seconds);
+                            });
+                        }
+                    });
+                });
+            }
+        });
+    });
+    out << "\n";
+    return true;
+}
+
+/**
+ * Print the time ratio of every input also in the baseline. Returns false on regressions or unreadable baseline
+ */
+static bool compareBaseline(StringRef path, const std::vector<InputResult>& results) {
+    auto bufferOrErr = MemoryBuffer::getFile(path);
+    if (!bufferOrErr) {
+        errs() << "vra-bench: cannot read " << path << "\n";
+        return false;
+    }
+
+    Expected<json::Value> parsed = json::parse((*bufferOrErr)->getBuffer());
+    if (!parsed) {
+        errs() << "vra-bench: " << path << ": " << toString(parsed.takeError()) << "\n";
+        return false;
+    }
+
+    const json::Object* root = parsed->getAsObject();
+    const json::Array* inputs = root ? root->getArray("inputs") : nullptr;
+    if (!inputs || root->getInteger("schema") != int64_t(SchemaVersion)) {
+        errs() << "vra-bench: " << path << " is not a baseline of this version\n";
+        return false;
+    }
+
+    bool ok = true;
+    outs() << "\ninput                           baseline     current    ratio\n";
+    for (const InputResult& r : results) {
+        for (const json::Value& v : *inputs) {
+            const json::Object* in = v.getAsObject();
+            if (!in || in->getString("name") != StringRef(r.name)) continue;
+
+            double base = in->getNumber("seconds").getValueOr(0);
+            double ratio = base > 0 ? r.seconds / base : 0;
+            bool regression = ratio > 1 + Tolerance;
+            ok &= !regression;
+
+            outs() << format("%-28s %11.6f %11.6f %8.2f", r.name.c_str(), base, r.seconds, ratio)
+                   << (regression ? "  REGRESSION" : "") << "\n";
+        }
+    }
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    InitLLVM X(argc, argv);
+    cl::ParseCommandLineOptions(argc, argv, "VRA benchmark\n");
+
+    bool ok = true;
+    std::vector<InputResult> results;
+    for (const std::string& path : Inputs) {
+        InputResult result;
+        if (runInput(path, result)) results.push_back(std::move(result));
+        else ok = false;
+    }
+
+    printResults(results);
+
+    if (!BaselineOut.empty()) ok &= writeBaseline(BaselineOut, results);
+    if (!Compare.empty()) ok &= compareBaseline(Compare, results);
+
+    return ok ? 0 : 1;
+}
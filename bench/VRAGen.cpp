@@ -0,0 +1,238 @@
+/**
+ * Generator of synthetic IR for the scaling tests of VRA (bench/scaling.sh).
+ *
+ * Every function carries -phi-width i32 values through a loop nest of depth -loop-depth, whose body is a chain
+ * of -blocks segments. A segment starts a new block, adds the value of a global (-globals, round robin) and
+ * then holds a nest of -fork-depth if/else (the nest is always in the then arm) and a switch with
+ * -switch-fanout cases. Each join block has a phi for each carried value.
+ *
+ * usage: vra-gen [-functions=N] [-blocks=N] [-fork-depth=N] [-loop-depth=N] [-switch-fanout=N]
+ *                [-phi-width=N] [-globals=N] [-o file]
+ */
+
+#include "llvm/IR/IRBuilder.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Module.h"
+#include "llvm/IR/Verifier.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/InitLLVM.h"
+#include "llvm/Support/ToolOutputFile.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace llvm;
+
+static cl::opt<unsigned> Functions("functions", cl::desc("Functions in the module"), cl::init(1));
+
+static cl::opt<unsigned> Blocks("blocks", cl::desc("Segments in the chain of each function"), cl::init(100));
+
+static cl::opt<unsigned> ForkDepth("fork-depth", cl::desc("Nesting of the if/else in each segment"), cl::init(0));
+
+static cl::opt<unsigned> LoopDepth("loop-depth", cl::desc("Loops nested around the chain"), cl::init(0));
+
+static cl::opt<unsigned> SwitchFanout("switch-fanout", cl::desc("Cases of the switch in each segment, 0 for none"),
+    cl::init(0));
+
+static cl::opt<unsigned> PhiWidth("phi-width", cl::desc("Values carried along the function (phis in each join)"),
+    cl::init(1));
+
+static cl::opt<unsigned> Globals("globals", cl::desc("Global variables read by the segments"), cl::init(0));
+
+static cl::opt<std::string> Output("o", cl::desc("Output file"), cl::value_desc("filename"), cl::init("-"));
+
+namespace {
+
+class Generator {
+
+public:
+
+    Generator(Module& M) : M(M), C(M.getContext()), B(C) {
+        for (unsigned i = 0; i < Globals; ++i) {
+            globals.push_back(new GlobalVariable(M, B.getInt32Ty(), false, GlobalValue::InternalLinkage,
+                                                 B.getInt32(i % 1000), "g" + Twine(i)));
+        }
+    }
+
+    void emitFunction(unsigned index) {
+        FunctionType* FT = FunctionType::get(B.getInt32Ty(), {B.getInt32Ty()}, false);
+        F = Function::Create(FT, GlobalValue::ExternalLinkage, "gen" + Twine(index), M);
+        Argument* x = F->getArg(0);
+        x->setName("x");
+
+        B.SetInsertPoint(BasicBlock::Create(C, "entry", F));
+        live.clear();
+        for (unsigned i = 0; i < std::max(1u, unsigned(PhiWidth)); ++i) {
+            live.push_back(B.CreateAdd(x, B.getInt32(i), "v"));
+        }
+
+        emitLoop(LoopDepth);
+
+        Value* sum = live[0];
+        for (size_t i = 1; i < live.size(); ++i) sum = B.CreateAdd(sum, live[i], "sum");
+        B.CreateRet(sum);
+    }
+
+private:
+
+    BasicBlock* newBlock(const Twine& name) {
+        return BasicBlock::Create(C, name, F);
+    }
+
+    /// Arithmetic on the carried values, so that every block defines something
+    void emitUpdate(unsigned step) {
+        for (size_t i = 0; i < live.size(); ++i) {
+            live[i] = B.CreateAdd(live[i], B.getInt32(step + i), "v");
+        }
+    }
+
+    /// Phis in join for the carried values coming from each predecessor
+    void emitJoin(BasicBlock* join, ArrayRef<std::pair<BasicBlock*, std::vector<Value*>>> incoming) {
+        B.SetInsertPoint(join);
+        for (size_t i = 0; i < live.size(); ++i) {
+            PHINode* phi = B.CreatePHI(B.getInt32Ty(), incoming.size(), "m");
+            for (const auto& [pred, values] : incoming) phi->addIncoming(values[i], pred);
+            live[i] = phi;
+        }
+    }
+
+    void emitLoop(unsigned depth) {
+        if (depth == 0) {
+            for (unsigned s = 0; s < Blocks; ++s) emitSegment(s);
+            return;
+        }
+
+        BasicBlock* preheader = B.GetInsertBlock();
+        BasicBlock* header = newBlock("loop" + Twine(depth));
+        BasicBlock* body = newBlock("body" + Twine(depth));
+        BasicBlock* exit = newBlock("exit" + Twine(depth));
+        B.CreateBr(header);
+
+        B.SetInsertPoint(header);
+        PHINode* iv = B.CreatePHI(B.getInt32Ty(), 2, "i");
+        iv->addIncoming(B.getInt32(0), preheader);
+
+        std::vector<PHINode*> phis;
+        for (Value*& v : live) {
+            PHINode* phi = B.CreatePHI(B.getInt32Ty(), 2, "l");
+            phi->addIncoming(v, preheader);
+            phis.push_back(phi);
+            v = phi;
+        }
+        B.CreateCondBr(B.CreateICmpSLT(iv, B.getInt32(8 + depth), "cmp"), body, exit);
+
+        B.SetInsertPoint(body);
+        emitLoop(depth - 1);
+
+        BasicBlock* latch = B.GetInsertBlock();
+        iv->addIncoming(B.CreateAdd(iv, B.getInt32(1), "inc"), latch);
+        for (size_t i = 0; i < phis.size(); ++i) phis[i]->addIncoming(live[i], latch);
+        B.CreateBr(header);
+
+        B.SetInsertPoint(exit);
+        live.assign(phis.begin(), phis.end());
+    }
+
+    void emitSegment(unsigned index) {
+        BasicBlock* segment = newBlock("seg" + Twine(index));
+        B.CreateBr(segment);
+        B.SetInsertPoint(segment);
+
+        if (!globals.empty()) {
+            GlobalVariable* G = globals[index % globals.size()];
+            live[0] = B.CreateAdd(live[0], B.CreateLoad(B.getInt32Ty(), G, "ld"), "v");
+        }
+        emitUpdate(1);
+        emitFork(ForkDepth);
+        if (SwitchFanout) emitSwitch();
+    }
+
+    void emitFork(unsigned depth) {
+        if (depth == 0) return;
+
+        BasicBlock* then = newBlock("then");
+        BasicBlock* other = newBlock("else");
+        BasicBlock* join = newBlock("join");
+        B.CreateCondBr(B.CreateICmpSLT(live[0], B.getInt32(depth * 10), "cmp"), then, other);
+
+        std::vector<Value*> entry = live;
+
+        B.SetInsertPoint(then);
+        emitUpdate(2);
+        emitFork(depth - 1);
+        std::pair<BasicBlock*, std::vector<Value*>> fromThen = {B.GetInsertBlock(), live};
+        B.CreateBr(join);
+
+        live = entry;
+        B.SetInsertPoint(other);
+        emitUpdate(3);
+        std::pair<BasicBlock*, std::vector<Value*>> fromElse = {other, live};
+        B.CreateBr(join);
+
+        emitJoin(join, {fromThen, fromElse});
+    }
+
+    void emitSwitch() {
+        BasicBlock* from = B.GetInsertBlock();
+        BasicBlock* join = newBlock("swjoin");
+        SwitchInst* sw = B.CreateSwitch(live[0], join, SwitchFanout);
+
+        std::vector<Value*> entry = live;
+        std::vector<std::pair<BasicBlock*, std::vector<Value*>>> incoming = {{from, entry}};
+
+        for (unsigned c = 0; c < SwitchFanout; ++c) {
+            BasicBlock* target = newBlock("case" + Twine(c));
+            sw->addCase(B.getInt32(c), target);
+
+            live = entry;
+            B.SetInsertPoint(target);
+            emitUpdate(c);
+            incoming.push_back({target, live});
+            B.CreateBr(join);
+        }
+
+        emitJoin(join, incoming);
+    }
+
+    Module& M;
+    LLVMContext& C;
+    IRBuilder<> B;
+
+    Function* F = nullptr;
+
+    std::vector<GlobalVariable*> globals;
+
+    /// values carried along the function, as seen at the insertion point
+    std::vector<Value*> live;
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+    InitLLVM X(argc, argv);
+    cl::ParseCommandLineOptions(argc, argv, "VRA synthetic IR generator\n");
+
+    LLVMContext C;
+    Module M("vra-gen", C);
+    Generator gen(M);
+    for (unsigned i = 0; i < Functions; ++i) gen.emitFunction(i);
+
+    if (verifyModule(M, &errs())) {
+        errs() << "vra-gen: invalid module generated\n";
+        return 1;
+    }
+
+    std::error_code EC;
+    ToolOutputFile out(Output, EC, sys::fs::OF_Text);
+    if (EC) {
+        errs() << "vra-gen: cannot write " << Output << ": " << EC.message() << "\n";
+        return 1;
+    }
+
+    M.print(out.os(), nullptr);
+    out.keep();
+    return 0;
+}
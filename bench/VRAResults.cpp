@@ -0,0 +1,85 @@
+/**
+ * Round trip of a results file written by -vra-results (bench/cache_check.sh).
+ *
+ * The values of the module are numbered as VRAPass numbers them (module order for globals,
+ * ResultCache::numberValues in each function) and named as in the report (slot number for unnamed values).
+ * Every value found by id must be found by name with the same range (a value without range is found neither way).
+ *
+ * usage: vra-results <module.ll> <results.bin>
+ */
+
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Module.h"
+#include "llvm/IR/ModuleSlotTracker.h"
+#include "llvm/IRReader/IRReader.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/InitLLVM.h"
+#include "llvm/Support/SourceMgr.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <optional>
+#include <string>
+
+#include "ReportWriter.hpp"
+#include "ResultCache.hpp"
+#include "ResultFile.hpp"
+
+using namespace llvm;
+
+static cl::opt<std::string> Input(cl::Positional, cl::desc("<IR file>"), cl::Required);
+
+static cl::opt<std::string> Results(cl::Positional, cl::desc("<results file>"), cl::Required);
+
+static bool sameRange(const std::optional<Range>& a, const std::optional<Range>& b) {
+    if (!a || !b) return !a && !b;
+    return a->min == b->min && a->max == b->max && a->isFixed == b->isFixed;
+}
+
+int main(int argc, char** argv) {
+    InitLLVM X(argc, argv);
+    cl::ParseCommandLineOptions(argc, argv, "VRA results file round trip\n");
+
+    LLVMContext context;
+    SMDiagnostic err;
+    std::unique_ptr<Module> M = parseIRFile(Input, err, context);
+    if (!M) {
+        err.print(argv[0], errs());
+        return 1;
+    }
+
+    ResultFile results(Results);
+    if (!results.isValid()) {
+        errs() << Results << ": not a results file\n";
+        return 1;
+    }
+
+    ModuleSlotTracker MST(M.get());
+    SmallString<32> buffer;
+    unsigned mismatches = 0;
+
+    // check: value of function at position id, found by id, is found by name with the same range
+    auto check = [&](StringRef function, uint32_t id, const Value& V) {
+        std::optional<Range> byId = results.lookup(function, id);
+        if (!byId) return;
+        StringRef name = ReportWriter::getValueName(V, &MST, buffer);
+        std::optional<Range> byName = results.lookup(function, name);
+        if (sameRange(byId, byName)) return;
+        ++mismatches;
+        errs() << (function.empty() ? "<globals>" : function) << ": value " << id << " (" << name << ") ";
+        if (byName) errs() << "has range [" << byName->min << ", " << byName->max << "] by name";
+        else errs() << "is not found by name";
+        errs() << ", [" << byId->min << ", " << byId->max << "] by id\n";
+    };
+
+    uint32_t id = 0;
+    for (const GlobalVariable& gv : M->globals()) check(StringRef(), id++, gv);
+
+    for (const Function& F : M->functions()) {
+        if (F.isDeclaration()) continue;
+        MST.incorporateFunction(F);
+        id = 0;
+        for (const Value* V : ResultCache::numberValues(F)) check(F.getName(), id++, *V);
+    }
+
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,48 @@
+#!/usr/bin/env bash
+#
+# Scaling benchmark of FunctionAnalyzer on a single function made of a chain of N blocks.
+# Time per block should stay flat when block lookups are O(1).
+#
+# usage: bench/block_scaling.sh <path/to/MyHelloPass.so> [sizes...]
+
+set -euo pipefail
+
+PLUGIN=${1:?usage: $0 <plugin.so> [sizes...]}
+shift
+SIZES=${*:-1000 2000 4000 8000 16000}
+OPT=${OPT:-opt}
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+gen_chain() {
+    local n=$1
+    echo "define i32 @chain(i1 %c) {"
+    echo "entry:"
+    echo "  %v0 = add i32 0, 1"
+    echo "  br i1 %c, label %bb1, label %end"
+    for ((i = 1; i <= n; i++)); do
+        echo "bb$i:"
+        echo "  %v$i = add i32 %v$((i - 1)), 1"
+        if ((i < n)); then
+            echo "  br label %bb$((i + 1))"
+        else
+            echo "  br label %end"
+        fi
+    done
+    # the blocks of the chain are simple blocks; the return block has two predecessors (entry and the last
+    # block of the chain), so it is the only merge (StandardMerge) and joins two scopes once
+    echo "end:"
+    echo "  ret i32 0"
+    echo "}"
+}
+
+printf "%8s %12s %12s\n" "blocks" "seconds" "us/block"
+for n in $SIZES; do
+    gen_chain "$n" > "$TMP/chain_$n.ll"
+    start=$(date +%s.%N)
+    "$OPT" -load-pass-plugin "$PLUGIN" -passes=vra -disable-output "$TMP/chain_$n.ll" > /dev/null 2>&1
+    end=$(date +%s.%N)
+    awk -v n="$n" -v s="$start" -v e="$end" \
+        'BEGIN { t = e - s; printf "%8d %12.3f %12.2f\n", n, t, t * 1e6 / n }'
+done
@@ -0,0 +1,63 @@
+#!/usr/bin/env bash
+#
+# The result cache must not change what VRA writes: each module is analyzed without cache (cold), then twice
+# with a fresh cache file (the first run fills it, the second one finds every function in it), and the report,
+# the results file and the module annotated with -vra-write-metadata of the cold and warm runs are compared.
+# The results file of the cold run is also read back by vra-results (built next to the plugin with
+# --target vra-results, or given in RESULTS): every value must be found by id and by name with the same range.
+# The exit status is 1 if some output differs or the results file does not read back.
+#
+# usage: bench/cache_check.sh <plugin.so> [modules...]   (default bench/corpus/*.ll)
+#
+# Extra VRA options can be given in VRA_ARGS (e.g. -vra-loop-fixpoint), they are used by every run.
+
+set -euo pipefail
+
+PLUGIN=${1:?usage: $0 <plugin.so> [modules...]}
+shift
+MODULES=("$@")
+[[ ${#MODULES[@]} -eq 0 ]] && MODULES=("$(dirname "$0")"/corpus/*.ll)
+OPT=${OPT:-opt}
+VRA_ARGS=${VRA_ARGS:-}
+RESULTS=${RESULTS:-$(dirname "$PLUGIN")/vra-results}
+[[ -x $RESULTS ]] || echo "$RESULTS not found: the results file is not read back" >&2
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+# run <output prefix> <options...>: every output of the analysis for the current module
+run() {
+    local out=$1
+    shift
+    # shellcheck disable=SC2086
+    "$OPT" -load "$PLUGIN" -load-pass-plugin "$PLUGIN" -passes=vra $VRA_ARGS "$@" \
+        -vra-report="$out.jsonl" -vra-results="$out.bin" -vra-write-metadata -S -o "$out.ll" "$module"
+}
+
+failed=0
+for module in "${MODULES[@]}"; do
+    name=$(basename "$module")
+    rm -f "$TMP/cache"
+
+    run "$TMP/cold"
+    # shellcheck disable=SC2086
+    "$OPT" -load "$PLUGIN" -load-pass-plugin "$PLUGIN" -passes=vra $VRA_ARGS -vra-cache="$TMP/cache" \
+        -disable-output "$module"
+    run "$TMP/warm" -vra-cache="$TMP/cache"
+
+    differs=""
+    for ext in jsonl bin ll; do
+        cmp -s "$TMP/cold.$ext" "$TMP/warm.$ext" || differs+=" $ext"
+    done
+    if [[ -x $RESULTS ]] && ! "$RESULTS" "$module" "$TMP/cold.bin"; then
+        differs+=" readback"
+    fi
+    if [[ -n $differs ]]; then
+        printf "%-32s differs:%s\n" "$name" "$differs"
+        failed=1
+    else
+        printf "%-32s ok\n" "$name"
+    fi
+done
+
+exit $failed
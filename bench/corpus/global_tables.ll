@@ -0,0 +1,5010 @@
+; 4000 scalar globals (integer and float coefficients) and a table, read by a lookup loop
+@f0 = constant float 0.000000e+00
+@k1 = constant i32 -463
+@f2 = constant float 5.000000e-01
+@k3 = constant i32 -389
+@f4 = constant float 1.000000e+00
+@k5 = constant i32 -315
+@f6 = constant float 1.500000e+00
+@k7 = constant i32 -241
+@f8 = constant float 2.000000e+00
+@k9 = constant i32 -167
+@f10 = constant float 2.500000e+00
+@k11 = constant i32 -93
+@f12 = constant float 3.000000e+00
+@k13 = constant i32 -19
+@f14 = constant float 3.500000e+00
+@k15 = constant i32 55
+@f16 = constant float 4.000000e+00
+@k17 = constant i32 129
+@f18 = constant float 4.500000e+00
+@k19 = constant i32 203
+@f20 = constant float 5.000000e+00
+@k21 = constant i32 277
+@f22 = constant float 5.500000e+00
+@k23 = constant i32 351
+@f24 = constant float 6.000000e+00
+@k25 = constant i32 425
+@f26 = constant float 6.500000e+00
+@k27 = constant i32 499
+@f28 = constant float 7.000000e+00
+@k29 = constant i32 -436
+@f30 = constant float 7.500000e+00
+@k31 = constant i32 -362
+@f32 = constant float 8.000000e+00
+@k33 = constant i32 -288
+@f34 = constant float 8.500000e+00
+@k35 = constant i32 -214
+@f36 = constant float 9.000000e+00
+@k37 = constant i32 -140
+@f38 = constant float 9.500000e+00
+@k39 = constant i32 -66
+@f40 = constant float 1.000000e+01
+@k41 = constant i32 8
+@f42 = constant float 1.050000e+01
+@k43 = constant i32 82
+@f44 = constant float 1.100000e+01
+@k45 = constant i32 156
+@f46 = constant float 1.150000e+01
+@k47 = constant i32 230
+@f48 = constant float 1.200000e+01
+@k49 = constant i32 304
+@f50 = constant float 1.250000e+01
+@k51 = constant i32 378
+@f52 = constant float 1.300000e+01
+@k53 = constant i32 452
+@f54 = constant float 1.350000e+01
+@k55 = constant i32 -483
+@f56 = constant float 1.400000e+01
+@k57 = constant i32 -409
+@f58 = constant float 1.450000e+01
+@k59 = constant i32 -335
+@f60 = constant float 1.500000e+01
+@k61 = constant i32 -261
+@f62 = constant float 1.550000e+01
+@k63 = constant i32 -187
+@f64 = constant float 1.600000e+01
+@k65 = constant i32 -113
+@f66 = constant float 1.650000e+01
+@k67 = constant i32 -39
+@f68 = constant float 1.700000e+01
+@k69 = constant i32 35
+@f70 = constant float 1.750000e+01
+@k71 = constant i32 109
+@f72 = constant float 1.800000e+01
+@k73 = constant i32 183
+@f74 = constant float 1.850000e+01
+@k75 = constant i32 257
+@f76 = constant float 1.900000e+01
+@k77 = constant i32 331
+@f78 = constant float 1.950000e+01
+@k79 = constant i32 405
+@f80 = constant float 2.000000e+01
+@k81 = constant i32 479
+@f82 = constant float 2.050000e+01
+@k83 = constant i32 -456
+@f84 = constant float 2.100000e+01
+@k85 = constant i32 -382
+@f86 = constant float 2.150000e+01
+@k87 = constant i32 -308
+@f88 = constant float 2.200000e+01
+@k89 = constant i32 -234
+@f90 = constant float 2.250000e+01
+@k91 = constant i32 -160
+@f92 = constant float 2.300000e+01
+@k93 = constant i32 -86
+@f94 = constant float 2.350000e+01
+@k95 = constant i32 -12
+@f96 = constant float 2.400000e+01
+@k97 = constant i32 62
+@f98 = constant float 2.500000e-01
+@k99 = constant i32 136
+@f100 = constant float 7.500000e-01
+@k101 = constant i32 210
+@f102 = constant float 1.250000e+00
+@k103 = constant i32 284
+@f104 = constant float 1.750000e+00
+@k105 = constant i32 358
+@f106 = constant float 2.250000e+00
+@k107 = constant i32 432
+@f108 = constant float 2.750000e+00
+@k109 = constant i32 506
+@f110 = constant float 3.250000e+00
+@k111 = constant i32 -429
+@f112 = constant float 3.750000e+00
+@k113 = constant i32 -355
+@f114 = constant float 4.250000e+00
+@k115 = constant i32 -281
+@f116 = constant float 4.750000e+00
+@k117 = constant i32 -207
+@f118 = constant float 5.250000e+00
+@k119 = constant i32 -133
+@f120 = constant float 5.750000e+00
+@k121 = constant i32 -59
+@f122 = constant float 6.250000e+00
+@k123 = constant i32 15
+@f124 = constant float 6.750000e+00
+@k125 = constant i32 89
+@f126 = constant float 7.250000e+00
+@k127 = constant i32 163
+@f128 = constant float 7.750000e+00
+@k129 = constant i32 237
+@f130 = constant float 8.250000e+00
+@k131 = constant i32 311
+@f132 = constant float 8.750000e+00
+@k133 = constant i32 385
+@f134 = constant float 9.250000e+00
+@k135 = constant i32 459
+@f136 = constant float 9.750000e+00
+@k137 = constant i32 -476
+@f138 = constant float 1.025000e+01
+@k139 = constant i32 -402
+@f140 = constant float 1.075000e+01
+@k141 = constant i32 -328
+@f142 = constant float 1.125000e+01
+@k143 = constant i32 -254
+@f144 = constant float 1.175000e+01
+@k145 = constant i32 -180
+@f146 = constant float 1.225000e+01
+@k147 = constant i32 -106
+@f148 = constant float 1.275000e+01
+@k149 = constant i32 -32
+@f150 = constant float 1.325000e+01
+@k151 = constant i32 42
+@f152 = constant float 1.375000e+01
+@k153 = constant i32 116
+@f154 = constant float 1.425000e+01
+@k155 = constant i32 190
+@f156 = constant float 1.475000e+01
+@k157 = constant i32 264
+@f158 = constant float 1.525000e+01
+@k159 = constant i32 338
+@f160 = constant float 1.575000e+01
+@k161 = constant i32 412
+@f162 = constant float 1.625000e+01
+@k163 = constant i32 486
+@f164 = constant float 1.675000e+01
+@k165 = constant i32 -449
+@f166 = constant float 1.725000e+01
+@k167 = constant i32 -375
+@f168 = constant float 1.775000e+01
+@k169 = constant i32 -301
+@f170 = constant float 1.825000e+01
+@k171 = constant i32 -227
+@f172 = constant float 1.875000e+01
+@k173 = constant i32 -153
+@f174 = constant float 1.925000e+01
+@k175 = constant i32 -79
+@f176 = constant float 1.975000e+01
+@k177 = constant i32 -5
+@f178 = constant float 2.025000e+01
+@k179 = constant i32 69
+@f180 = constant float 2.075000e+01
+@k181 = constant i32 143
+@f182 = constant float 2.125000e+01
+@k183 = constant i32 217
+@f184 = constant float 2.175000e+01
+@k185 = constant i32 291
+@f186 = constant float 2.225000e+01
+@k187 = constant i32 365
+@f188 = constant float 2.275000e+01
+@k189 = constant i32 439
+@f190 = constant float 2.325000e+01
+@k191 = constant i32 -496
+@f192 = constant float 2.375000e+01
+@k193 = constant i32 -422
+@f194 = constant float 0.000000e+00
+@k195 = constant i32 -348
+@f196 = constant float 5.000000e-01
+@k197 = constant i32 -274
+@f198 = constant float 1.000000e+00
+@k199 = constant i32 -200
+@f200 = constant float 1.500000e+00
+@k201 = constant i32 -126
+@f202 = constant float 2.000000e+00
+@k203 = constant i32 -52
+@f204 = constant float 2.500000e+00
+@k205 = constant i32 22
+@f206 = constant float 3.000000e+00
+@k207 = constant i32 96
+@f208 = constant float 3.500000e+00
+@k209 = constant i32 170
+@f210 = constant float 4.000000e+00
+@k211 = constant i32 244
+@f212 = constant float 4.500000e+00
+@k213 = constant i32 318
+@f214 = constant float 5.000000e+00
+@k215 = constant i32 392
+@f216 = constant float 5.500000e+00
+@k217 = constant i32 466
+@f218 = constant float 6.000000e+00
+@k219 = constant i32 -469
+@f220 = constant float 6.500000e+00
+@k221 = constant i32 -395
+@f222 = constant float 7.000000e+00
+@k223 = constant i32 -321
+@f224 = constant float 7.500000e+00
+@k225 = constant i32 -247
+@f226 = constant float 8.000000e+00
+@k227 = constant i32 -173
+@f228 = constant float 8.500000e+00
+@k229 = constant i32 -99
+@f230 = constant float 9.000000e+00
+@k231 = constant i32 -25
+@f232 = constant float 9.500000e+00
+@k233 = constant i32 49
+@f234 = constant float 1.000000e+01
+@k235 = constant i32 123
+@f236 = constant float 1.050000e+01
+@k237 = constant i32 197
+@f238 = constant float 1.100000e+01
+@k239 = constant i32 271
+@f240 = constant float 1.150000e+01
+@k241 = constant i32 345
+@f242 = constant float 1.200000e+01
+@k243 = constant i32 419
+@f244 = constant float 1.250000e+01
+@k245 = constant i32 493
+@f246 = constant float 1.300000e+01
+@k247 = constant i32 -442
+@f248 = constant float 1.350000e+01
+@k249 = constant i32 -368
+@f250 = constant float 1.400000e+01
+@k251 = constant i32 -294
+@f252 = constant float 1.450000e+01
+@k253 = constant i32 -220
+@f254 = constant float 1.500000e+01
+@k255 = constant i32 -146
+@f256 = constant float 1.550000e+01
+@k257 = constant i32 -72
+@f258 = constant float 1.600000e+01
+@k259 = constant i32 2
+@f260 = constant float 1.650000e+01
+@k261 = constant i32 76
+@f262 = constant float 1.700000e+01
+@k263 = constant i32 150
+@f264 = constant float 1.750000e+01
+@k265 = constant i32 224
+@f266 = constant float 1.800000e+01
+@k267 = constant i32 298
+@f268 = constant float 1.850000e+01
+@k269 = constant i32 372
+@f270 = constant float 1.900000e+01
+@k271 = constant i32 446
+@f272 = constant float 1.950000e+01
+@k273 = constant i32 -489
+@f274 = constant float 2.000000e+01
+@k275 = constant i32 -415
+@f276 = constant float 2.050000e+01
+@k277 = constant i32 -341
+@f278 = constant float 2.100000e+01
+@k279 = constant i32 -267
+@f280 = constant float 2.150000e+01
+@k281 = constant i32 -193
+@f282 = constant float 2.200000e+01
+@k283 = constant i32 -119
+@f284 = constant float 2.250000e+01
+@k285 = constant i32 -45
+@f286 = constant float 2.300000e+01
+@k287 = constant i32 29
+@f288 = constant float 2.350000e+01
+@k289 = constant i32 103
+@f290 = constant float 2.400000e+01
+@k291 = constant i32 177
+@f292 = constant float 2.500000e-01
+@k293 = constant i32 251
+@f294 = constant float 7.500000e-01
+@k295 = constant i32 325
+@f296 = constant float 1.250000e+00
+@k297 = constant i32 399
+@f298 = constant float 1.750000e+00
+@k299 = constant i32 473
+@f300 = constant float 2.250000e+00
+@k301 = constant i32 -462
+@f302 = constant float 2.750000e+00
+@k303 = constant i32 -388
+@f304 = constant float 3.250000e+00
+@k305 = constant i32 -314
+@f306 = constant float 3.750000e+00
+@k307 = constant i32 -240
+@f308 = constant float 4.250000e+00
+@k309 = constant i32 -166
+@f310 = constant float 4.750000e+00
+@k311 = constant i32 -92
+@f312 = constant float 5.250000e+00
+@k313 = constant i32 -18
+@f314 = constant float 5.750000e+00
+@k315 = constant i32 56
+@f316 = constant float 6.250000e+00
+@k317 = constant i32 130
+@f318 = constant float 6.750000e+00
+@k319 = constant i32 204
+@f320 = constant float 7.250000e+00
+@k321 = constant i32 278
+@f322 = constant float 7.750000e+00
+@k323 = constant i32 352
+@f324 = constant float 8.250000e+00
+@k325 = constant i32 426
+@f326 = constant float 8.750000e+00
+@k327 = constant i32 500
+@f328 = constant float 9.250000e+00
+@k329 = constant i32 -435
+@f330 = constant float 9.750000e+00
+@k331 = constant i32 -361
+@f332 = constant float 1.025000e+01
+@k333 = constant i32 -287
+@f334 = constant float 1.075000e+01
+@k335 = constant i32 -213
+@f336 = constant float 1.125000e+01
+@k337 = constant i32 -139
+@f338 = constant float 1.175000e+01
+@k339 = constant i32 -65
+@f340 = constant float 1.225000e+01
+@k341 = constant i32 9
+@f342 = constant float 1.275000e+01
+@k343 = constant i32 83
+@f344 = constant float 1.325000e+01
+@k345 = constant i32 157
+@f346 = constant float 1.375000e+01
+@k347 = constant i32 231
+@f348 = constant float 1.425000e+01
+@k349 = constant i32 305
+@f350 = constant float 1.475000e+01
+@k351 = constant i32 379
+@f352 = constant float 1.525000e+01
+@k353 = constant i32 453
+@f354 = constant float 1.575000e+01
+@k355 = constant i32 -482
+@f356 = constant float 1.625000e+01
+@k357 = constant i32 -408
+@f358 = constant float 1.675000e+01
+@k359 = constant i32 -334
+@f360 = constant float 1.725000e+01
+@k361 = constant i32 -260
+@f362 = constant float 1.775000e+01
+@k363 = constant i32 -186
+@f364 = constant float 1.825000e+01
+@k365 = constant i32 -112
+@f366 = constant float 1.875000e+01
+@k367 = constant i32 -38
+@f368 = constant float 1.925000e+01
+@k369 = constant i32 36
+@f370 = constant float 1.975000e+01
+@k371 = constant i32 110
+@f372 = constant float 2.025000e+01
+@k373 = constant i32 184
+@f374 = constant float 2.075000e+01
+@k375 = constant i32 258
+@f376 = constant float 2.125000e+01
+@k377 = constant i32 332
+@f378 = constant float 2.175000e+01
+@k379 = constant i32 406
+@f380 = constant float 2.225000e+01
+@k381 = constant i32 480
+@f382 = constant float 2.275000e+01
+@k383 = constant i32 -455
+@f384 = constant float 2.325000e+01
+@k385 = constant i32 -381
+@f386 = constant float 2.375000e+01
+@k387 = constant i32 -307
+@f388 = constant float 0.000000e+00
+@k389 = constant i32 -233
+@f390 = constant float 5.000000e-01
+@k391 = constant i32 -159
+@f392 = constant float 1.000000e+00
+@k393 = constant i32 -85
+@f394 = constant float 1.500000e+00
+@k395 = constant i32 -11
+@f396 = constant float 2.000000e+00
+@k397 = constant i32 63
+@f398 = constant float 2.500000e+00
+@k399 = constant i32 137
+@f400 = constant float 3.000000e+00
+@k401 = constant i32 211
+@f402 = constant float 3.500000e+00
+@k403 = constant i32 285
+@f404 = constant float 4.000000e+00
+@k405 = constant i32 359
+@f406 = constant float 4.500000e+00
+@k407 = constant i32 433
+@f408 = constant float 5.000000e+00
+@k409 = constant i32 507
+@f410 = constant float 5.500000e+00
+@k411 = constant i32 -428
+@f412 = constant float 6.000000e+00
+@k413 = constant i32 -354
+@f414 = constant float 6.500000e+00
+@k415 = constant i32 -280
+@f416 = constant float 7.000000e+00
+@k417 = constant i32 -206
+@f418 = constant float 7.500000e+00
+@k419 = constant i32 -132
+@f420 = constant float 8.000000e+00
+@k421 = constant i32 -58
+@f422 = constant float 8.500000e+00
+@k423 = constant i32 16
+@f424 = constant float 9.000000e+00
+@k425 = constant i32 90
+@f426 = constant float 9.500000e+00
+@k427 = constant i32 164
+@f428 = constant float 1.000000e+01
+@k429 = constant i32 238
+@f430 = constant float 1.050000e+01
+@k431 = constant i32 312
+@f432 = constant float 1.100000e+01
+@k433 = constant i32 386
+@f434 = constant float 1.150000e+01
+@k435 = constant i32 460
+@f436 = constant float 1.200000e+01
+@k437 = constant i32 -475
+@f438 = constant float 1.250000e+01
+@k439 = constant i32 -401
+@f440 = constant float 1.300000e+01
+@k441 = constant i32 -327
+@f442 = constant float 1.350000e+01
+@k443 = constant i32 -253
+@f444 = constant float 1.400000e+01
+@k445 = constant i32 -179
+@f446 = constant float 1.450000e+01
+@k447 = constant i32 -105
+@f448 = constant float 1.500000e+01
+@k449 = constant i32 -31
+@f450 = constant float 1.550000e+01
+@k451 = constant i32 43
+@f452 = constant float 1.600000e+01
+@k453 = constant i32 117
+@f454 = constant float 1.650000e+01
+@k455 = constant i32 191
+@f456 = constant float 1.700000e+01
+@k457 = constant i32 265
+@f458 = constant float 1.750000e+01
+@k459 = constant i32 339
+@f460 = constant float 1.800000e+01
+@k461 = constant i32 413
+@f462 = constant float 1.850000e+01
+@k463 = constant i32 487
+@f464 = constant float 1.900000e+01
+@k465 = constant i32 -448
+@f466 = constant float 1.950000e+01
+@k467 = constant i32 -374
+@f468 = constant float 2.000000e+01
+@k469 = constant i32 -300
+@f470 = constant float 2.050000e+01
+@k471 = constant i32 -226
+@f472 = constant float 2.100000e+01
+@k473 = constant i32 -152
+@f474 = constant float 2.150000e+01
+@k475 = constant i32 -78
+@f476 = constant float 2.200000e+01
+@k477 = constant i32 -4
+@f478 = constant float 2.250000e+01
+@k479 = constant i32 70
+@f480 = constant float 2.300000e+01
+@k481 = constant i32 144
+@f482 = constant float 2.350000e+01
+@k483 = constant i32 218
+@f484 = constant float 2.400000e+01
+@k485 = constant i32 292
+@f486 = constant float 2.500000e-01
+@k487 = constant i32 366
+@f488 = constant float 7.500000e-01
+@k489 = constant i32 440
+@f490 = constant float 1.250000e+00
+@k491 = constant i32 -495
+@f492 = constant float 1.750000e+00
+@k493 = constant i32 -421
+@f494 = constant float 2.250000e+00
+@k495 = constant i32 -347
+@f496 = constant float 2.750000e+00
+@k497 = constant i32 -273
+@f498 = constant float 3.250000e+00
+@k499 = constant i32 -199
+@f500 = constant float 3.750000e+00
+@k501 = constant i32 -125
+@f502 = constant float 4.250000e+00
+@k503 = constant i32 -51
+@f504 = constant float 4.750000e+00
+@k505 = constant i32 23
+@f506 = constant float 5.250000e+00
+@k507 = constant i32 97
+@f508 = constant float 5.750000e+00
+@k509 = constant i32 171
+@f510 = constant float 6.250000e+00
+@k511 = constant i32 245
+@f512 = constant float 6.750000e+00
+@k513 = constant i32 319
+@f514 = constant float 7.250000e+00
+@k515 = constant i32 393
+@f516 = constant float 7.750000e+00
+@k517 = constant i32 467
+@f518 = constant float 8.250000e+00
+@k519 = constant i32 -468
+@f520 = constant float 8.750000e+00
+@k521 = constant i32 -394
+@f522 = constant float 9.250000e+00
+@k523 = constant i32 -320
+@f524 = constant float 9.750000e+00
+@k525 = constant i32 -246
+@f526 = constant float 1.025000e+01
+@k527 = constant i32 -172
+@f528 = constant float 1.075000e+01
+@k529 = constant i32 -98
+@f530 = constant float 1.125000e+01
+@k531 = constant i32 -24
+@f532 = constant float 1.175000e+01
+@k533 = constant i32 50
+@f534 = constant float 1.225000e+01
+@k535 = constant i32 124
+@f536 = constant float 1.275000e+01
+@k537 = constant i32 198
+@f538 = constant float 1.325000e+01
+@k539 = constant i32 272
+@f540 = constant float 1.375000e+01
+@k541 = constant i32 346
+@f542 = constant float 1.425000e+01
+@k543 = constant i32 420
+@f544 = constant float 1.475000e+01
+@k545 = constant i32 494
+@f546 = constant float 1.525000e+01
+@k547 = constant i32 -441
+@f548 = constant float 1.575000e+01
+@k549 = constant i32 -367
+@f550 = constant float 1.625000e+01
+@k551 = constant i32 -293
+@f552 = constant float 1.675000e+01
+@k553 = constant i32 -219
+@f554 = constant float 1.725000e+01
+@k555 = constant i32 -145
+@f556 = constant float 1.775000e+01
+@k557 = constant i32 -71
+@f558 = constant float 1.825000e+01
+@k559 = constant i32 3
+@f560 = constant float 1.875000e+01
+@k561 = constant i32 77
+@f562 = constant float 1.925000e+01
+@k563 = constant i32 151
+@f564 = constant float 1.975000e+01
+@k565 = constant i32 225
+@f566 = constant float 2.025000e+01
+@k567 = constant i32 299
+@f568 = constant float 2.075000e+01
+@k569 = constant i32 373
+@f570 = constant float 2.125000e+01
+@k571 = constant i32 447
+@f572 = constant float 2.175000e+01
+@k573 = constant i32 -488
+@f574 = constant float 2.225000e+01
+@k575 = constant i32 -414
+@f576 = constant float 2.275000e+01
+@k577 = constant i32 -340
+@f578 = constant float 2.325000e+01
+@k579 = constant i32 -266
+@f580 = constant float 2.375000e+01
+@k581 = constant i32 -192
+@f582 = constant float 0.000000e+00
+@k583 = constant i32 -118
+@f584 = constant float 5.000000e-01
+@k585 = constant i32 -44
+@f586 = constant float 1.000000e+00
+@k587 = constant i32 30
+@f588 = constant float 1.500000e+00
+@k589 = constant i32 104
+@f590 = constant float 2.000000e+00
+@k591 = constant i32 178
+@f592 = constant float 2.500000e+00
+@k593 = constant i32 252
+@f594 = constant float 3.000000e+00
+@k595 = constant i32 326
+@f596 = constant float 3.500000e+00
+@k597 = constant i32 400
+@f598 = constant float 4.000000e+00
+@k599 = constant i32 474
+@f600 = constant float 4.500000e+00
+@k601 = constant i32 -461
+@f602 = constant float 5.000000e+00
+@k603 = constant i32 -387
+@f604 = constant float 5.500000e+00
+@k605 = constant i32 -313
+@f606 = constant float 6.000000e+00
+@k607 = constant i32 -239
+@f608 = constant float 6.500000e+00
+@k609 = constant i32 -165
+@f610 = constant float 7.000000e+00
+@k611 = constant i32 -91
+@f612 = constant float 7.500000e+00
+@k613 = constant i32 -17
+@f614 = constant float 8.000000e+00
+@k615 = constant i32 57
+@f616 = constant float 8.500000e+00
+@k617 = constant i32 131
+@f618 = constant float 9.000000e+00
+@k619 = constant i32 205
+@f620 = constant float 9.500000e+00
+@k621 = constant i32 279
+@f622 = constant float 1.000000e+01
+@k623 = constant i32 353
+@f624 = constant float 1.050000e+01
+@k625 = constant i32 427
+@f626 = constant float 1.100000e+01
+@k627 = constant i32 501
+@f628 = constant float 1.150000e+01
+@k629 = constant i32 -434
+@f630 = constant float 1.200000e+01
+@k631 = constant i32 -360
+@f632 = constant float 1.250000e+01
+@k633 = constant i32 -286
+@f634 = constant float 1.300000e+01
+@k635 = constant i32 -212
+@f636 = constant float 1.350000e+01
+@k637 = constant i32 -138
+@f638 = constant float 1.400000e+01
+@k639 = constant i32 -64
+@f640 = constant float 1.450000e+01
+@k641 = constant i32 10
+@f642 = constant float 1.500000e+01
+@k643 = constant i32 84
+@f644 = constant float 1.550000e+01
+@k645 = constant i32 158
+@f646 = constant float 1.600000e+01
+@k647 = constant i32 232
+@f648 = constant float 1.650000e+01
+@k649 = constant i32 306
+@f650 = constant float 1.700000e+01
+@k651 = constant i32 380
+@f652 = constant float 1.750000e+01
+@k653 = constant i32 454
+@f654 = constant float 1.800000e+01
+@k655 = constant i32 -481
+@f656 = constant float 1.850000e+01
+@k657 = constant i32 -407
+@f658 = constant float 1.900000e+01
+@k659 = constant i32 -333
+@f660 = constant float 1.950000e+01
+@k661 = constant i32 -259
+@f662 = constant float 2.000000e+01
+@k663 = constant i32 -185
+@f664 = constant float 2.050000e+01
+@k665 = constant i32 -111
+@f666 = constant float 2.100000e+01
+@k667 = constant i32 -37
+@f668 = constant float 2.150000e+01
+@k669 = constant i32 37
+@f670 = constant float 2.200000e+01
+@k671 = constant i32 111
+@f672 = constant float 2.250000e+01
+@k673 = constant i32 185
+@f674 = constant float 2.300000e+01
+@k675 = constant i32 259
+@f676 = constant float 2.350000e+01
+@k677 = constant i32 333
+@f678 = constant float 2.400000e+01
+@k679 = constant i32 407
+@f680 = constant float 2.500000e-01
+@k681 = constant i32 481
+@f682 = constant float 7.500000e-01
+@k683 = constant i32 -454
+@f684 = constant float 1.250000e+00
+@k685 = constant i32 -380
+@f686 = constant float 1.750000e+00
+@k687 = constant i32 -306
+@f688 = constant float 2.250000e+00
+@k689 = constant i32 -232
+@f690 = constant float 2.750000e+00
+@k691 = constant i32 -158
+@f692 = constant float 3.250000e+00
+@k693 = constant i32 -84
+@f694 = constant float 3.750000e+00
+@k695 = constant i32 -10
+@f696 = constant float 4.250000e+00
+@k697 = constant i32 64
+@f698 = constant float 4.750000e+00
+@k699 = constant i32 138
+@f700 = constant float 5.250000e+00
+@k701 = constant i32 212
+@f702 = constant float 5.750000e+00
+@k703 = constant i32 286
+@f704 = constant float 6.250000e+00
+@k705 = constant i32 360
+@f706 = constant float 6.750000e+00
+@k707 = constant i32 434
+@f708 = constant float 7.250000e+00
+@k709 = constant i32 508
+@f710 = constant float 7.750000e+00
+@k711 = constant i32 -427
+@f712 = constant float 8.250000e+00
+@k713 = constant i32 -353
+@f714 = constant float 8.750000e+00
+@k715 = constant i32 -279
+@f716 = constant float 9.250000e+00
+@k717 = constant i32 -205
+@f718 = constant float 9.750000e+00
+@k719 = constant i32 -131
+@f720 = constant float 1.025000e+01
+@k721 = constant i32 -57
+@f722 = constant float 1.075000e+01
+@k723 = constant i32 17
+@f724 = constant float 1.125000e+01
+@k725 = constant i32 91
+@f726 = constant float 1.175000e+01
+@k727 = constant i32 165
+@f728 = constant float 1.225000e+01
+@k729 = constant i32 239
+@f730 = constant float 1.275000e+01
+@k731 = constant i32 313
+@f732 = constant float 1.325000e+01
+@k733 = constant i32 387
+@f734 = constant float 1.375000e+01
+@k735 = constant i32 461
+@f736 = constant float 1.425000e+01
+@k737 = constant i32 -474
+@f738 = constant float 1.475000e+01
+@k739 = constant i32 -400
+@f740 = constant float 1.525000e+01
+@k741 = constant i32 -326
+@f742 = constant float 1.575000e+01
+@k743 = constant i32 -252
+@f744 = constant float 1.625000e+01
+@k745 = constant i32 -178
+@f746 = constant float 1.675000e+01
+@k747 = constant i32 -104
+@f748 = constant float 1.725000e+01
+@k749 = constant i32 -30
+@f750 = constant float 1.775000e+01
+@k751 = constant i32 44
+@f752 = constant float 1.825000e+01
+@k753 = constant i32 118
+@f754 = constant float 1.875000e+01
+@k755 = constant i32 192
+@f756 = constant float 1.925000e+01
+@k757 = constant i32 266
+@f758 = constant float 1.975000e+01
+@k759 = constant i32 340
+@f760 = constant float 2.025000e+01
+@k761 = constant i32 414
+@f762 = constant float 2.075000e+01
+@k763 = constant i32 488
+@f764 = constant float 2.125000e+01
+@k765 = constant i32 -447
+@f766 = constant float 2.175000e+01
+@k767 = constant i32 -373
+@f768 = constant float 2.225000e+01
+@k769 = constant i32 -299
+@f770 = constant float 2.275000e+01
+@k771 = constant i32 -225
+@f772 = constant float 2.325000e+01
+@k773 = constant i32 -151
+@f774 = constant float 2.375000e+01
+@k775 = constant i32 -77
+@f776 = constant float 0.000000e+00
+@k777 = constant i32 -3
+@f778 = constant float 5.000000e-01
+@k779 = constant i32 71
+@f780 = constant float 1.000000e+00
+@k781 = constant i32 145
+@f782 = constant float 1.500000e+00
+@k783 = constant i32 219
+@f784 = constant float 2.000000e+00
+@k785 = constant i32 293
+@f786 = constant float 2.500000e+00
+@k787 = constant i32 367
+@f788 = constant float 3.000000e+00
+@k789 = constant i32 441
+@f790 = constant float 3.500000e+00
+@k791 = constant i32 -494
+@f792 = constant float 4.000000e+00
+@k793 = constant i32 -420
+@f794 = constant float 4.500000e+00
+@k795 = constant i32 -346
+@f796 = constant float 5.000000e+00
+@k797 = constant i32 -272
+@f798 = constant float 5.500000e+00
+@k799 = constant i32 -198
+@f800 = constant float 6.000000e+00
+@k801 = constant i32 -124
+@f802 = constant float 6.500000e+00
+@k803 = constant i32 -50
+@f804 = constant float 7.000000e+00
+@k805 = constant i32 24
+@f806 = constant float 7.500000e+00
+@k807 = constant i32 98
+@f808 = constant float 8.000000e+00
+@k809 = constant i32 172
+@f810 = constant float 8.500000e+00
+@k811 = constant i32 246
+@f812 = constant float 9.000000e+00
+@k813 = constant i32 320
+@f814 = constant float 9.500000e+00
+@k815 = constant i32 394
+@f816 = constant float 1.000000e+01
+@k817 = constant i32 468
+@f818 = constant float 1.050000e+01
+@k819 = constant i32 -467
+@f820 = constant float 1.100000e+01
+@k821 = constant i32 -393
+@f822 = constant float 1.150000e+01
+@k823 = constant i32 -319
+@f824 = constant float 1.200000e+01
+@k825 = constant i32 -245
+@f826 = constant float 1.250000e+01
+@k827 = constant i32 -171
+@f828 = constant float 1.300000e+01
+@k829 = constant i32 -97
+@f830 = constant float 1.350000e+01
+@k831 = constant i32 -23
+@f832 = constant float 1.400000e+01
+@k833 = constant i32 51
+@f834 = constant float 1.450000e+01
+@k835 = constant i32 125
+@f836 = constant float 1.500000e+01
+@k837 = constant i32 199
+@f838 = constant float 1.550000e+01
+@k839 = constant i32 273
+@f840 = constant float 1.600000e+01
+@k841 = constant i32 347
+@f842 = constant float 1.650000e+01
+@k843 = constant i32 421
+@f844 = constant float 1.700000e+01
+@k845 = constant i32 495
+@f846 = constant float 1.750000e+01
+@k847 = constant i32 -440
+@f848 = constant float 1.800000e+01
+@k849 = constant i32 -366
+@f850 = constant float 1.850000e+01
+@k851 = constant i32 -292
+@f852 = constant float 1.900000e+01
+@k853 = constant i32 -218
+@f854 = constant float 1.950000e+01
+@k855 = constant i32 -144
+@f856 = constant float 2.000000e+01
+@k857 = constant i32 -70
+@f858 = constant float 2.050000e+01
+@k859 = constant i32 4
+@f860 = constant float 2.100000e+01
+@k861 = constant i32 78
+@f862 = constant float 2.150000e+01
+@k863 = constant i32 152
+@f864 = constant float 2.200000e+01
+@k865 = constant i32 226
+@f866 = constant float 2.250000e+01
+@k867 = constant i32 300
+@f868 = constant float 2.300000e+01
+@k869 = constant i32 374
+@f870 = constant float 2.350000e+01
+@k871 = constant i32 448
+@f872 = constant float 2.400000e+01
+@k873 = constant i32 -487
+@f874 = constant float 2.500000e-01
+@k875 = constant i32 -413
+@f876 = constant float 7.500000e-01
+@k877 = constant i32 -339
+@f878 = constant float 1.250000e+00
+@k879 = constant i32 -265
+@f880 = constant float 1.750000e+00
+@k881 = constant i32 -191
+@f882 = constant float 2.250000e+00
+@k883 = constant i32 -117
+@f884 = constant float 2.750000e+00
+@k885 = constant i32 -43
+@f886 = constant float 3.250000e+00
+@k887 = constant i32 31
+@f888 = constant float 3.750000e+00
+@k889 = constant i32 105
+@f890 = constant float 4.250000e+00
+@k891 = constant i32 179
+@f892 = constant float 4.750000e+00
+@k893 = constant i32 253
+@f894 = constant float 5.250000e+00
+@k895 = constant i32 327
+@f896 = constant float 5.750000e+00
+@k897 = constant i32 401
+@f898 = constant float 6.250000e+00
+@k899 = constant i32 475
+@f900 = constant float 6.750000e+00
+@k901 = constant i32 -460
+@f902 = constant float 7.250000e+00
+@k903 = constant i32 -386
+@f904 = constant float 7.750000e+00
+@k905 = constant i32 -312
+@f906 = constant float 8.250000e+00
+@k907 = constant i32 -238
+@f908 = constant float 8.750000e+00
+@k909 = constant i32 -164
+@f910 = constant float 9.250000e+00
+@k911 = constant i32 -90
+@f912 = constant float 9.750000e+00
+@k913 = constant i32 -16
+@f914 = constant float 1.025000e+01
+@k915 = constant i32 58
+@f916 = constant float 1.075000e+01
+@k917 = constant i32 132
+@f918 = constant float 1.125000e+01
+@k919 = constant i32 206
+@f920 = constant float 1.175000e+01
+@k921 = constant i32 280
+@f922 = constant float 1.225000e+01
+@k923 = constant i32 354
+@f924 = constant float 1.275000e+01
+@k925 = constant i32 428
+@f926 = constant float 1.325000e+01
+@k927 = constant i32 502
+@f928 = constant float 1.375000e+01
+@k929 = constant i32 -433
+@f930 = constant float 1.425000e+01
+@k931 = constant i32 -359
+@f932 = constant float 1.475000e+01
+@k933 = constant i32 -285
+@f934 = constant float 1.525000e+01
+@k935 = constant i32 -211
+@f936 = constant float 1.575000e+01
+@k937 = constant i32 -137
+@f938 = constant float 1.625000e+01
+@k939 = constant i32 -63
+@f940 = constant float 1.675000e+01
+@k941 = constant i32 11
+@f942 = constant float 1.725000e+01
+@k943 = constant i32 85
+@f944 = constant float 1.775000e+01
+@k945 = constant i32 159
+@f946 = constant float 1.825000e+01
+@k947 = constant i32 233
+@f948 = constant float 1.875000e+01
+@k949 = constant i32 307
+@f950 = constant float 1.925000e+01
+@k951 = constant i32 381
+@f952 = constant float 1.975000e+01
+@k953 = constant i32 455
+@f954 = constant float 2.025000e+01
+@k955 = constant i32 -480
+@f956 = constant float 2.075000e+01
+@k957 = constant i32 -406
+@f958 = constant float 2.125000e+01
+@k959 = constant i32 -332
+@f960 = constant float 2.175000e+01
+@k961 = constant i32 -258
+@f962 = constant float 2.225000e+01
+@k963 = constant i32 -184
+@f964 = constant float 2.275000e+01
+@k965 = constant i32 -110
+@f966 = constant float 2.325000e+01
+@k967 = constant i32 -36
+@f968 = constant float 2.375000e+01
+@k969 = constant i32 38
+@f970 = constant float 0.000000e+00
+@k971 = constant i32 112
+@f972 = constant float 5.000000e-01
+@k973 = constant i32 186
+@f974 = constant float 1.000000e+00
+@k975 = constant i32 260
+@f976 = constant float 1.500000e+00
+@k977 = constant i32 334
+@f978 = constant float 2.000000e+00
+@k979 = constant i32 408
+@f980 = constant float 2.500000e+00
+@k981 = constant i32 482
+@f982 = constant float 3.000000e+00
+@k983 = constant i32 -453
+@f984 = constant float 3.500000e+00
+@k985 = constant i32 -379
+@f986 = constant float 4.000000e+00
+@k987 = constant i32 -305
+@f988 = constant float 4.500000e+00
+@k989 = constant i32 -231
+@f990 = constant float 5.000000e+00
+@k991 = constant i32 -157
+@f992 = constant float 5.500000e+00
+@k993 = constant i32 -83
+@f994 = constant float 6.000000e+00
+@k995 = constant i32 -9
+@f996 = constant float 6.500000e+00
+@k997 = constant i32 65
+@f998 = constant float 7.000000e+00
+@k999 = constant i32 139
+@f1000 = constant float 7.500000e+00
+@k1001 = constant i32 213
+@f1002 = constant float 8.000000e+00
+@k1003 = constant i32 287
+@f1004 = constant float 8.500000e+00
+@k1005 = constant i32 361
+@f1006 = constant float 9.000000e+00
+@k1007 = constant i32 435
+@f1008 = constant float 9.500000e+00
+@k1009 = constant i32 -500
+@f1010 = constant float 1.000000e+01
+@k1011 = constant i32 -426
+@f1012 = constant float 1.050000e+01
+@k1013 = constant i32 -352
+@f1014 = constant float 1.100000e+01
+@k1015 = constant i32 -278
+@f1016 = constant float 1.150000e+01
+@k1017 = constant i32 -204
+@f1018 = constant float 1.200000e+01
+@k1019 = constant i32 -130
+@f1020 = constant float 1.250000e+01
+@k1021 = constant i32 -56
+@f1022 = constant float 1.300000e+01
+@k1023 = constant i32 18
+@f1024 = constant float 1.350000e+01
+@k1025 = constant i32 92
+@f1026 = constant float 1.400000e+01
+@k1027 = constant i32 166
+@f1028 = constant float 1.450000e+01
+@k1029 = constant i32 240
+@f1030 = constant float 1.500000e+01
+@k1031 = constant i32 314
+@f1032 = constant float 1.550000e+01
+@k1033 = constant i32 388
+@f1034 = constant float 1.600000e+01
+@k1035 = constant i32 462
+@f1036 = constant float 1.650000e+01
+@k1037 = constant i32 -473
+@f1038 = constant float 1.700000e+01
+@k1039 = constant i32 -399
+@f1040 = constant float 1.750000e+01
+@k1041 = constant i32 -325
+@f1042 = constant float 1.800000e+01
+@k1043 = constant i32 -251
+@f1044 = constant float 1.850000e+01
+@k1045 = constant i32 -177
+@f1046 = constant float 1.900000e+01
+@k1047 = constant i32 -103
+@f1048 = constant float 1.950000e+01
+@k1049 = constant i32 -29
+@f1050 = constant float 2.000000e+01
+@k1051 = constant i32 45
+@f1052 = constant float 2.050000e+01
+@k1053 = constant i32 119
+@f1054 = constant float 2.100000e+01
+@k1055 = constant i32 193
+@f1056 = constant float 2.150000e+01
+@k1057 = constant i32 267
+@f1058 = constant float 2.200000e+01
+@k1059 = constant i32 341
+@f1060 = constant float 2.250000e+01
+@k1061 = constant i32 415
+@f1062 = constant float 2.300000e+01
+@k1063 = constant i32 489
+@f1064 = constant float 2.350000e+01
+@k1065 = constant i32 -446
+@f1066 = constant float 2.400000e+01
+@k1067 = constant i32 -372
+@f1068 = constant float 2.500000e-01
+@k1069 = constant i32 -298
+@f1070 = constant float 7.500000e-01
+@k1071 = constant i32 -224
+@f1072 = constant float 1.250000e+00
+@k1073 = constant i32 -150
+@f1074 = constant float 1.750000e+00
+@k1075 = constant i32 -76
+@f1076 = constant float 2.250000e+00
+@k1077 = constant i32 -2
+@f1078 = constant float 2.750000e+00
+@k1079 = constant i32 72
+@f1080 = constant float 3.250000e+00
+@k1081 = constant i32 146
+@f1082 = constant float 3.750000e+00
+@k1083 = constant i32 220
+@f1084 = constant float 4.250000e+00
+@k1085 = constant i32 294
+@f1086 = constant float 4.750000e+00
+@k1087 = constant i32 368
+@f1088 = constant float 5.250000e+00
+@k1089 = constant i32 442
+@f1090 = constant float 5.750000e+00
+@k1091 = constant i32 -493
+@f1092 = constant float 6.250000e+00
+@k1093 = constant i32 -419
+@f1094 = constant float 6.750000e+00
+@k1095 = constant i32 -345
+@f1096 = constant float 7.250000e+00
+@k1097 = constant i32 -271
+@f1098 = constant float 7.750000e+00
+@k1099 = constant i32 -197
+@f1100 = constant float 8.250000e+00
+@k1101 = constant i32 -123
+@f1102 = constant float 8.750000e+00
+@k1103 = constant i32 -49
+@f1104 = constant float 9.250000e+00
+@k1105 = constant i32 25
+@f1106 = constant float 9.750000e+00
+@k1107 = constant i32 99
+@f1108 = constant float 1.025000e+01
+@k1109 = constant i32 173
+@f1110 = constant float 1.075000e+01
+@k1111 = constant i32 247
+@f1112 = constant float 1.125000e+01
+@k1113 = constant i32 321
+@f1114 = constant float 1.175000e+01
+@k1115 = constant i32 395
+@f1116 = constant float 1.225000e+01
+@k1117 = constant i32 469
+@f1118 = constant float 1.275000e+01
+@k1119 = constant i32 -466
+@f1120 = constant float 1.325000e+01
+@k1121 = constant i32 -392
+@f1122 = constant float 1.375000e+01
+@k1123 = constant i32 -318
+@f1124 = constant float 1.425000e+01
+@k1125 = constant i32 -244
+@f1126 = constant float 1.475000e+01
+@k1127 = constant i32 -170
+@f1128 = constant float 1.525000e+01
+@k1129 = constant i32 -96
+@f1130 = constant float 1.575000e+01
+@k1131 = constant i32 -22
+@f1132 = constant float 1.625000e+01
+@k1133 = constant i32 52
+@f1134 = constant float 1.675000e+01
+@k1135 = constant i32 126
+@f1136 = constant float 1.725000e+01
+@k1137 = constant i32 200
+@f1138 = constant float 1.775000e+01
+@k1139 = constant i32 274
+@f1140 = constant float 1.825000e+01
+@k1141 = constant i32 348
+@f1142 = constant float 1.875000e+01
+@k1143 = constant i32 422
+@f1144 = constant float 1.925000e+01
+@k1145 = constant i32 496
+@f1146 = constant float 1.975000e+01
+@k1147 = constant i32 -439
+@f1148 = constant float 2.025000e+01
+@k1149 = constant i32 -365
+@f1150 = constant float 2.075000e+01
+@k1151 = constant i32 -291
+@f1152 = constant float 2.125000e+01
+@k1153 = constant i32 -217
+@f1154 = constant float 2.175000e+01
+@k1155 = constant i32 -143
+@f1156 = constant float 2.225000e+01
+@k1157 = constant i32 -69
+@f1158 = constant float 2.275000e+01
+@k1159 = constant i32 5
+@f1160 = constant float 2.325000e+01
+@k1161 = constant i32 79
+@f1162 = constant float 2.375000e+01
+@k1163 = constant i32 153
+@f1164 = constant float 0.000000e+00
+@k1165 = constant i32 227
+@f1166 = constant float 5.000000e-01
+@k1167 = constant i32 301
+@f1168 = constant float 1.000000e+00
+@k1169 = constant i32 375
+@f1170 = constant float 1.500000e+00
+@k1171 = constant i32 449
+@f1172 = constant float 2.000000e+00
+@k1173 = constant i32 -486
+@f1174 = constant float 2.500000e+00
+@k1175 = constant i32 -412
+@f1176 = constant float 3.000000e+00
+@k1177 = constant i32 -338
+@f1178 = constant float 3.500000e+00
+@k1179 = constant i32 -264
+@f1180 = constant float 4.000000e+00
+@k1181 = constant i32 -190
+@f1182 = constant float 4.500000e+00
+@k1183 = constant i32 -116
+@f1184 = constant float 5.000000e+00
+@k1185 = constant i32 -42
+@f1186 = constant float 5.500000e+00
+@k1187 = constant i32 32
+@f1188 = constant float 6.000000e+00
+@k1189 = constant i32 106
+@f1190 = constant float 6.500000e+00
+@k1191 = constant i32 180
+@f1192 = constant float 7.000000e+00
+@k1193 = constant i32 254
+@f1194 = constant float 7.500000e+00
+@k1195 = constant i32 328
+@f1196 = constant float 8.000000e+00
+@k1197 = constant i32 402
+@f1198 = constant float 8.500000e+00
+@k1199 = constant i32 476
+@f1200 = constant float 9.000000e+00
+@k1201 = constant i32 -459
+@f1202 = constant float 9.500000e+00
+@k1203 = constant i32 -385
+@f1204 = constant float 1.000000e+01
+@k1205 = constant i32 -311
+@f1206 = constant float 1.050000e+01
+@k1207 = constant i32 -237
+@f1208 = constant float 1.100000e+01
+@k1209 = constant i32 -163
+@f1210 = constant float 1.150000e+01
+@k1211 = constant i32 -89
+@f1212 = constant float 1.200000e+01
+@k1213 = constant i32 -15
+@f1214 = constant float 1.250000e+01
+@k1215 = constant i32 59
+@f1216 = constant float 1.300000e+01
+@k1217 = constant i32 133
+@f1218 = constant float 1.350000e+01
+@k1219 = constant i32 207
+@f1220 = constant float 1.400000e+01
+@k1221 = constant i32 281
+@f1222 = constant float 1.450000e+01
+@k1223 = constant i32 355
+@f1224 = constant float 1.500000e+01
+@k1225 = constant i32 429
+@f1226 = constant float 1.550000e+01
+@k1227 = constant i32 503
+@f1228 = constant float 1.600000e+01
+@k1229 = constant i32 -432
+@f1230 = constant float 1.650000e+01
+@k1231 = constant i32 -358
+@f1232 = constant float 1.700000e+01
+@k1233 = constant i32 -284
+@f1234 = constant float 1.750000e+01
+@k1235 = constant i32 -210
+@f1236 = constant float 1.800000e+01
+@k1237 = constant i32 -136
+@f1238 = constant float 1.850000e+01
+@k1239 = constant i32 -62
+@f1240 = constant float 1.900000e+01
+@k1241 = constant i32 12
+@f1242 = constant float 1.950000e+01
+@k1243 = constant i32 86
+@f1244 = constant float 2.000000e+01
+@k1245 = constant i32 160
+@f1246 = constant float 2.050000e+01
+@k1247 = constant i32 234
+@f1248 = constant float 2.100000e+01
+@k1249 = constant i32 308
+@f1250 = constant float 2.150000e+01
+@k1251 = constant i32 382
+@f1252 = constant float 2.200000e+01
+@k1253 = constant i32 456
+@f1254 = constant float 2.250000e+01
+@k1255 = constant i32 -479
+@f1256 = constant float 2.300000e+01
+@k1257 = constant i32 -405
+@f1258 = constant float 2.350000e+01
+@k1259 = constant i32 -331
+@f1260 = constant float 2.400000e+01
+@k1261 = constant i32 -257
+@f1262 = constant float 2.500000e-01
+@k1263 = constant i32 -183
+@f1264 = constant float 7.500000e-01
+@k1265 = constant i32 -109
+@f1266 = constant float 1.250000e+00
+@k1267 = constant i32 -35
+@f1268 = constant float 1.750000e+00
+@k1269 = constant i32 39
+@f1270 = constant float 2.250000e+00
+@k1271 = constant i32 113
+@f1272 = constant float 2.750000e+00
+@k1273 = constant i32 187
+@f1274 = constant float 3.250000e+00
+@k1275 = constant i32 261
+@f1276 = constant float 3.750000e+00
+@k1277 = constant i32 335
+@f1278 = constant float 4.250000e+00
+@k1279 = constant i32 409
+@f1280 = constant float 4.750000e+00
+@k1281 = constant i32 483
+@f1282 = constant float 5.250000e+00
+@k1283 = constant i32 -452
+@f1284 = constant float 5.750000e+00
+@k1285 = constant i32 -378
+@f1286 = constant float 6.250000e+00
+@k1287 = constant i32 -304
+@f1288 = constant float 6.750000e+00
+@k1289 = constant i32 -230
+@f1290 = constant float 7.250000e+00
+@k1291 = constant i32 -156
+@f1292 = constant float 7.750000e+00
+@k1293 = constant i32 -82
+@f1294 = constant float 8.250000e+00
+@k1295 = constant i32 -8
+@f1296 = constant float 8.750000e+00
+@k1297 = constant i32 66
+@f1298 = constant float 9.250000e+00
+@k1299 = constant i32 140
+@f1300 = constant float 9.750000e+00
+@k1301 = constant i32 214
+@f1302 = constant float 1.025000e+01
+@k1303 = constant i32 288
+@f1304 = constant float 1.075000e+01
+@k1305 = constant i32 362
+@f1306 = constant float 1.125000e+01
+@k1307 = constant i32 436
+@f1308 = constant float 1.175000e+01
+@k1309 = constant i32 -499
+@f1310 = constant float 1.225000e+01
+@k1311 = constant i32 -425
+@f1312 = constant float 1.275000e+01
+@k1313 = constant i32 -351
+@f1314 = constant float 1.325000e+01
+@k1315 = constant i32 -277
+@f1316 = constant float 1.375000e+01
+@k1317 = constant i32 -203
+@f1318 = constant float 1.425000e+01
+@k1319 = constant i32 -129
+@f1320 = constant float 1.475000e+01
+@k1321 = constant i32 -55
+@f1322 = constant float 1.525000e+01
+@k1323 = constant i32 19
+@f1324 = constant float 1.575000e+01
+@k1325 = constant i32 93
+@f1326 = constant float 1.625000e+01
+@k1327 = constant i32 167
+@f1328 = constant float 1.675000e+01
+@k1329 = constant i32 241
+@f1330 = constant float 1.725000e+01
+@k1331 = constant i32 315
+@f1332 = constant float 1.775000e+01
+@k1333 = constant i32 389
+@f1334 = constant float 1.825000e+01
+@k1335 = constant i32 463
+@f1336 = constant float 1.875000e+01
+@k1337 = constant i32 -472
+@f1338 = constant float 1.925000e+01
+@k1339 = constant i32 -398
+@f1340 = constant float 1.975000e+01
+@k1341 = constant i32 -324
+@f1342 = constant float 2.025000e+01
+@k1343 = constant i32 -250
+@f1344 = constant float 2.075000e+01
+@k1345 = constant i32 -176
+@f1346 = constant float 2.125000e+01
+@k1347 = constant i32 -102
+@f1348 = constant float 2.175000e+01
+@k1349 = constant i32 -28
+@f1350 = constant float 2.225000e+01
+@k1351 = constant i32 46
+@f1352 = constant float 2.275000e+01
+@k1353 = constant i32 120
+@f1354 = constant float 2.325000e+01
+@k1355 = constant i32 194
+@f1356 = constant float 2.375000e+01
+@k1357 = constant i32 268
+@f1358 = constant float 0.000000e+00
+@k1359 = constant i32 342
+@f1360 = constant float 5.000000e-01
+@k1361 = constant i32 416
+@f1362 = constant float 1.000000e+00
+@k1363 = constant i32 490
+@f1364 = constant float 1.500000e+00
+@k1365 = constant i32 -445
+@f1366 = constant float 2.000000e+00
+@k1367 = constant i32 -371
+@f1368 = constant float 2.500000e+00
+@k1369 = constant i32 -297
+@f1370 = constant float 3.000000e+00
+@k1371 = constant i32 -223
+@f1372 = constant float 3.500000e+00
+@k1373 = constant i32 -149
+@f1374 = constant float 4.000000e+00
+@k1375 = constant i32 -75
+@f1376 = constant float 4.500000e+00
+@k1377 = constant i32 -1
+@f1378 = constant float 5.000000e+00
+@k1379 = constant i32 73
+@f1380 = constant float 5.500000e+00
+@k1381 = constant i32 147
+@f1382 = constant float 6.000000e+00
+@k1383 = constant i32 221
+@f1384 = constant float 6.500000e+00
+@k1385 = constant i32 295
+@f1386 = constant float 7.000000e+00
+@k1387 = constant i32 369
+@f1388 = constant float 7.500000e+00
+@k1389 = constant i32 443
+@f1390 = constant float 8.000000e+00
+@k1391 = constant i32 -492
+@f1392 = constant float 8.500000e+00
+@k1393 = constant i32 -418
+@f1394 = constant float 9.000000e+00
+@k1395 = constant i32 -344
+@f1396 = constant float 9.500000e+00
+@k1397 = constant i32 -270
+@f1398 = constant float 1.000000e+01
+@k1399 = constant i32 -196
+@f1400 = constant float 1.050000e+01
+@k1401 = constant i32 -122
+@f1402 = constant float 1.100000e+01
+@k1403 = constant i32 -48
+@f1404 = constant float 1.150000e+01
+@k1405 = constant i32 26
+@f1406 = constant float 1.200000e+01
+@k1407 = constant i32 100
+@f1408 = constant float 1.250000e+01
+@k1409 = constant i32 174
+@f1410 = constant float 1.300000e+01
+@k1411 = constant i32 248
+@f1412 = constant float 1.350000e+01
+@k1413 = constant i32 322
+@f1414 = constant float 1.400000e+01
+@k1415 = constant i32 396
+@f1416 = constant float 1.450000e+01
+@k1417 = constant i32 470
+@f1418 = constant float 1.500000e+01
+@k1419 = constant i32 -465
+@f1420 = constant float 1.550000e+01
+@k1421 = constant i32 -391
+@f1422 = constant float 1.600000e+01
+@k1423 = constant i32 -317
+@f1424 = constant float 1.650000e+01
+@k1425 = constant i32 -243
+@f1426 = constant float 1.700000e+01
+@k1427 = constant i32 -169
+@f1428 = constant float 1.750000e+01
+@k1429 = constant i32 -95
+@f1430 = constant float 1.800000e+01
+@k1431 = constant i32 -21
+@f1432 = constant float 1.850000e+01
+@k1433 = constant i32 53
+@f1434 = constant float 1.900000e+01
+@k1435 = constant i32 127
+@f1436 = constant float 1.950000e+01
+@k1437 = constant i32 201
+@f1438 = constant float 2.000000e+01
+@k1439 = constant i32 275
+@f1440 = constant float 2.050000e+01
+@k1441 = constant i32 349
+@f1442 = constant float 2.100000e+01
+@k1443 = constant i32 423
+@f1444 = constant float 2.150000e+01
+@k1445 = constant i32 497
+@f1446 = constant float 2.200000e+01
+@k1447 = constant i32 -438
+@f1448 = constant float 2.250000e+01
+@k1449 = constant i32 -364
+@f1450 = constant float 2.300000e+01
+@k1451 = constant i32 -290
+@f1452 = constant float 2.350000e+01
+@k1453 = constant i32 -216
+@f1454 = constant float 2.400000e+01
+@k1455 = constant i32 -142
+@f1456 = constant float 2.500000e-01
+@k1457 = constant i32 -68
+@f1458 = constant float 7.500000e-01
+@k1459 = constant i32 6
+@f1460 = constant float 1.250000e+00
+@k1461 = constant i32 80
+@f1462 = constant float 1.750000e+00
+@k1463 = constant i32 154
+@f1464 = constant float 2.250000e+00
+@k1465 = constant i32 228
+@f1466 = constant float 2.750000e+00
+@k1467 = constant i32 302
+@f1468 = constant float 3.250000e+00
+@k1469 = constant i32 376
+@f1470 = constant float 3.750000e+00
+@k1471 = constant i32 450
+@f1472 = constant float 4.250000e+00
+@k1473 = constant i32 -485
+@f1474 = constant float 4.750000e+00
+@k1475 = constant i32 -411
+@f1476 = constant float 5.250000e+00
+@k1477 = constant i32 -337
+@f1478 = constant float 5.750000e+00
+@k1479 = constant i32 -263
+@f1480 = constant float 6.250000e+00
+@k1481 = constant i32 -189
+@f1482 = constant float 6.750000e+00
+@k1483 = constant i32 -115
+@f1484 = constant float 7.250000e+00
+@k1485 = constant i32 -41
+@f1486 = constant float 7.750000e+00
+@k1487 = constant i32 33
+@f1488 = constant float 8.250000e+00
+@k1489 = constant i32 107
+@f1490 = constant float 8.750000e+00
+@k1491 = constant i32 181
+@f1492 = constant float 9.250000e+00
+@k1493 = constant i32 255
+@f1494 = constant float 9.750000e+00
+@k1495 = constant i32 329
+@f1496 = constant float 1.025000e+01
+@k1497 = constant i32 403
+@f1498 = constant float 1.075000e+01
+@k1499 = constant i32 477
+@f1500 = constant float 1.125000e+01
+@k1501 = constant i32 -458
+@f1502 = constant float 1.175000e+01
+@k1503 = constant i32 -384
+@f1504 = constant float 1.225000e+01
+@k1505 = constant i32 -310
+@f1506 = constant float 1.275000e+01
+@k1507 = constant i32 -236
+@f1508 = constant float 1.325000e+01
+@k1509 = constant i32 -162
+@f1510 = constant float 1.375000e+01
+@k1511 = constant i32 -88
+@f1512 = constant float 1.425000e+01
+@k1513 = constant i32 -14
+@f1514 = constant float 1.475000e+01
+@k1515 = constant i32 60
+@f1516 = constant float 1.525000e+01
+@k1517 = constant i32 134
+@f1518 = constant float 1.575000e+01
+@k1519 = constant i32 208
+@f1520 = constant float 1.625000e+01
+@k1521 = constant i32 282
+@f1522 = constant float 1.675000e+01
+@k1523 = constant i32 356
+@f1524 = constant float 1.725000e+01
+@k1525 = constant i32 430
+@f1526 = constant float 1.775000e+01
+@k1527 = constant i32 504
+@f1528 = constant float 1.825000e+01
+@k1529 = constant i32 -431
+@f1530 = constant float 1.875000e+01
+@k1531 = constant i32 -357
+@f1532 = constant float 1.925000e+01
+@k1533 = constant i32 -283
+@f1534 = constant float 1.975000e+01
+@k1535 = constant i32 -209
+@f1536 = constant float 2.025000e+01
+@k1537 = constant i32 -135
+@f1538 = constant float 2.075000e+01
+@k1539 = constant i32 -61
+@f1540 = constant float 2.125000e+01
+@k1541 = constant i32 13
+@f1542 = constant float 2.175000e+01
+@k1543 = constant i32 87
+@f1544 = constant float 2.225000e+01
+@k1545 = constant i32 161
+@f1546 = constant float 2.275000e+01
+@k1547 = constant i32 235
+@f1548 = constant float 2.325000e+01
+@k1549 = constant i32 309
+@f1550 = constant float 2.375000e+01
+@k1551 = constant i32 383
+@f1552 = constant float 0.000000e+00
+@k1553 = constant i32 457
+@f1554 = constant float 5.000000e-01
+@k1555 = constant i32 -478
+@f1556 = constant float 1.000000e+00
+@k1557 = constant i32 -404
+@f1558 = constant float 1.500000e+00
+@k1559 = constant i32 -330
+@f1560 = constant float 2.000000e+00
+@k1561 = constant i32 -256
+@f1562 = constant float 2.500000e+00
+@k1563 = constant i32 -182
+@f1564 = constant float 3.000000e+00
+@k1565 = constant i32 -108
+@f1566 = constant float 3.500000e+00
+@k1567 = constant i32 -34
+@f1568 = constant float 4.000000e+00
+@k1569 = constant i32 40
+@f1570 = constant float 4.500000e+00
+@k1571 = constant i32 114
+@f1572 = constant float 5.000000e+00
+@k1573 = constant i32 188
+@f1574 = constant float 5.500000e+00
+@k1575 = constant i32 262
+@f1576 = constant float 6.000000e+00
+@k1577 = constant i32 336
+@f1578 = constant float 6.500000e+00
+@k1579 = constant i32 410
+@f1580 = constant float 7.000000e+00
+@k1581 = constant i32 484
+@f1582 = constant float 7.500000e+00
+@k1583 = constant i32 -451
+@f1584 = constant float 8.000000e+00
+@k1585 = constant i32 -377
+@f1586 = constant float 8.500000e+00
+@k1587 = constant i32 -303
+@f1588 = constant float 9.000000e+00
+@k1589 = constant i32 -229
+@f1590 = constant float 9.500000e+00
+@k1591 = constant i32 -155
+@f1592 = constant float 1.000000e+01
+@k1593 = constant i32 -81
+@f1594 = constant float 1.050000e+01
+@k1595 = constant i32 -7
+@f1596 = constant float 1.100000e+01
+@k1597 = constant i32 67
+@f1598 = constant float 1.150000e+01
+@k1599 = constant i32 141
+@f1600 = constant float 1.200000e+01
+@k1601 = constant i32 215
+@f1602 = constant float 1.250000e+01
+@k1603 = constant i32 289
+@f1604 = constant float 1.300000e+01
+@k1605 = constant i32 363
+@f1606 = constant float 1.350000e+01
+@k1607 = constant i32 437
+@f1608 = constant float 1.400000e+01
+@k1609 = constant i32 -498
+@f1610 = constant float 1.450000e+01
+@k1611 = constant i32 -424
+@f1612 = constant float 1.500000e+01
+@k1613 = constant i32 -350
+@f1614 = constant float 1.550000e+01
+@k1615 = constant i32 -276
+@f1616 = constant float 1.600000e+01
+@k1617 = constant i32 -202
+@f1618 = constant float 1.650000e+01
+@k1619 = constant i32 -128
+@f1620 = constant float 1.700000e+01
+@k1621 = constant i32 -54
+@f1622 = constant float 1.750000e+01
+@k1623 = constant i32 20
+@f1624 = constant float 1.800000e+01
+@k1625 = constant i32 94
+@f1626 = constant float 1.850000e+01
+@k1627 = constant i32 168
+@f1628 = constant float 1.900000e+01
+@k1629 = constant i32 242
+@f1630 = constant float 1.950000e+01
+@k1631 = constant i32 316
+@f1632 = constant float 2.000000e+01
+@k1633 = constant i32 390
+@f1634 = constant float 2.050000e+01
+@k1635 = constant i32 464
+@f1636 = constant float 2.100000e+01
+@k1637 = constant i32 -471
+@f1638 = constant float 2.150000e+01
+@k1639 = constant i32 -397
+@f1640 = constant float 2.200000e+01
+@k1641 = constant i32 -323
+@f1642 = constant float 2.250000e+01
+@k1643 = constant i32 -249
+@f1644 = constant float 2.300000e+01
+@k1645 = constant i32 -175
+@f1646 = constant float 2.350000e+01
+@k1647 = constant i32 -101
+@f1648 = constant float 2.400000e+01
+@k1649 = constant i32 -27
+@f1650 = constant float 2.500000e-01
+@k1651 = constant i32 47
+@f1652 = constant float 7.500000e-01
+@k1653 = constant i32 121
+@f1654 = constant float 1.250000e+00
+@k1655 = constant i32 195
+@f1656 = constant float 1.750000e+00
+@k1657 = constant i32 269
+@f1658 = constant float 2.250000e+00
+@k1659 = constant i32 343
+@f1660 = constant float 2.750000e+00
+@k1661 = constant i32 417
+@f1662 = constant float 3.250000e+00
+@k1663 = constant i32 491
+@f1664 = constant float 3.750000e+00
+@k1665 = constant i32 -444
+@f1666 = constant float 4.250000e+00
+@k1667 = constant i32 -370
+@f1668 = constant float 4.750000e+00
+@k1669 = constant i32 -296
+@f1670 = constant float 5.250000e+00
+@k1671 = constant i32 -222
+@f1672 = constant float 5.750000e+00
+@k1673 = constant i32 -148
+@f1674 = constant float 6.250000e+00
+@k1675 = constant i32 -74
+@f1676 = constant float 6.750000e+00
+@k1677 = constant i32 0
+@f1678 = constant float 7.250000e+00
+@k1679 = constant i32 74
+@f1680 = constant float 7.750000e+00
+@k1681 = constant i32 148
+@f1682 = constant float 8.250000e+00
+@k1683 = constant i32 222
+@f1684 = constant float 8.750000e+00
+@k1685 = constant i32 296
+@f1686 = constant float 9.250000e+00
+@k1687 = constant i32 370
+@f1688 = constant float 9.750000e+00
+@k1689 = constant i32 444
+@f1690 = constant float 1.025000e+01
+@k1691 = constant i32 -491
+@f1692 = constant float 1.075000e+01
+@k1693 = constant i32 -417
+@f1694 = constant float 1.125000e+01
+@k1695 = constant i32 -343
+@f1696 = constant float 1.175000e+01
+@k1697 = constant i32 -269
+@f1698 = constant float 1.225000e+01
+@k1699 = constant i32 -195
+@f1700 = constant float 1.275000e+01
+@k1701 = constant i32 -121
+@f1702 = constant float 1.325000e+01
+@k1703 = constant i32 -47
+@f1704 = constant float 1.375000e+01
+@k1705 = constant i32 27
+@f1706 = constant float 1.425000e+01
+@k1707 = constant i32 101
+@f1708 = constant float 1.475000e+01
+@k1709 = constant i32 175
+@f1710 = constant float 1.525000e+01
+@k1711 = constant i32 249
+@f1712 = constant float 1.575000e+01
+@k1713 = constant i32 323
+@f1714 = constant float 1.625000e+01
+@k1715 = constant i32 397
+@f1716 = constant float 1.675000e+01
+@k1717 = constant i32 471
+@f1718 = constant float 1.725000e+01
+@k1719 = constant i32 -464
+@f1720 = constant float 1.775000e+01
+@k1721 = constant i32 -390
+@f1722 = constant float 1.825000e+01
+@k1723 = constant i32 -316
+@f1724 = constant float 1.875000e+01
+@k1725 = constant i32 -242
+@f1726 = constant float 1.925000e+01
+@k1727 = constant i32 -168
+@f1728 = constant float 1.975000e+01
+@k1729 = constant i32 -94
+@f1730 = constant float 2.025000e+01
+@k1731 = constant i32 -20
+@f1732 = constant float 2.075000e+01
+@k1733 = constant i32 54
+@f1734 = constant float 2.125000e+01
+@k1735 = constant i32 128
+@f1736 = constant float 2.175000e+01
+@k1737 = constant i32 202
+@f1738 = constant float 2.225000e+01
+@k1739 = constant i32 276
+@f1740 = constant float 2.275000e+01
+@k1741 = constant i32 350
+@f1742 = constant float 2.325000e+01
+@k1743 = constant i32 424
+@f1744 = constant float 2.375000e+01
+@k1745 = constant i32 498
+@f1746 = constant float 0.000000e+00
+@k1747 = constant i32 -437
+@f1748 = constant float 5.000000e-01
+@k1749 = constant i32 -363
+@f1750 = constant float 1.000000e+00
+@k1751 = constant i32 -289
+@f1752 = constant float 1.500000e+00
+@k1753 = constant i32 -215
+@f1754 = constant float 2.000000e+00
+@k1755 = constant i32 -141
+@f1756 = constant float 2.500000e+00
+@k1757 = constant i32 -67
+@f1758 = constant float 3.000000e+00
+@k1759 = constant i32 7
+@f1760 = constant float 3.500000e+00
+@k1761 = constant i32 81
+@f1762 = constant float 4.000000e+00
+@k1763 = constant i32 155
+@f1764 = constant float 4.500000e+00
+@k1765 = constant i32 229
+@f1766 = constant float 5.000000e+00
+@k1767 = constant i32 303
+@f1768 = constant float 5.500000e+00
+@k1769 = constant i32 377
+@f1770 = constant float 6.000000e+00
+@k1771 = constant i32 451
+@f1772 = constant float 6.500000e+00
+@k1773 = constant i32 -484
+@f1774 = constant float 7.000000e+00
+@k1775 = constant i32 -410
+@f1776 = constant float 7.500000e+00
+@k1777 = constant i32 -336
+@f1778 = constant float 8.000000e+00
+@k1779 = constant i32 -262
+@f1780 = constant float 8.500000e+00
+@k1781 = constant i32 -188
+@f1782 = constant float 9.000000e+00
+@k1783 = constant i32 -114
+@f1784 = constant float 9.500000e+00
+@k1785 = constant i32 -40
+@f1786 = constant float 1.000000e+01
+@k1787 = constant i32 34
+@f1788 = constant float 1.050000e+01
+@k1789 = constant i32 108
+@f1790 = constant float 1.100000e+01
+@k1791 = constant i32 182
+@f1792 = constant float 1.150000e+01
+@k1793 = constant i32 256
+@f1794 = constant float 1.200000e+01
+@k1795 = constant i32 330
+@f1796 = constant float 1.250000e+01
+@k1797 = constant i32 404
+@f1798 = constant float 1.300000e+01
+@k1799 = constant i32 478
+@f1800 = constant float 1.350000e+01
+@k1801 = constant i32 -457
+@f1802 = constant float 1.400000e+01
+@k1803 = constant i32 -383
+@f1804 = constant float 1.450000e+01
+@k1805 = constant i32 -309
+@f1806 = constant float 1.500000e+01
+@k1807 = constant i32 -235
+@f1808 = constant float 1.550000e+01
+@k1809 = constant i32 -161
+@f1810 = constant float 1.600000e+01
+@k1811 = constant i32 -87
+@f1812 = constant float 1.650000e+01
+@k1813 = constant i32 -13
+@f1814 = constant float 1.700000e+01
+@k1815 = constant i32 61
+@f1816 = constant float 1.750000e+01
+@k1817 = constant i32 135
+@f1818 = constant float 1.800000e+01
+@k1819 = constant i32 209
+@f1820 = constant float 1.850000e+01
+@k1821 = constant i32 283
+@f1822 = constant float 1.900000e+01
+@k1823 = constant i32 357
+@f1824 = constant float 1.950000e+01
+@k1825 = constant i32 431
+@f1826 = constant float 2.000000e+01
+@k1827 = constant i32 505
+@f1828 = constant float 2.050000e+01
+@k1829 = constant i32 -430
+@f1830 = constant float 2.100000e+01
+@k1831 = constant i32 -356
+@f1832 = constant float 2.150000e+01
+@k1833 = constant i32 -282
+@f1834 = constant float 2.200000e+01
+@k1835 = constant i32 -208
+@f1836 = constant float 2.250000e+01
+@k1837 = constant i32 -134
+@f1838 = constant float 2.300000e+01
+@k1839 = constant i32 -60
+@f1840 = constant float 2.350000e+01
+@k1841 = constant i32 14
+@f1842 = constant float 2.400000e+01
+@k1843 = constant i32 88
+@f1844 = constant float 2.500000e-01
+@k1845 = constant i32 162
+@f1846 = constant float 7.500000e-01
+@k1847 = constant i32 236
+@f1848 = constant float 1.250000e+00
+@k1849 = constant i32 310
+@f1850 = constant float 1.750000e+00
+@k1851 = constant i32 384
+@f1852 = constant float 2.250000e+00
+@k1853 = constant i32 458
+@f1854 = constant float 2.750000e+00
+@k1855 = constant i32 -477
+@f1856 = constant float 3.250000e+00
+@k1857 = constant i32 -403
+@f1858 = constant float 3.750000e+00
+@k1859 = constant i32 -329
+@f1860 = constant float 4.250000e+00
+@k1861 = constant i32 -255
+@f1862 = constant float 4.750000e+00
+@k1863 = constant i32 -181
+@f1864 = constant float 5.250000e+00
+@k1865 = constant i32 -107
+@f1866 = constant float 5.750000e+00
+@k1867 = constant i32 -33
+@f1868 = constant float 6.250000e+00
+@k1869 = constant i32 41
+@f1870 = constant float 6.750000e+00
+@k1871 = constant i32 115
+@f1872 = constant float 7.250000e+00
+@k1873 = constant i32 189
+@f1874 = constant float 7.750000e+00
+@k1875 = constant i32 263
+@f1876 = constant float 8.250000e+00
+@k1877 = constant i32 337
+@f1878 = constant float 8.750000e+00
+@k1879 = constant i32 411
+@f1880 = constant float 9.250000e+00
+@k1881 = constant i32 485
+@f1882 = constant float 9.750000e+00
+@k1883 = constant i32 -450
+@f1884 = constant float 1.025000e+01
+@k1885 = constant i32 -376
+@f1886 = constant float 1.075000e+01
+@k1887 = constant i32 -302
+@f1888 = constant float 1.125000e+01
+@k1889 = constant i32 -228
+@f1890 = constant float 1.175000e+01
+@k1891 = constant i32 -154
+@f1892 = constant float 1.225000e+01
+@k1893 = constant i32 -80
+@f1894 = constant float 1.275000e+01
+@k1895 = constant i32 -6
+@f1896 = constant float 1.325000e+01
+@k1897 = constant i32 68
+@f1898 = constant float 1.375000e+01
+@k1899 = constant i32 142
+@f1900 = constant float 1.425000e+01
+@k1901 = constant i32 216
+@f1902 = constant float 1.475000e+01
+@k1903 = constant i32 290
+@f1904 = constant float 1.525000e+01
+@k1905 = constant i32 364
+@f1906 = constant float 1.575000e+01
+@k1907 = constant i32 438
+@f1908 = constant float 1.625000e+01
+@k1909 = constant i32 -497
+@f1910 = constant float 1.675000e+01
+@k1911 = constant i32 -423
+@f1912 = constant float 1.725000e+01
+@k1913 = constant i32 -349
+@f1914 = constant float 1.775000e+01
+@k1915 = constant i32 -275
+@f1916 = constant float 1.825000e+01
+@k1917 = constant i32 -201
+@f1918 = constant float 1.875000e+01
+@k1919 = constant i32 -127
+@f1920 = constant float 1.925000e+01
+@k1921 = constant i32 -53
+@f1922 = constant float 1.975000e+01
+@k1923 = constant i32 21
+@f1924 = constant float 2.025000e+01
+@k1925 = constant i32 95
+@f1926 = constant float 2.075000e+01
+@k1927 = constant i32 169
+@f1928 = constant float 2.125000e+01
+@k1929 = constant i32 243
+@f1930 = constant float 2.175000e+01
+@k1931 = constant i32 317
+@f1932 = constant float 2.225000e+01
+@k1933 = constant i32 391
+@f1934 = constant float 2.275000e+01
+@k1935 = constant i32 465
+@f1936 = constant float 2.325000e+01
+@k1937 = constant i32 -470
+@f1938 = constant float 2.375000e+01
+@k1939 = constant i32 -396
+@f1940 = constant float 0.000000e+00
+@k1941 = constant i32 -322
+@f1942 = constant float 5.000000e-01
+@k1943 = constant i32 -248
+@f1944 = constant float 1.000000e+00
+@k1945 = constant i32 -174
+@f1946 = constant float 1.500000e+00
+@k1947 = constant i32 -100
+@f1948 = constant float 2.000000e+00
+@k1949 = constant i32 -26
+@f1950 = constant float 2.500000e+00
+@k1951 = constant i32 48
+@f1952 = constant float 3.000000e+00
+@k1953 = constant i32 122
+@f1954 = constant float 3.500000e+00
+@k1955 = constant i32 196
+@f1956 = constant float 4.000000e+00
+@k1957 = constant i32 270
+@f1958 = constant float 4.500000e+00
+@k1959 = constant i32 344
+@f1960 = constant float 5.000000e+00
+@k1961 = constant i32 418
+@f1962 = constant float 5.500000e+00
+@k1963 = constant i32 492
+@f1964 = constant float 6.000000e+00
+@k1965 = constant i32 -443
+@f1966 = constant float 6.500000e+00
+@k1967 = constant i32 -369
+@f1968 = constant float 7.000000e+00
+@k1969 = constant i32 -295
+@f1970 = constant float 7.500000e+00
+@k1971 = constant i32 -221
+@f1972 = constant float 8.000000e+00
+@k1973 = constant i32 -147
+@f1974 = constant float 8.500000e+00
+@k1975 = constant i32 -73
+@f1976 = constant float 9.000000e+00
+@k1977 = constant i32 1
+@f1978 = constant float 9.500000e+00
+@k1979 = constant i32 75
+@f1980 = constant float 1.000000e+01
+@k1981 = constant i32 149
+@f1982 = constant float 1.050000e+01
+@k1983 = constant i32 223
+@f1984 = constant float 1.100000e+01
+@k1985 = constant i32 297
+@f1986 = constant float 1.150000e+01
+@k1987 = constant i32 371
+@f1988 = constant float 1.200000e+01
+@k1989 = constant i32 445
+@f1990 = constant float 1.250000e+01
+@k1991 = constant i32 -490
+@f1992 = constant float 1.300000e+01
+@k1993 = constant i32 -416
+@f1994 = constant float 1.350000e+01
+@k1995 = constant i32 -342
+@f1996 = constant float 1.400000e+01
+@k1997 = constant i32 -268
+@f1998 = constant float 1.450000e+01
+@k1999 = constant i32 -194
+@f2000 = constant float 1.500000e+01
+@k2001 = constant i32 -120
+@f2002 = constant float 1.550000e+01
+@k2003 = constant i32 -46
+@f2004 = constant float 1.600000e+01
+@k2005 = constant i32 28
+@f2006 = constant float 1.650000e+01
+@k2007 = constant i32 102
+@f2008 = constant float 1.700000e+01
+@k2009 = constant i32 176
+@f2010 = constant float 1.750000e+01
+@k2011 = constant i32 250
+@f2012 = constant float 1.800000e+01
+@k2013 = constant i32 324
+@f2014 = constant float 1.850000e+01
+@k2015 = constant i32 398
+@f2016 = constant float 1.900000e+01
+@k2017 = constant i32 472
+@f2018 = constant float 1.950000e+01
+@k2019 = constant i32 -463
+@f2020 = constant float 2.000000e+01
+@k2021 = constant i32 -389
+@f2022 = constant float 2.050000e+01
+@k2023 = constant i32 -315
+@f2024 = constant float 2.100000e+01
+@k2025 = constant i32 -241
+@f2026 = constant float 2.150000e+01
+@k2027 = constant i32 -167
+@f2028 = constant float 2.200000e+01
+@k2029 = constant i32 -93
+@f2030 = constant float 2.250000e+01
+@k2031 = constant i32 -19
+@f2032 = constant float 2.300000e+01
+@k2033 = constant i32 55
+@f2034 = constant float 2.350000e+01
+@k2035 = constant i32 129
+@f2036 = constant float 2.400000e+01
+@k2037 = constant i32 203
+@f2038 = constant float 2.500000e-01
+@k2039 = constant i32 277
+@f2040 = constant float 7.500000e-01
+@k2041 = constant i32 351
+@f2042 = constant float 1.250000e+00
+@k2043 = constant i32 425
+@f2044 = constant float 1.750000e+00
+@k2045 = constant i32 499
+@f2046 = constant float 2.250000e+00
+@k2047 = constant i32 -436
+@f2048 = constant float 2.750000e+00
+@k2049 = constant i32 -362
+@f2050 = constant float 3.250000e+00
+@k2051 = constant i32 -288
+@f2052 = constant float 3.750000e+00
+@k2053 = constant i32 -214
+@f2054 = constant float 4.250000e+00
+@k2055 = constant i32 -140
+@f2056 = constant float 4.750000e+00
+@k2057 = constant i32 -66
+@f2058 = constant float 5.250000e+00
+@k2059 = constant i32 8
+@f2060 = constant float 5.750000e+00
+@k2061 = constant i32 82
+@f2062 = constant float 6.250000e+00
+@k2063 = constant i32 156
+@f2064 = constant float 6.750000e+00
+@k2065 = constant i32 230
+@f2066 = constant float 7.250000e+00
+@k2067 = constant i32 304
+@f2068 = constant float 7.750000e+00
+@k2069 = constant i32 378
+@f2070 = constant float 8.250000e+00
+@k2071 = constant i32 452
+@f2072 = constant float 8.750000e+00
+@k2073 = constant i32 -483
+@f2074 = constant float 9.250000e+00
+@k2075 = constant i32 -409
+@f2076 = constant float 9.750000e+00
+@k2077 = constant i32 -335
+@f2078 = constant float 1.025000e+01
+@k2079 = constant i32 -261
+@f2080 = constant float 1.075000e+01
+@k2081 = constant i32 -187
+@f2082 = constant float 1.125000e+01
+@k2083 = constant i32 -113
+@f2084 = constant float 1.175000e+01
+@k2085 = constant i32 -39
+@f2086 = constant float 1.225000e+01
+@k2087 = constant i32 35
+@f2088 = constant float 1.275000e+01
+@k2089 = constant i32 109
+@f2090 = constant float 1.325000e+01
+@k2091 = constant i32 183
+@f2092 = constant float 1.375000e+01
+@k2093 = constant i32 257
+@f2094 = constant float 1.425000e+01
+@k2095 = constant i32 331
+@f2096 = constant float 1.475000e+01
+@k2097 = constant i32 405
+@f2098 = constant float 1.525000e+01
+@k2099 = constant i32 479
+@f2100 = constant float 1.575000e+01
+@k2101 = constant i32 -456
+@f2102 = constant float 1.625000e+01
+@k2103 = constant i32 -382
+@f2104 = constant float 1.675000e+01
+@k2105 = constant i32 -308
+@f2106 = constant float 1.725000e+01
+@k2107 = constant i32 -234
+@f2108 = constant float 1.775000e+01
+@k2109 = constant i32 -160
+@f2110 = constant float 1.825000e+01
+@k2111 = constant i32 -86
+@f2112 = constant float 1.875000e+01
+@k2113 = constant i32 -12
+@f2114 = constant float 1.925000e+01
+@k2115 = constant i32 62
+@f2116 = constant float 1.975000e+01
+@k2117 = constant i32 136
+@f2118 = constant float 2.025000e+01
+@k2119 = constant i32 210
+@f2120 = constant float 2.075000e+01
+@k2121 = constant i32 284
+@f2122 = constant float 2.125000e+01
+@k2123 = constant i32 358
+@f2124 = constant float 2.175000e+01
+@k2125 = constant i32 432
+@f2126 = constant float 2.225000e+01
+@k2127 = constant i32 506
+@f2128 = constant float 2.275000e+01
+@k2129 = constant i32 -429
+@f2130 = constant float 2.325000e+01
+@k2131 = constant i32 -355
+@f2132 = constant float 2.375000e+01
+@k2133 = constant i32 -281
+@f2134 = constant float 0.000000e+00
+@k2135 = constant i32 -207
+@f2136 = constant float 5.000000e-01
+@k2137 = constant i32 -133
+@f2138 = constant float 1.000000e+00
+@k2139 = constant i32 -59
+@f2140 = constant float 1.500000e+00
+@k2141 = constant i32 15
+@f2142 = constant float 2.000000e+00
+@k2143 = constant i32 89
+@f2144 = constant float 2.500000e+00
+@k2145 = constant i32 163
+@f2146 = constant float 3.000000e+00
+@k2147 = constant i32 237
+@f2148 = constant float 3.500000e+00
+@k2149 = constant i32 311
+@f2150 = constant float 4.000000e+00
+@k2151 = constant i32 385
+@f2152 = constant float 4.500000e+00
+@k2153 = constant i32 459
+@f2154 = constant float 5.000000e+00
+@k2155 = constant i32 -476
+@f2156 = constant float 5.500000e+00
+@k2157 = constant i32 -402
+@f2158 = constant float 6.000000e+00
+@k2159 = constant i32 -328
+@f2160 = constant float 6.500000e+00
+@k2161 = constant i32 -254
+@f2162 = constant float 7.000000e+00
+@k2163 = constant i32 -180
+@f2164 = constant float 7.500000e+00
+@k2165 = constant i32 -106
+@f2166 = constant float 8.000000e+00
+@k2167 = constant i32 -32
+@f2168 = constant float 8.500000e+00
+@k2169 = constant i32 42
+@f2170 = constant float 9.000000e+00
+@k2171 = constant i32 116
+@f2172 = constant float 9.500000e+00
+@k2173 = constant i32 190
+@f2174 = constant float 1.000000e+01
+@k2175 = constant i32 264
+@f2176 = constant float 1.050000e+01
+@k2177 = constant i32 338
+@f2178 = constant float 1.100000e+01
+@k2179 = constant i32 412
+@f2180 = constant float 1.150000e+01
+@k2181 = constant i32 486
+@f2182 = constant float 1.200000e+01
+@k2183 = constant i32 -449
+@f2184 = constant float 1.250000e+01
+@k2185 = constant i32 -375
+@f2186 = constant float 1.300000e+01
+@k2187 = constant i32 -301
+@f2188 = constant float 1.350000e+01
+@k2189 = constant i32 -227
+@f2190 = constant float 1.400000e+01
+@k2191 = constant i32 -153
+@f2192 = constant float 1.450000e+01
+@k2193 = constant i32 -79
+@f2194 = constant float 1.500000e+01
+@k2195 = constant i32 -5
+@f2196 = constant float 1.550000e+01
+@k2197 = constant i32 69
+@f2198 = constant float 1.600000e+01
+@k2199 = constant i32 143
+@f2200 = constant float 1.650000e+01
+@k2201 = constant i32 217
+@f2202 = constant float 1.700000e+01
+@k2203 = constant i32 291
+@f2204 = constant float 1.750000e+01
+@k2205 = constant i32 365
+@f2206 = constant float 1.800000e+01
+@k2207 = constant i32 439
+@f2208 = constant float 1.850000e+01
+@k2209 = constant i32 -496
+@f2210 = constant float 1.900000e+01
+@k2211 = constant i32 -422
+@f2212 = constant float 1.950000e+01
+@k2213 = constant i32 -348
+@f2214 = constant float 2.000000e+01
+@k2215 = constant i32 -274
+@f2216 = constant float 2.050000e+01
+@k2217 = constant i32 -200
+@f2218 = constant float 2.100000e+01
+@k2219 = constant i32 -126
+@f2220 = constant float 2.150000e+01
+@k2221 = constant i32 -52
+@f2222 = constant float 2.200000e+01
+@k2223 = constant i32 22
+@f2224 = constant float 2.250000e+01
+@k2225 = constant i32 96
+@f2226 = constant float 2.300000e+01
+@k2227 = constant i32 170
+@f2228 = constant float 2.350000e+01
+@k2229 = constant i32 244
+@f2230 = constant float 2.400000e+01
+@k2231 = constant i32 318
+@f2232 = constant float 2.500000e-01
+@k2233 = constant i32 392
+@f2234 = constant float 7.500000e-01
+@k2235 = constant i32 466
+@f2236 = constant float 1.250000e+00
+@k2237 = constant i32 -469
+@f2238 = constant float 1.750000e+00
+@k2239 = constant i32 -395
+@f2240 = constant float 2.250000e+00
+@k2241 = constant i32 -321
+@f2242 = constant float 2.750000e+00
+@k2243 = constant i32 -247
+@f2244 = constant float 3.250000e+00
+@k2245 = constant i32 -173
+@f2246 = constant float 3.750000e+00
+@k2247 = constant i32 -99
+@f2248 = constant float 4.250000e+00
+@k2249 = constant i32 -25
+@f2250 = constant float 4.750000e+00
+@k2251 = constant i32 49
+@f2252 = constant float 5.250000e+00
+@k2253 = constant i32 123
+@f2254 = constant float 5.750000e+00
+@k2255 = constant i32 197
+@f2256 = constant float 6.250000e+00
+@k2257 = constant i32 271
+@f2258 = constant float 6.750000e+00
+@k2259 = constant i32 345
+@f2260 = constant float 7.250000e+00
+@k2261 = constant i32 419
+@f2262 = constant float 7.750000e+00
+@k2263 = constant i32 493
+@f2264 = constant float 8.250000e+00
+@k2265 = constant i32 -442
+@f2266 = constant float 8.750000e+00
+@k2267 = constant i32 -368
+@f2268 = constant float 9.250000e+00
+@k2269 = constant i32 -294
+@f2270 = constant float 9.750000e+00
+@k2271 = constant i32 -220
+@f2272 = constant float 1.025000e+01
+@k2273 = constant i32 -146
+@f2274 = constant float 1.075000e+01
+@k2275 = constant i32 -72
+@f2276 = constant float 1.125000e+01
+@k2277 = constant i32 2
+@f2278 = constant float 1.175000e+01
+@k2279 = constant i32 76
+@f2280 = constant float 1.225000e+01
+@k2281 = constant i32 150
+@f2282 = constant float 1.275000e+01
+@k2283 = constant i32 224
+@f2284 = constant float 1.325000e+01
+@k2285 = constant i32 298
+@f2286 = constant float 1.375000e+01
+@k2287 = constant i32 372
+@f2288 = constant float 1.425000e+01
+@k2289 = constant i32 446
+@f2290 = constant float 1.475000e+01
+@k2291 = constant i32 -489
+@f2292 = constant float 1.525000e+01
+@k2293 = constant i32 -415
+@f2294 = constant float 1.575000e+01
+@k2295 = constant i32 -341
+@f2296 = constant float 1.625000e+01
+@k2297 = constant i32 -267
+@f2298 = constant float 1.675000e+01
+@k2299 = constant i32 -193
+@f2300 = constant float 1.725000e+01
+@k2301 = constant i32 -119
+@f2302 = constant float 1.775000e+01
+@k2303 = constant i32 -45
+@f2304 = constant float 1.825000e+01
+@k2305 = constant i32 29
+@f2306 = constant float 1.875000e+01
+@k2307 = constant i32 103
+@f2308 = constant float 1.925000e+01
+@k2309 = constant i32 177
+@f2310 = constant float 1.975000e+01
+@k2311 = constant i32 251
+@f2312 = constant float 2.025000e+01
+@k2313 = constant i32 325
+@f2314 = constant float 2.075000e+01
+@k2315 = constant i32 399
+@f2316 = constant float 2.125000e+01
+@k2317 = constant i32 473
+@f2318 = constant float 2.175000e+01
+@k2319 = constant i32 -462
+@f2320 = constant float 2.225000e+01
+@k2321 = constant i32 -388
+@f2322 = constant float 2.275000e+01
+@k2323 = constant i32 -314
+@f2324 = constant float 2.325000e+01
+@k2325 = constant i32 -240
+@f2326 = constant float 2.375000e+01
+@k2327 = constant i32 -166
+@f2328 = constant float 0.000000e+00
+@k2329 = constant i32 -92
+@f2330 = constant float 5.000000e-01
+@k2331 = constant i32 -18
+@f2332 = constant float 1.000000e+00
+@k2333 = constant i32 56
+@f2334 = constant float 1.500000e+00
+@k2335 = constant i32 130
+@f2336 = constant float 2.000000e+00
+@k2337 = constant i32 204
+@f2338 = constant float 2.500000e+00
+@k2339 = constant i32 278
+@f2340 = constant float 3.000000e+00
+@k2341 = constant i32 352
+@f2342 = constant float 3.500000e+00
+@k2343 = constant i32 426
+@f2344 = constant float 4.000000e+00
+@k2345 = constant i32 500
+@f2346 = constant float 4.500000e+00
+@k2347 = constant i32 -435
+@f2348 = constant float 5.000000e+00
+@k2349 = constant i32 -361
+@f2350 = constant float 5.500000e+00
+@k2351 = constant i32 -287
+@f2352 = constant float 6.000000e+00
+@k2353 = constant i32 -213
+@f2354 = constant float 6.500000e+00
+@k2355 = constant i32 -139
+@f2356 = constant float 7.000000e+00
+@k2357 = constant i32 -65
+@f2358 = constant float 7.500000e+00
+@k2359 = constant i32 9
+@f2360 = constant float 8.000000e+00
+@k2361 = constant i32 83
+@f2362 = constant float 8.500000e+00
+@k2363 = constant i32 157
+@f2364 = constant float 9.000000e+00
+@k2365 = constant i32 231
+@f2366 = constant float 9.500000e+00
+@k2367 = constant i32 305
+@f2368 = constant float 1.000000e+01
+@k2369 = constant i32 379
+@f2370 = constant float 1.050000e+01
+@k2371 = constant i32 453
+@f2372 = constant float 1.100000e+01
+@k2373 = constant i32 -482
+@f2374 = constant float 1.150000e+01
+@k2375 = constant i32 -408
+@f2376 = constant float 1.200000e+01
+@k2377 = constant i32 -334
+@f2378 = constant float 1.250000e+01
+@k2379 = constant i32 -260
+@f2380 = constant float 1.300000e+01
+@k2381 = constant i32 -186
+@f2382 = constant float 1.350000e+01
+@k2383 = constant i32 -112
+@f2384 = constant float 1.400000e+01
+@k2385 = constant i32 -38
+@f2386 = constant float 1.450000e+01
+@k2387 = constant i32 36
+@f2388 = constant float 1.500000e+01
+@k2389 = constant i32 110
+@f2390 = constant float 1.550000e+01
+@k2391 = constant i32 184
+@f2392 = constant float 1.600000e+01
+@k2393 = constant i32 258
+@f2394 = constant float 1.650000e+01
+@k2395 = constant i32 332
+@f2396 = constant float 1.700000e+01
+@k2397 = constant i32 406
+@f2398 = constant float 1.750000e+01
+@k2399 = constant i32 480
+@f2400 = constant float 1.800000e+01
+@k2401 = constant i32 -455
+@f2402 = constant float 1.850000e+01
+@k2403 = constant i32 -381
+@f2404 = constant float 1.900000e+01
+@k2405 = constant i32 -307
+@f2406 = constant float 1.950000e+01
+@k2407 = constant i32 -233
+@f2408 = constant float 2.000000e+01
+@k2409 = constant i32 -159
+@f2410 = constant float 2.050000e+01
+@k2411 = constant i32 -85
+@f2412 = constant float 2.100000e+01
+@k2413 = constant i32 -11
+@f2414 = constant float 2.150000e+01
+@k2415 = constant i32 63
+@f2416 = constant float 2.200000e+01
+@k2417 = constant i32 137
+@f2418 = constant float 2.250000e+01
+@k2419 = constant i32 211
+@f2420 = constant float 2.300000e+01
+@k2421 = constant i32 285
+@f2422 = constant float 2.350000e+01
+@k2423 = constant i32 359
+@f2424 = constant float 2.400000e+01
+@k2425 = constant i32 433
+@f2426 = constant float 2.500000e-01
+@k2427 = constant i32 507
+@f2428 = constant float 7.500000e-01
+@k2429 = constant i32 -428
+@f2430 = constant float 1.250000e+00
+@k2431 = constant i32 -354
+@f2432 = constant float 1.750000e+00
+@k2433 = constant i32 -280
+@f2434 = constant float 2.250000e+00
+@k2435 = constant i32 -206
+@f2436 = constant float 2.750000e+00
+@k2437 = constant i32 -132
+@f2438 = constant float 3.250000e+00
+@k2439 = constant i32 -58
+@f2440 = constant float 3.750000e+00
+@k2441 = constant i32 16
+@f2442 = constant float 4.250000e+00
+@k2443 = constant i32 90
+@f2444 = constant float 4.750000e+00
+@k2445 = constant i32 164
+@f2446 = constant float 5.250000e+00
+@k2447 = constant i32 238
+@f2448 = constant float 5.750000e+00
+@k2449 = constant i32 312
+@f2450 = constant float 6.250000e+00
+@k2451 = constant i32 386
+@f2452 = constant float 6.750000e+00
+@k2453 = constant i32 460
+@f2454 = constant float 7.250000e+00
+@k2455 = constant i32 -475
+@f2456 = constant float 7.750000e+00
+@k2457 = constant i32 -401
+@f2458 = constant float 8.250000e+00
+@k2459 = constant i32 -327
+@f2460 = constant float 8.750000e+00
+@k2461 = constant i32 -253
+@f2462 = constant float 9.250000e+00
+@k2463 = constant i32 -179
+@f2464 = constant float 9.750000e+00
+@k2465 = constant i32 -105
+@f2466 = constant float 1.025000e+01
+@k2467 = constant i32 -31
+@f2468 = constant float 1.075000e+01
+@k2469 = constant i32 43
+@f2470 = constant float 1.125000e+01
+@k2471 = constant i32 117
+@f2472 = constant float 1.175000e+01
+@k2473 = constant i32 191
+@f2474 = constant float 1.225000e+01
+@k2475 = constant i32 265
+@f2476 = constant float 1.275000e+01
+@k2477 = constant i32 339
+@f2478 = constant float 1.325000e+01
+@k2479 = constant i32 413
+@f2480 = constant float 1.375000e+01
+@k2481 = constant i32 487
+@f2482 = constant float 1.425000e+01
+@k2483 = constant i32 -448
+@f2484 = constant float 1.475000e+01
+@k2485 = constant i32 -374
+@f2486 = constant float 1.525000e+01
+@k2487 = constant i32 -300
+@f2488 = constant float 1.575000e+01
+@k2489 = constant i32 -226
+@f2490 = constant float 1.625000e+01
+@k2491 = constant i32 -152
+@f2492 = constant float 1.675000e+01
+@k2493 = constant i32 -78
+@f2494 = constant float 1.725000e+01
+@k2495 = constant i32 -4
+@f2496 = constant float 1.775000e+01
+@k2497 = constant i32 70
+@f2498 = constant float 1.825000e+01
+@k2499 = constant i32 144
+@f2500 = constant float 1.875000e+01
+@k2501 = constant i32 218
+@f2502 = constant float 1.925000e+01
+@k2503 = constant i32 292
+@f2504 = constant float 1.975000e+01
+@k2505 = constant i32 366
+@f2506 = constant float 2.025000e+01
+@k2507 = constant i32 440
+@f2508 = constant float 2.075000e+01
+@k2509 = constant i32 -495
+@f2510 = constant float 2.125000e+01
+@k2511 = constant i32 -421
+@f2512 = constant float 2.175000e+01
+@k2513 = constant i32 -347
+@f2514 = constant float 2.225000e+01
+@k2515 = constant i32 -273
+@f2516 = constant float 2.275000e+01
+@k2517 = constant i32 -199
+@f2518 = constant float 2.325000e+01
+@k2519 = constant i32 -125
+@f2520 = constant float 2.375000e+01
+@k2521 = constant i32 -51
+@f2522 = constant float 0.000000e+00
+@k2523 = constant i32 23
+@f2524 = constant float 5.000000e-01
+@k2525 = constant i32 97
+@f2526 = constant float 1.000000e+00
+@k2527 = constant i32 171
+@f2528 = constant float 1.500000e+00
+@k2529 = constant i32 245
+@f2530 = constant float 2.000000e+00
+@k2531 = constant i32 319
+@f2532 = constant float 2.500000e+00
+@k2533 = constant i32 393
+@f2534 = constant float 3.000000e+00
+@k2535 = constant i32 467
+@f2536 = constant float 3.500000e+00
+@k2537 = constant i32 -468
+@f2538 = constant float 4.000000e+00
+@k2539 = constant i32 -394
+@f2540 = constant float 4.500000e+00
+@k2541 = constant i32 -320
+@f2542 = constant float 5.000000e+00
+@k2543 = constant i32 -246
+@f2544 = constant float 5.500000e+00
+@k2545 = constant i32 -172
+@f2546 = constant float 6.000000e+00
+@k2547 = constant i32 -98
+@f2548 = constant float 6.500000e+00
+@k2549 = constant i32 -24
+@f2550 = constant float 7.000000e+00
+@k2551 = constant i32 50
+@f2552 = constant float 7.500000e+00
+@k2553 = constant i32 124
+@f2554 = constant float 8.000000e+00
+@k2555 = constant i32 198
+@f2556 = constant float 8.500000e+00
+@k2557 = constant i32 272
+@f2558 = constant float 9.000000e+00
+@k2559 = constant i32 346
+@f2560 = constant float 9.500000e+00
+@k2561 = constant i32 420
+@f2562 = constant float 1.000000e+01
+@k2563 = constant i32 494
+@f2564 = constant float 1.050000e+01
+@k2565 = constant i32 -441
+@f2566 = constant float 1.100000e+01
+@k2567 = constant i32 -367
+@f2568 = constant float 1.150000e+01
+@k2569 = constant i32 -293
+@f2570 = constant float 1.200000e+01
+@k2571 = constant i32 -219
+@f2572 = constant float 1.250000e+01
+@k2573 = constant i32 -145
+@f2574 = constant float 1.300000e+01
+@k2575 = constant i32 -71
+@f2576 = constant float 1.350000e+01
+@k2577 = constant i32 3
+@f2578 = constant float 1.400000e+01
+@k2579 = constant i32 77
+@f2580 = constant float 1.450000e+01
+@k2581 = constant i32 151
+@f2582 = constant float 1.500000e+01
+@k2583 = constant i32 225
+@f2584 = constant float 1.550000e+01
+@k2585 = constant i32 299
+@f2586 = constant float 1.600000e+01
+@k2587 = constant i32 373
+@f2588 = constant float 1.650000e+01
+@k2589 = constant i32 447
+@f2590 = constant float 1.700000e+01
+@k2591 = constant i32 -488
+@f2592 = constant float 1.750000e+01
+@k2593 = constant i32 -414
+@f2594 = constant float 1.800000e+01
+@k2595 = constant i32 -340
+@f2596 = constant float 1.850000e+01
+@k2597 = constant i32 -266
+@f2598 = constant float 1.900000e+01
+@k2599 = constant i32 -192
+@f2600 = constant float 1.950000e+01
+@k2601 = constant i32 -118
+@f2602 = constant float 2.000000e+01
+@k2603 = constant i32 -44
+@f2604 = constant float 2.050000e+01
+@k2605 = constant i32 30
+@f2606 = constant float 2.100000e+01
+@k2607 = constant i32 104
+@f2608 = constant float 2.150000e+01
+@k2609 = constant i32 178
+@f2610 = constant float 2.200000e+01
+@k2611 = constant i32 252
+@f2612 = constant float 2.250000e+01
+@k2613 = constant i32 326
+@f2614 = constant float 2.300000e+01
+@k2615 = constant i32 400
+@f2616 = constant float 2.350000e+01
+@k2617 = constant i32 474
+@f2618 = constant float 2.400000e+01
+@k2619 = constant i32 -461
+@f2620 = constant float 2.500000e-01
+@k2621 = constant i32 -387
+@f2622 = constant float 7.500000e-01
+@k2623 = constant i32 -313
+@f2624 = constant float 1.250000e+00
+@k2625 = constant i32 -239
+@f2626 = constant float 1.750000e+00
+@k2627 = constant i32 -165
+@f2628 = constant float 2.250000e+00
+@k2629 = constant i32 -91
+@f2630 = constant float 2.750000e+00
+@k2631 = constant i32 -17
+@f2632 = constant float 3.250000e+00
+@k2633 = constant i32 57
+@f2634 = constant float 3.750000e+00
+@k2635 = constant i32 131
+@f2636 = constant float 4.250000e+00
+@k2637 = constant i32 205
+@f2638 = constant float 4.750000e+00
+@k2639 = constant i32 279
+@f2640 = constant float 5.250000e+00
+@k2641 = constant i32 353
+@f2642 = constant float 5.750000e+00
+@k2643 = constant i32 427
+@f2644 = constant float 6.250000e+00
+@k2645 = constant i32 501
+@f2646 = constant float 6.750000e+00
+@k2647 = constant i32 -434
+@f2648 = constant float 7.250000e+00
+@k2649 = constant i32 -360
+@f2650 = constant float 7.750000e+00
+@k2651 = constant i32 -286
+@f2652 = constant float 8.250000e+00
+@k2653 = constant i32 -212
+@f2654 = constant float 8.750000e+00
+@k2655 = constant i32 -138
+@f2656 = constant float 9.250000e+00
+@k2657 = constant i32 -64
+@f2658 = constant float 9.750000e+00
+@k2659 = constant i32 10
+@f2660 = constant float 1.025000e+01
+@k2661 = constant i32 84
+@f2662 = constant float 1.075000e+01
+@k2663 = constant i32 158
+@f2664 = constant float 1.125000e+01
+@k2665 = constant i32 232
+@f2666 = constant float 1.175000e+01
+@k2667 = constant i32 306
+@f2668 = constant float 1.225000e+01
+@k2669 = constant i32 380
+@f2670 = constant float 1.275000e+01
+@k2671 = constant i32 454
+@f2672 = constant float 1.325000e+01
+@k2673 = constant i32 -481
+@f2674 = constant float 1.375000e+01
+@k2675 = constant i32 -407
+@f2676 = constant float 1.425000e+01
+@k2677 = constant i32 -333
+@f2678 = constant float 1.475000e+01
+@k2679 = constant i32 -259
+@f2680 = constant float 1.525000e+01
+@k2681 = constant i32 -185
+@f2682 = constant float 1.575000e+01
+@k2683 = constant i32 -111
+@f2684 = constant float 1.625000e+01
+@k2685 = constant i32 -37
+@f2686 = constant float 1.675000e+01
+@k2687 = constant i32 37
+@f2688 = constant float 1.725000e+01
+@k2689 = constant i32 111
+@f2690 = constant float 1.775000e+01
+@k2691 = constant i32 185
+@f2692 = constant float 1.825000e+01
+@k2693 = constant i32 259
+@f2694 = constant float 1.875000e+01
+@k2695 = constant i32 333
+@f2696 = constant float 1.925000e+01
+@k2697 = constant i32 407
+@f2698 = constant float 1.975000e+01
+@k2699 = constant i32 481
+@f2700 = constant float 2.025000e+01
+@k2701 = constant i32 -454
+@f2702 = constant float 2.075000e+01
+@k2703 = constant i32 -380
+@f2704 = constant float 2.125000e+01
+@k2705 = constant i32 -306
+@f2706 = constant float 2.175000e+01
+@k2707 = constant i32 -232
+@f2708 = constant float 2.225000e+01
+@k2709 = constant i32 -158
+@f2710 = constant float 2.275000e+01
+@k2711 = constant i32 -84
+@f2712 = constant float 2.325000e+01
+@k2713 = constant i32 -10
+@f2714 = constant float 2.375000e+01
+@k2715 = constant i32 64
+@f2716 = constant float 0.000000e+00
+@k2717 = constant i32 138
+@f2718 = constant float 5.000000e-01
+@k2719 = constant i32 212
+@f2720 = constant float 1.000000e+00
+@k2721 = constant i32 286
+@f2722 = constant float 1.500000e+00
+@k2723 = constant i32 360
+@f2724 = constant float 2.000000e+00
+@k2725 = constant i32 434
+@f2726 = constant float 2.500000e+00
+@k2727 = constant i32 508
+@f2728 = constant float 3.000000e+00
+@k2729 = constant i32 -427
+@f2730 = constant float 3.500000e+00
+@k2731 = constant i32 -353
+@f2732 = constant float 4.000000e+00
+@k2733 = constant i32 -279
+@f2734 = constant float 4.500000e+00
+@k2735 = constant i32 -205
+@f2736 = constant float 5.000000e+00
+@k2737 = constant i32 -131
+@f2738 = constant float 5.500000e+00
+@k2739 = constant i32 -57
+@f2740 = constant float 6.000000e+00
+@k2741 = constant i32 17
+@f2742 = constant float 6.500000e+00
+@k2743 = constant i32 91
+@f2744 = constant float 7.000000e+00
+@k2745 = constant i32 165
+@f2746 = constant float 7.500000e+00
+@k2747 = constant i32 239
+@f2748 = constant float 8.000000e+00
+@k2749 = constant i32 313
+@f2750 = constant float 8.500000e+00
+@k2751 = constant i32 387
+@f2752 = constant float 9.000000e+00
+@k2753 = constant i32 461
+@f2754 = constant float 9.500000e+00
+@k2755 = constant i32 -474
+@f2756 = constant float 1.000000e+01
+@k2757 = constant i32 -400
+@f2758 = constant float 1.050000e+01
+@k2759 = constant i32 -326
+@f2760 = constant float 1.100000e+01
+@k2761 = constant i32 -252
+@f2762 = constant float 1.150000e+01
+@k2763 = constant i32 -178
+@f2764 = constant float 1.200000e+01
+@k2765 = constant i32 -104
+@f2766 = constant float 1.250000e+01
+@k2767 = constant i32 -30
+@f2768 = constant float 1.300000e+01
+@k2769 = constant i32 44
+@f2770 = constant float 1.350000e+01
+@k2771 = constant i32 118
+@f2772 = constant float 1.400000e+01
+@k2773 = constant i32 192
+@f2774 = constant float 1.450000e+01
+@k2775 = constant i32 266
+@f2776 = constant float 1.500000e+01
+@k2777 = constant i32 340
+@f2778 = constant float 1.550000e+01
+@k2779 = constant i32 414
+@f2780 = constant float 1.600000e+01
+@k2781 = constant i32 488
+@f2782 = constant float 1.650000e+01
+@k2783 = constant i32 -447
+@f2784 = constant float 1.700000e+01
+@k2785 = constant i32 -373
+@f2786 = constant float 1.750000e+01
+@k2787 = constant i32 -299
+@f2788 = constant float 1.800000e+01
+@k2789 = constant i32 -225
+@f2790 = constant float 1.850000e+01
+@k2791 = constant i32 -151
+@f2792 = constant float 1.900000e+01
+@k2793 = constant i32 -77
+@f2794 = constant float 1.950000e+01
+@k2795 = constant i32 -3
+@f2796 = constant float 2.000000e+01
+@k2797 = constant i32 71
+@f2798 = constant float 2.050000e+01
+@k2799 = constant i32 145
+@f2800 = constant float 2.100000e+01
+@k2801 = constant i32 219
+@f2802 = constant float 2.150000e+01
+@k2803 = constant i32 293
+@f2804 = constant float 2.200000e+01
+@k2805 = constant i32 367
+@f2806 = constant float 2.250000e+01
+@k2807 = constant i32 441
+@f2808 = constant float 2.300000e+01
+@k2809 = constant i32 -494
+@f2810 = constant float 2.350000e+01
+@k2811 = constant i32 -420
+@f2812 = constant float 2.400000e+01
+@k2813 = constant i32 -346
+@f2814 = constant float 2.500000e-01
+@k2815 = constant i32 -272
+@f2816 = constant float 7.500000e-01
+@k2817 = constant i32 -198
+@f2818 = constant float 1.250000e+00
+@k2819 = constant i32 -124
+@f2820 = constant float 1.750000e+00
+@k2821 = constant i32 -50
+@f2822 = constant float 2.250000e+00
+@k2823 = constant i32 24
+@f2824 = constant float 2.750000e+00
+@k2825 = constant i32 98
+@f2826 = constant float 3.250000e+00
+@k2827 = constant i32 172
+@f2828 = constant float 3.750000e+00
+@k2829 = constant i32 246
+@f2830 = constant float 4.250000e+00
+@k2831 = constant i32 320
+@f2832 = constant float 4.750000e+00
+@k2833 = constant i32 394
+@f2834 = constant float 5.250000e+00
+@k2835 = constant i32 468
+@f2836 = constant float 5.750000e+00
+@k2837 = constant i32 -467
+@f2838 = constant float 6.250000e+00
+@k2839 = constant i32 -393
+@f2840 = constant float 6.750000e+00
+@k2841 = constant i32 -319
+@f2842 = constant float 7.250000e+00
+@k2843 = constant i32 -245
+@f2844 = constant float 7.750000e+00
+@k2845 = constant i32 -171
+@f2846 = constant float 8.250000e+00
+@k2847 = constant i32 -97
+@f2848 = constant float 8.750000e+00
+@k2849 = constant i32 -23
+@f2850 = constant float 9.250000e+00
+@k2851 = constant i32 51
+@f2852 = constant float 9.750000e+00
+@k2853 = constant i32 125
+@f2854 = constant float 1.025000e+01
+@k2855 = constant i32 199
+@f2856 = constant float 1.075000e+01
+@k2857 = constant i32 273
+@f2858 = constant float 1.125000e+01
+@k2859 = constant i32 347
+@f2860 = constant float 1.175000e+01
+@k2861 = constant i32 421
+@f2862 = constant float 1.225000e+01
+@k2863 = constant i32 495
+@f2864 = constant float 1.275000e+01
+@k2865 = constant i32 -440
+@f2866 = constant float 1.325000e+01
+@k2867 = constant i32 -366
+@f2868 = constant float 1.375000e+01
+@k2869 = constant i32 -292
+@f2870 = constant float 1.425000e+01
+@k2871 = constant i32 -218
+@f2872 = constant float 1.475000e+01
+@k2873 = constant i32 -144
+@f2874 = constant float 1.525000e+01
+@k2875 = constant i32 -70
+@f2876 = constant float 1.575000e+01
+@k2877 = constant i32 4
+@f2878 = constant float 1.625000e+01
+@k2879 = constant i32 78
+@f2880 = constant float 1.675000e+01
+@k2881 = constant i32 152
+@f2882 = constant float 1.725000e+01
+@k2883 = constant i32 226
+@f2884 = constant float 1.775000e+01
+@k2885 = constant i32 300
+@f2886 = constant float 1.825000e+01
+@k2887 = constant i32 374
+@f2888 = constant float 1.875000e+01
+@k2889 = constant i32 448
+@f2890 = constant float 1.925000e+01
+@k2891 = constant i32 -487
+@f2892 = constant float 1.975000e+01
+@k2893 = constant i32 -413
+@f2894 = constant float 2.025000e+01
+@k2895 = constant i32 -339
+@f2896 = constant float 2.075000e+01
+@k2897 = constant i32 -265
+@f2898 = constant float 2.125000e+01
+@k2899 = constant i32 -191
+@f2900 = constant float 2.175000e+01
+@k2901 = constant i32 -117
+@f2902 = constant float 2.225000e+01
+@k2903 = constant i32 -43
+@f2904 = constant float 2.275000e+01
+@k2905 = constant i32 31
+@f2906 = constant float 2.325000e+01
+@k2907 = constant i32 105
+@f2908 = constant float 2.375000e+01
+@k2909 = constant i32 179
+@f2910 = constant float 0.000000e+00
+@k2911 = constant i32 253
+@f2912 = constant float 5.000000e-01
+@k2913 = constant i32 327
+@f2914 = constant float 1.000000e+00
+@k2915 = constant i32 401
+@f2916 = constant float 1.500000e+00
+@k2917 = constant i32 475
+@f2918 = constant float 2.000000e+00
+@k2919 = constant i32 -460
+@f2920 = constant float 2.500000e+00
+@k2921 = constant i32 -386
+@f2922 = constant float 3.000000e+00
+@k2923 = constant i32 -312
+@f2924 = constant float 3.500000e+00
+@k2925 = constant i32 -238
+@f2926 = constant float 4.000000e+00
+@k2927 = constant i32 -164
+@f2928 = constant float 4.500000e+00
+@k2929 = constant i32 -90
+@f2930 = constant float 5.000000e+00
+@k2931 = constant i32 -16
+@f2932 = constant float 5.500000e+00
+@k2933 = constant i32 58
+@f2934 = constant float 6.000000e+00
+@k2935 = constant i32 132
+@f2936 = constant float 6.500000e+00
+@k2937 = constant i32 206
+@f2938 = constant float 7.000000e+00
+@k2939 = constant i32 280
+@f2940 = constant float 7.500000e+00
+@k2941 = constant i32 354
+@f2942 = constant float 8.000000e+00
+@k2943 = constant i32 428
+@f2944 = constant float 8.500000e+00
+@k2945 = constant i32 502
+@f2946 = constant float 9.000000e+00
+@k2947 = constant i32 -433
+@f2948 = constant float 9.500000e+00
+@k2949 = constant i32 -359
+@f2950 = constant float 1.000000e+01
+@k2951 = constant i32 -285
+@f2952 = constant float 1.050000e+01
+@k2953 = constant i32 -211
+@f2954 = constant float 1.100000e+01
+@k2955 = constant i32 -137
+@f2956 = constant float 1.150000e+01
+@k2957 = constant i32 -63
+@f2958 = constant float 1.200000e+01
+@k2959 = constant i32 11
+@f2960 = constant float 1.250000e+01
+@k2961 = constant i32 85
+@f2962 = constant float 1.300000e+01
+@k2963 = constant i32 159
+@f2964 = constant float 1.350000e+01
+@k2965 = constant i32 233
+@f2966 = constant float 1.400000e+01
+@k2967 = constant i32 307
+@f2968 = constant float 1.450000e+01
+@k2969 = constant i32 381
+@f2970 = constant float 1.500000e+01
+@k2971 = constant i32 455
+@f2972 = constant float 1.550000e+01
+@k2973 = constant i32 -480
+@f2974 = constant float 1.600000e+01
+@k2975 = constant i32 -406
+@f2976 = constant float 1.650000e+01
+@k2977 = constant i32 -332
+@f2978 = constant float 1.700000e+01
+@k2979 = constant i32 -258
+@f2980 = constant float 1.750000e+01
+@k2981 = constant i32 -184
+@f2982 = constant float 1.800000e+01
+@k2983 = constant i32 -110
+@f2984 = constant float 1.850000e+01
+@k2985 = constant i32 -36
+@f2986 = constant float 1.900000e+01
+@k2987 = constant i32 38
+@f2988 = constant float 1.950000e+01
+@k2989 = constant i32 112
+@f2990 = constant float 2.000000e+01
+@k2991 = constant i32 186
+@f2992 = constant float 2.050000e+01
+@k2993 = constant i32 260
+@f2994 = constant float 2.100000e+01
+@k2995 = constant i32 334
+@f2996 = constant float 2.150000e+01
+@k2997 = constant i32 408
+@f2998 = constant float 2.200000e+01
+@k2999 = constant i32 482
+@f3000 = constant float 2.250000e+01
+@k3001 = constant i32 -453
+@f3002 = constant float 2.300000e+01
+@k3003 = constant i32 -379
+@f3004 = constant float 2.350000e+01
+@k3005 = constant i32 -305
+@f3006 = constant float 2.400000e+01
+@k3007 = constant i32 -231
+@f3008 = constant float 2.500000e-01
+@k3009 = constant i32 -157
+@f3010 = constant float 7.500000e-01
+@k3011 = constant i32 -83
+@f3012 = constant float 1.250000e+00
+@k3013 = constant i32 -9
+@f3014 = constant float 1.750000e+00
+@k3015 = constant i32 65
+@f3016 = constant float 2.250000e+00
+@k3017 = constant i32 139
+@f3018 = constant float 2.750000e+00
+@k3019 = constant i32 213
+@f3020 = constant float 3.250000e+00
+@k3021 = constant i32 287
+@f3022 = constant float 3.750000e+00
+@k3023 = constant i32 361
+@f3024 = constant float 4.250000e+00
+@k3025 = constant i32 435
+@f3026 = constant float 4.750000e+00
+@k3027 = constant i32 -500
+@f3028 = constant float 5.250000e+00
+@k3029 = constant i32 -426
+@f3030 = constant float 5.750000e+00
+@k3031 = constant i32 -352
+@f3032 = constant float 6.250000e+00
+@k3033 = constant i32 -278
+@f3034 = constant float 6.750000e+00
+@k3035 = constant i32 -204
+@f3036 = constant float 7.250000e+00
+@k3037 = constant i32 -130
+@f3038 = constant float 7.750000e+00
+@k3039 = constant i32 -56
+@f3040 = constant float 8.250000e+00
+@k3041 = constant i32 18
+@f3042 = constant float 8.750000e+00
+@k3043 = constant i32 92
+@f3044 = constant float 9.250000e+00
+@k3045 = constant i32 166
+@f3046 = constant float 9.750000e+00
+@k3047 = constant i32 240
+@f3048 = constant float 1.025000e+01
+@k3049 = constant i32 314
+@f3050 = constant float 1.075000e+01
+@k3051 = constant i32 388
+@f3052 = constant float 1.125000e+01
+@k3053 = constant i32 462
+@f3054 = constant float 1.175000e+01
+@k3055 = constant i32 -473
+@f3056 = constant float 1.225000e+01
+@k3057 = constant i32 -399
+@f3058 = constant float 1.275000e+01
+@k3059 = constant i32 -325
+@f3060 = constant float 1.325000e+01
+@k3061 = constant i32 -251
+@f3062 = constant float 1.375000e+01
+@k3063 = constant i32 -177
+@f3064 = constant float 1.425000e+01
+@k3065 = constant i32 -103
+@f3066 = constant float 1.475000e+01
+@k3067 = constant i32 -29
+@f3068 = constant float 1.525000e+01
+@k3069 = constant i32 45
+@f3070 = constant float 1.575000e+01
+@k3071 = constant i32 119
+@f3072 = constant float 1.625000e+01
+@k3073 = constant i32 193
+@f3074 = constant float 1.675000e+01
+@k3075 = constant i32 267
+@f3076 = constant float 1.725000e+01
+@k3077 = constant i32 341
+@f3078 = constant float 1.775000e+01
+@k3079 = constant i32 415
+@f3080 = constant float 1.825000e+01
+@k3081 = constant i32 489
+@f3082 = constant float 1.875000e+01
+@k3083 = constant i32 -446
+@f3084 = constant float 1.925000e+01
+@k3085 = constant i32 -372
+@f3086 = constant float 1.975000e+01
+@k3087 = constant i32 -298
+@f3088 = constant float 2.025000e+01
+@k3089 = constant i32 -224
+@f3090 = constant float 2.075000e+01
+@k3091 = constant i32 -150
+@f3092 = constant float 2.125000e+01
+@k3093 = constant i32 -76
+@f3094 = constant float 2.175000e+01
+@k3095 = constant i32 -2
+@f3096 = constant float 2.225000e+01
+@k3097 = constant i32 72
+@f3098 = constant float 2.275000e+01
+@k3099 = constant i32 146
+@f3100 = constant float 2.325000e+01
+@k3101 = constant i32 220
+@f3102 = constant float 2.375000e+01
+@k3103 = constant i32 294
+@f3104 = constant float 0.000000e+00
+@k3105 = constant i32 368
+@f3106 = constant float 5.000000e-01
+@k3107 = constant i32 442
+@f3108 = constant float 1.000000e+00
+@k3109 = constant i32 -493
+@f3110 = constant float 1.500000e+00
+@k3111 = constant i32 -419
+@f3112 = constant float 2.000000e+00
+@k3113 = constant i32 -345
+@f3114 = constant float 2.500000e+00
+@k3115 = constant i32 -271
+@f3116 = constant float 3.000000e+00
+@k3117 = constant i32 -197
+@f3118 = constant float 3.500000e+00
+@k3119 = constant i32 -123
+@f3120 = constant float 4.000000e+00
+@k3121 = constant i32 -49
+@f3122 = constant float 4.500000e+00
+@k3123 = constant i32 25
+@f3124 = constant float 5.000000e+00
+@k3125 = constant i32 99
+@f3126 = constant float 5.500000e+00
+@k3127 = constant i32 173
+@f3128 = constant float 6.000000e+00
+@k3129 = constant i32 247
+@f3130 = constant float 6.500000e+00
+@k3131 = constant i32 321
+@f3132 = constant float 7.000000e+00
+@k3133 = constant i32 395
+@f3134 = constant float 7.500000e+00
+@k3135 = constant i32 469
+@f3136 = constant float 8.000000e+00
+@k3137 = constant i32 -466
+@f3138 = constant float 8.500000e+00
+@k3139 = constant i32 -392
+@f3140 = constant float 9.000000e+00
+@k3141 = constant i32 -318
+@f3142 = constant float 9.500000e+00
+@k3143 = constant i32 -244
+@f3144 = constant float 1.000000e+01
+@k3145 = constant i32 -170
+@f3146 = constant float 1.050000e+01
+@k3147 = constant i32 -96
+@f3148 = constant float 1.100000e+01
+@k3149 = constant i32 -22
+@f3150 = constant float 1.150000e+01
+@k3151 = constant i32 52
+@f3152 = constant float 1.200000e+01
+@k3153 = constant i32 126
+@f3154 = constant float 1.250000e+01
+@k3155 = constant i32 200
+@f3156 = constant float 1.300000e+01
+@k3157 = constant i32 274
+@f3158 = constant float 1.350000e+01
+@k3159 = constant i32 348
+@f3160 = constant float 1.400000e+01
+@k3161 = constant i32 422
+@f3162 = constant float 1.450000e+01
+@k3163 = constant i32 496
+@f3164 = constant float 1.500000e+01
+@k3165 = constant i32 -439
+@f3166 = constant float 1.550000e+01
+@k3167 = constant i32 -365
+@f3168 = constant float 1.600000e+01
+@k3169 = constant i32 -291
+@f3170 = constant float 1.650000e+01
+@k3171 = constant i32 -217
+@f3172 = constant float 1.700000e+01
+@k3173 = constant i32 -143
+@f3174 = constant float 1.750000e+01
+@k3175 = constant i32 -69
+@f3176 = constant float 1.800000e+01
+@k3177 = constant i32 5
+@f3178 = constant float 1.850000e+01
+@k3179 = constant i32 79
+@f3180 = constant float 1.900000e+01
+@k3181 = constant i32 153
+@f3182 = constant float 1.950000e+01
+@k3183 = constant i32 227
+@f3184 = constant float 2.000000e+01
+@k3185 = constant i32 301
+@f3186 = constant float 2.050000e+01
+@k3187 = constant i32 375
+@f3188 = constant float 2.100000e+01
+@k3189 = constant i32 449
+@f3190 = constant float 2.150000e+01
+@k3191 = constant i32 -486
+@f3192 = constant float 2.200000e+01
+@k3193 = constant i32 -412
+@f3194 = constant float 2.250000e+01
+@k3195 = constant i32 -338
+@f3196 = constant float 2.300000e+01
+@k3197 = constant i32 -264
+@f3198 = constant float 2.350000e+01
+@k3199 = constant i32 -190
+@f3200 = constant float 2.400000e+01
+@k3201 = constant i32 -116
+@f3202 = constant float 2.500000e-01
+@k3203 = constant i32 -42
+@f3204 = constant float 7.500000e-01
+@k3205 = constant i32 32
+@f3206 = constant float 1.250000e+00
+@k3207 = constant i32 106
+@f3208 = constant float 1.750000e+00
+@k3209 = constant i32 180
+@f3210 = constant float 2.250000e+00
+@k3211 = constant i32 254
+@f3212 = constant float 2.750000e+00
+@k3213 = constant i32 328
+@f3214 = constant float 3.250000e+00
+@k3215 = constant i32 402
+@f3216 = constant float 3.750000e+00
+@k3217 = constant i32 476
+@f3218 = constant float 4.250000e+00
+@k3219 = constant i32 -459
+@f3220 = constant float 4.750000e+00
+@k3221 = constant i32 -385
+@f3222 = constant float 5.250000e+00
+@k3223 = constant i32 -311
+@f3224 = constant float 5.750000e+00
+@k3225 = constant i32 -237
+@f3226 = constant float 6.250000e+00
+@k3227 = constant i32 -163
+@f3228 = constant float 6.750000e+00
+@k3229 = constant i32 -89
+@f3230 = constant float 7.250000e+00
+@k3231 = constant i32 -15
+@f3232 = constant float 7.750000e+00
+@k3233 = constant i32 59
+@f3234 = constant float 8.250000e+00
+@k3235 = constant i32 133
+@f3236 = constant float 8.750000e+00
+@k3237 = constant i32 207
+@f3238 = constant float 9.250000e+00
+@k3239 = constant i32 281
+@f3240 = constant float 9.750000e+00
+@k3241 = constant i32 355
+@f3242 = constant float 1.025000e+01
+@k3243 = constant i32 429
+@f3244 = constant float 1.075000e+01
+@k3245 = constant i32 503
+@f3246 = constant float 1.125000e+01
+@k3247 = constant i32 -432
+@f3248 = constant float 1.175000e+01
+@k3249 = constant i32 -358
+@f3250 = constant float 1.225000e+01
+@k3251 = constant i32 -284
+@f3252 = constant float 1.275000e+01
+@k3253 = constant i32 -210
+@f3254 = constant float 1.325000e+01
+@k3255 = constant i32 -136
+@f3256 = constant float 1.375000e+01
+@k3257 = constant i32 -62
+@f3258 = constant float 1.425000e+01
+@k3259 = constant i32 12
+@f3260 = constant float 1.475000e+01
+@k3261 = constant i32 86
+@f3262 = constant float 1.525000e+01
+@k3263 = constant i32 160
+@f3264 = constant float 1.575000e+01
+@k3265 = constant i32 234
+@f3266 = constant float 1.625000e+01
+@k3267 = constant i32 308
+@f3268 = constant float 1.675000e+01
+@k3269 = constant i32 382
+@f3270 = constant float 1.725000e+01
+@k3271 = constant i32 456
+@f3272 = constant float 1.775000e+01
+@k3273 = constant i32 -479
+@f3274 = constant float 1.825000e+01
+@k3275 = constant i32 -405
+@f3276 = constant float 1.875000e+01
+@k3277 = constant i32 -331
+@f3278 = constant float 1.925000e+01
+@k3279 = constant i32 -257
+@f3280 = constant float 1.975000e+01
+@k3281 = constant i32 -183
+@f3282 = constant float 2.025000e+01
+@k3283 = constant i32 -109
+@f3284 = constant float 2.075000e+01
+@k3285 = constant i32 -35
+@f3286 = constant float 2.125000e+01
+@k3287 = constant i32 39
+@f3288 = constant float 2.175000e+01
+@k3289 = constant i32 113
+@f3290 = constant float 2.225000e+01
+@k3291 = constant i32 187
+@f3292 = constant float 2.275000e+01
+@k3293 = constant i32 261
+@f3294 = constant float 2.325000e+01
+@k3295 = constant i32 335
+@f3296 = constant float 2.375000e+01
+@k3297 = constant i32 409
+@f3298 = constant float 0.000000e+00
+@k3299 = constant i32 483
+@f3300 = constant float 5.000000e-01
+@k3301 = constant i32 -452
+@f3302 = constant float 1.000000e+00
+@k3303 = constant i32 -378
+@f3304 = constant float 1.500000e+00
+@k3305 = constant i32 -304
+@f3306 = constant float 2.000000e+00
+@k3307 = constant i32 -230
+@f3308 = constant float 2.500000e+00
+@k3309 = constant i32 -156
+@f3310 = constant float 3.000000e+00
+@k3311 = constant i32 -82
+@f3312 = constant float 3.500000e+00
+@k3313 = constant i32 -8
+@f3314 = constant float 4.000000e+00
+@k3315 = constant i32 66
+@f3316 = constant float 4.500000e+00
+@k3317 = constant i32 140
+@f3318 = constant float 5.000000e+00
+@k3319 = constant i32 214
+@f3320 = constant float 5.500000e+00
+@k3321 = constant i32 288
+@f3322 = constant float 6.000000e+00
+@k3323 = constant i32 362
+@f3324 = constant float 6.500000e+00
+@k3325 = constant i32 436
+@f3326 = constant float 7.000000e+00
+@k3327 = constant i32 -499
+@f3328 = constant float 7.500000e+00
+@k3329 = constant i32 -425
+@f3330 = constant float 8.000000e+00
+@k3331 = constant i32 -351
+@f3332 = constant float 8.500000e+00
+@k3333 = constant i32 -277
+@f3334 = constant float 9.000000e+00
+@k3335 = constant i32 -203
+@f3336 = constant float 9.500000e+00
+@k3337 = constant i32 -129
+@f3338 = constant float 1.000000e+01
+@k3339 = constant i32 -55
+@f3340 = constant float 1.050000e+01
+@k3341 = constant i32 19
+@f3342 = constant float 1.100000e+01
+@k3343 = constant i32 93
+@f3344 = constant float 1.150000e+01
+@k3345 = constant i32 167
+@f3346 = constant float 1.200000e+01
+@k3347 = constant i32 241
+@f3348 = constant float 1.250000e+01
+@k3349 = constant i32 315
+@f3350 = constant float 1.300000e+01
+@k3351 = constant i32 389
+@f3352 = constant float 1.350000e+01
+@k3353 = constant i32 463
+@f3354 = constant float 1.400000e+01
+@k3355 = constant i32 -472
+@f3356 = constant float 1.450000e+01
+@k3357 = constant i32 -398
+@f3358 = constant float 1.500000e+01
+@k3359 = constant i32 -324
+@f3360 = constant float 1.550000e+01
+@k3361 = constant i32 -250
+@f3362 = constant float 1.600000e+01
+@k3363 = constant i32 -176
+@f3364 = constant float 1.650000e+01
+@k3365 = constant i32 -102
+@f3366 = constant float 1.700000e+01
+@k3367 = constant i32 -28
+@f3368 = constant float 1.750000e+01
+@k3369 = constant i32 46
+@f3370 = constant float 1.800000e+01
+@k3371 = constant i32 120
+@f3372 = constant float 1.850000e+01
+@k3373 = constant i32 194
+@f3374 = constant float 1.900000e+01
+@k3375 = constant i32 268
+@f3376 = constant float 1.950000e+01
+@k3377 = constant i32 342
+@f3378 = constant float 2.000000e+01
+@k3379 = constant i32 416
+@f3380 = constant float 2.050000e+01
+@k3381 = constant i32 490
+@f3382 = constant float 2.100000e+01
+@k3383 = constant i32 -445
+@f3384 = constant float 2.150000e+01
+@k3385 = constant i32 -371
+@f3386 = constant float 2.200000e+01
+@k3387 = constant i32 -297
+@f3388 = constant float 2.250000e+01
+@k3389 = constant i32 -223
+@f3390 = constant float 2.300000e+01
+@k3391 = constant i32 -149
+@f3392 = constant float 2.350000e+01
+@k3393 = constant i32 -75
+@f3394 = constant float 2.400000e+01
+@k3395 = constant i32 -1
+@f3396 = constant float 2.500000e-01
+@k3397 = constant i32 73
+@f3398 = constant float 7.500000e-01
+@k3399 = constant i32 147
+@f3400 = constant float 1.250000e+00
+@k3401 = constant i32 221
+@f3402 = constant float 1.750000e+00
+@k3403 = constant i32 295
+@f3404 = constant float 2.250000e+00
+@k3405 = constant i32 369
+@f3406 = constant float 2.750000e+00
+@k3407 = constant i32 443
+@f3408 = constant float 3.250000e+00
+@k3409 = constant i32 -492
+@f3410 = constant float 3.750000e+00
+@k3411 = constant i32 -418
+@f3412 = constant float 4.250000e+00
+@k3413 = constant i32 -344
+@f3414 = constant float 4.750000e+00
+@k3415 = constant i32 -270
+@f3416 = constant float 5.250000e+00
+@k3417 = constant i32 -196
+@f3418 = constant float 5.750000e+00
+@k3419 = constant i32 -122
+@f3420 = constant float 6.250000e+00
+@k3421 = constant i32 -48
+@f3422 = constant float 6.750000e+00
+@k3423 = constant i32 26
+@f3424 = constant float 7.250000e+00
+@k3425 = constant i32 100
+@f3426 = constant float 7.750000e+00
+@k3427 = constant i32 174
+@f3428 = constant float 8.250000e+00
+@k3429 = constant i32 248
+@f3430 = constant float 8.750000e+00
+@k3431 = constant i32 322
+@f3432 = constant float 9.250000e+00
+@k3433 = constant i32 396
+@f3434 = constant float 9.750000e+00
+@k3435 = constant i32 470
+@f3436 = constant float 1.025000e+01
+@k3437 = constant i32 -465
+@f3438 = constant float 1.075000e+01
+@k3439 = constant i32 -391
+@f3440 = constant float 1.125000e+01
+@k3441 = constant i32 -317
+@f3442 = constant float 1.175000e+01
+@k3443 = constant i32 -243
+@f3444 = constant float 1.225000e+01
+@k3445 = constant i32 -169
+@f3446 = constant float 1.275000e+01
+@k3447 = constant i32 -95
+@f3448 = constant float 1.325000e+01
+@k3449 = constant i32 -21
+@f3450 = constant float 1.375000e+01
+@k3451 = constant i32 53
+@f3452 = constant float 1.425000e+01
+@k3453 = constant i32 127
+@f3454 = constant float 1.475000e+01
+@k3455 = constant i32 201
+@f3456 = constant float 1.525000e+01
+@k3457 = constant i32 275
+@f3458 = constant float 1.575000e+01
+@k3459 = constant i32 349
+@f3460 = constant float 1.625000e+01
+@k3461 = constant i32 423
+@f3462 = constant float 1.675000e+01
+@k3463 = constant i32 497
+@f3464 = constant float 1.725000e+01
+@k3465 = constant i32 -438
+@f3466 = constant float 1.775000e+01
+@k3467 = constant i32 -364
+@f3468 = constant float 1.825000e+01
+@k3469 = constant i32 -290
+@f3470 = constant float 1.875000e+01
+@k3471 = constant i32 -216
+@f3472 = constant float 1.925000e+01
+@k3473 = constant i32 -142
+@f3474 = constant float 1.975000e+01
+@k3475 = constant i32 -68
+@f3476 = constant float 2.025000e+01
+@k3477 = constant i32 6
+@f3478 = constant float 2.075000e+01
+@k3479 = constant i32 80
+@f3480 = constant float 2.125000e+01
+@k3481 = constant i32 154
+@f3482 = constant float 2.175000e+01
+@k3483 = constant i32 228
+@f3484 = constant float 2.225000e+01
+@k3485 = constant i32 302
+@f3486 = constant float 2.275000e+01
+@k3487 = constant i32 376
+@f3488 = constant float 2.325000e+01
+@k3489 = constant i32 450
+@f3490 = constant float 2.375000e+01
+@k3491 = constant i32 -485
+@f3492 = constant float 0.000000e+00
+@k3493 = constant i32 -411
+@f3494 = constant float 5.000000e-01
+@k3495 = constant i32 -337
+@f3496 = constant float 1.000000e+00
+@k3497 = constant i32 -263
+@f3498 = constant float 1.500000e+00
+@k3499 = constant i32 -189
+@f3500 = constant float 2.000000e+00
+@k3501 = constant i32 -115
+@f3502 = constant float 2.500000e+00
+@k3503 = constant i32 -41
+@f3504 = constant float 3.000000e+00
+@k3505 = constant i32 33
+@f3506 = constant float 3.500000e+00
+@k3507 = constant i32 107
+@f3508 = constant float 4.000000e+00
+@k3509 = constant i32 181
+@f3510 = constant float 4.500000e+00
+@k3511 = constant i32 255
+@f3512 = constant float 5.000000e+00
+@k3513 = constant i32 329
+@f3514 = constant float 5.500000e+00
+@k3515 = constant i32 403
+@f3516 = constant float 6.000000e+00
+@k3517 = constant i32 477
+@f3518 = constant float 6.500000e+00
+@k3519 = constant i32 -458
+@f3520 = constant float 7.000000e+00
+@k3521 = constant i32 -384
+@f3522 = constant float 7.500000e+00
+@k3523 = constant i32 -310
+@f3524 = constant float 8.000000e+00
+@k3525 = constant i32 -236
+@f3526 = constant float 8.500000e+00
+@k3527 = constant i32 -162
+@f3528 = constant float 9.000000e+00
+@k3529 = constant i32 -88
+@f3530 = constant float 9.500000e+00
+@k3531 = constant i32 -14
+@f3532 = constant float 1.000000e+01
+@k3533 = constant i32 60
+@f3534 = constant float 1.050000e+01
+@k3535 = constant i32 134
+@f3536 = constant float 1.100000e+01
+@k3537 = constant i32 208
+@f3538 = constant float 1.150000e+01
+@k3539 = constant i32 282
+@f3540 = constant float 1.200000e+01
+@k3541 = constant i32 356
+@f3542 = constant float 1.250000e+01
+@k3543 = constant i32 430
+@f3544 = constant float 1.300000e+01
+@k3545 = constant i32 504
+@f3546 = constant float 1.350000e+01
+@k3547 = constant i32 -431
+@f3548 = constant float 1.400000e+01
+@k3549 = constant i32 -357
+@f3550 = constant float 1.450000e+01
+@k3551 = constant i32 -283
+@f3552 = constant float 1.500000e+01
+@k3553 = constant i32 -209
+@f3554 = constant float 1.550000e+01
+@k3555 = constant i32 -135
+@f3556 = constant float 1.600000e+01
+@k3557 = constant i32 -61
+@f3558 = constant float 1.650000e+01
+@k3559 = constant i32 13
+@f3560 = constant float 1.700000e+01
+@k3561 = constant i32 87
+@f3562 = constant float 1.750000e+01
+@k3563 = constant i32 161
+@f3564 = constant float 1.800000e+01
+@k3565 = constant i32 235
+@f3566 = constant float 1.850000e+01
+@k3567 = constant i32 309
+@f3568 = constant float 1.900000e+01
+@k3569 = constant i32 383
+@f3570 = constant float 1.950000e+01
+@k3571 = constant i32 457
+@f3572 = constant float 2.000000e+01
+@k3573 = constant i32 -478
+@f3574 = constant float 2.050000e+01
+@k3575 = constant i32 -404
+@f3576 = constant float 2.100000e+01
+@k3577 = constant i32 -330
+@f3578 = constant float 2.150000e+01
+@k3579 = constant i32 -256
+@f3580 = constant float 2.200000e+01
+@k3581 = constant i32 -182
+@f3582 = constant float 2.250000e+01
+@k3583 = constant i32 -108
+@f3584 = constant float 2.300000e+01
+@k3585 = constant i32 -34
+@f3586 = constant float 2.350000e+01
+@k3587 = constant i32 40
+@f3588 = constant float 2.400000e+01
+@k3589 = constant i32 114
+@f3590 = constant float 2.500000e-01
+@k3591 = constant i32 188
+@f3592 = constant float 7.500000e-01
+@k3593 = constant i32 262
+@f3594 = constant float 1.250000e+00
+@k3595 = constant i32 336
+@f3596 = constant float 1.750000e+00
+@k3597 = constant i32 410
+@f3598 = constant float 2.250000e+00
+@k3599 = constant i32 484
+@f3600 = constant float 2.750000e+00
+@k3601 = constant i32 -451
+@f3602 = constant float 3.250000e+00
+@k3603 = constant i32 -377
+@f3604 = constant float 3.750000e+00
+@k3605 = constant i32 -303
+@f3606 = constant float 4.250000e+00
+@k3607 = constant i32 -229
+@f3608 = constant float 4.750000e+00
+@k3609 = constant i32 -155
+@f3610 = constant float 5.250000e+00
+@k3611 = constant i32 -81
+@f3612 = constant float 5.750000e+00
+@k3613 = constant i32 -7
+@f3614 = constant float 6.250000e+00
+@k3615 = constant i32 67
+@f3616 = constant float 6.750000e+00
+@k3617 = constant i32 141
+@f3618 = constant float 7.250000e+00
+@k3619 = constant i32 215
+@f3620 = constant float 7.750000e+00
+@k3621 = constant i32 289
+@f3622 = constant float 8.250000e+00
+@k3623 = constant i32 363
+@f3624 = constant float 8.750000e+00
+@k3625 = constant i32 437
+@f3626 = constant float 9.250000e+00
+@k3627 = constant i32 -498
+@f3628 = constant float 9.750000e+00
+@k3629 = constant i32 -424
+@f3630 = constant float 1.025000e+01
+@k3631 = constant i32 -350
+@f3632 = constant float 1.075000e+01
+@k3633 = constant i32 -276
+@f3634 = constant float 1.125000e+01
+@k3635 = constant i32 -202
+@f3636 = constant float 1.175000e+01
+@k3637 = constant i32 -128
+@f3638 = constant float 1.225000e+01
+@k3639 = constant i32 -54
+@f3640 = constant float 1.275000e+01
+@k3641 = constant i32 20
+@f3642 = constant float 1.325000e+01
+@k3643 = constant i32 94
+@f3644 = constant float 1.375000e+01
+@k3645 = constant i32 168
+@f3646 = constant float 1.425000e+01
+@k3647 = constant i32 242
+@f3648 = constant float 1.475000e+01
+@k3649 = constant i32 316
+@f3650 = constant float 1.525000e+01
+@k3651 = constant i32 390
+@f3652 = constant float 1.575000e+01
+@k3653 = constant i32 464
+@f3654 = constant float 1.625000e+01
+@k3655 = constant i32 -471
+@f3656 = constant float 1.675000e+01
+@k3657 = constant i32 -397
+@f3658 = constant float 1.725000e+01
+@k3659 = constant i32 -323
+@f3660 = constant float 1.775000e+01
+@k3661 = constant i32 -249
+@f3662 = constant float 1.825000e+01
+@k3663 = constant i32 -175
+@f3664 = constant float 1.875000e+01
+@k3665 = constant i32 -101
+@f3666 = constant float 1.925000e+01
+@k3667 = constant i32 -27
+@f3668 = constant float 1.975000e+01
+@k3669 = constant i32 47
+@f3670 = constant float 2.025000e+01
+@k3671 = constant i32 121
+@f3672 = constant float 2.075000e+01
+@k3673 = constant i32 195
+@f3674 = constant float 2.125000e+01
+@k3675 = constant i32 269
+@f3676 = constant float 2.175000e+01
+@k3677 = constant i32 343
+@f3678 = constant float 2.225000e+01
+@k3679 = constant i32 417
+@f3680 = constant float 2.275000e+01
+@k3681 = constant i32 491
+@f3682 = constant float 2.325000e+01
+@k3683 = constant i32 -444
+@f3684 = constant float 2.375000e+01
+@k3685 = constant i32 -370
+@f3686 = constant float 0.000000e+00
+@k3687 = constant i32 -296
+@f3688 = constant float 5.000000e-01
+@k3689 = constant i32 -222
+@f3690 = constant float 1.000000e+00
+@k3691 = constant i32 -148
+@f3692 = constant float 1.500000e+00
+@k3693 = constant i32 -74
+@f3694 = constant float 2.000000e+00
+@k3695 = constant i32 0
+@f3696 = constant float 2.500000e+00
+@k3697 = constant i32 74
+@f3698 = constant float 3.000000e+00
+@k3699 = constant i32 148
+@f3700 = constant float 3.500000e+00
+@k3701 = constant i32 222
+@f3702 = constant float 4.000000e+00
+@k3703 = constant i32 296
+@f3704 = constant float 4.500000e+00
+@k3705 = constant i32 370
+@f3706 = constant float 5.000000e+00
+@k3707 = constant i32 444
+@f3708 = constant float 5.500000e+00
+@k3709 = constant i32 -491
+@f3710 = constant float 6.000000e+00
+@k3711 = constant i32 -417
+@f3712 = constant float 6.500000e+00
+@k3713 = constant i32 -343
+@f3714 = constant float 7.000000e+00
+@k3715 = constant i32 -269
+@f3716 = constant float 7.500000e+00
+@k3717 = constant i32 -195
+@f3718 = constant float 8.000000e+00
+@k3719 = constant i32 -121
+@f3720 = constant float 8.500000e+00
+@k3721 = constant i32 -47
+@f3722 = constant float 9.000000e+00
+@k3723 = constant i32 27
+@f3724 = constant float 9.500000e+00
+@k3725 = constant i32 101
+@f3726 = constant float 1.000000e+01
+@k3727 = constant i32 175
+@f3728 = constant float 1.050000e+01
+@k3729 = constant i32 249
+@f3730 = constant float 1.100000e+01
+@k3731 = constant i32 323
+@f3732 = constant float 1.150000e+01
+@k3733 = constant i32 397
+@f3734 = constant float 1.200000e+01
+@k3735 = constant i32 471
+@f3736 = constant float 1.250000e+01
+@k3737 = constant i32 -464
+@f3738 = constant float 1.300000e+01
+@k3739 = constant i32 -390
+@f3740 = constant float 1.350000e+01
+@k3741 = constant i32 -316
+@f3742 = constant float 1.400000e+01
+@k3743 = constant i32 -242
+@f3744 = constant float 1.450000e+01
+@k3745 = constant i32 -168
+@f3746 = constant float 1.500000e+01
+@k3747 = constant i32 -94
+@f3748 = constant float 1.550000e+01
+@k3749 = constant i32 -20
+@f3750 = constant float 1.600000e+01
+@k3751 = constant i32 54
+@f3752 = constant float 1.650000e+01
+@k3753 = constant i32 128
+@f3754 = constant float 1.700000e+01
+@k3755 = constant i32 202
+@f3756 = constant float 1.750000e+01
+@k3757 = constant i32 276
+@f3758 = constant float 1.800000e+01
+@k3759 = constant i32 350
+@f3760 = constant float 1.850000e+01
+@k3761 = constant i32 424
+@f3762 = constant float 1.900000e+01
+@k3763 = constant i32 498
+@f3764 = constant float 1.950000e+01
+@k3765 = constant i32 -437
+@f3766 = constant float 2.000000e+01
+@k3767 = constant i32 -363
+@f3768 = constant float 2.050000e+01
+@k3769 = constant i32 -289
+@f3770 = constant float 2.100000e+01
+@k3771 = constant i32 -215
+@f3772 = constant float 2.150000e+01
+@k3773 = constant i32 -141
+@f3774 = constant float 2.200000e+01
+@k3775 = constant i32 -67
+@f3776 = constant float 2.250000e+01
+@k3777 = constant i32 7
+@f3778 = constant float 2.300000e+01
+@k3779 = constant i32 81
+@f3780 = constant float 2.350000e+01
+@k3781 = constant i32 155
+@f3782 = constant float 2.400000e+01
+@k3783 = constant i32 229
+@f3784 = constant float 2.500000e-01
+@k3785 = constant i32 303
+@f3786 = constant float 7.500000e-01
+@k3787 = constant i32 377
+@f3788 = constant float 1.250000e+00
+@k3789 = constant i32 451
+@f3790 = constant float 1.750000e+00
+@k3791 = constant i32 -484
+@f3792 = constant float 2.250000e+00
+@k3793 = constant i32 -410
+@f3794 = constant float 2.750000e+00
+@k3795 = constant i32 -336
+@f3796 = constant float 3.250000e+00
+@k3797 = constant i32 -262
+@f3798 = constant float 3.750000e+00
+@k3799 = constant i32 -188
+@f3800 = constant float 4.250000e+00
+@k3801 = constant i32 -114
+@f3802 = constant float 4.750000e+00
+@k3803 = constant i32 -40
+@f3804 = constant float 5.250000e+00
+@k3805 = constant i32 34
+@f3806 = constant float 5.750000e+00
+@k3807 = constant i32 108
+@f3808 = constant float 6.250000e+00
+@k3809 = constant i32 182
+@f3810 = constant float 6.750000e+00
+@k3811 = constant i32 256
+@f3812 = constant float 7.250000e+00
+@k3813 = constant i32 330
+@f3814 = constant float 7.750000e+00
+@k3815 = constant i32 404
+@f3816 = constant float 8.250000e+00
+@k3817 = constant i32 478
+@f3818 = constant float 8.750000e+00
+@k3819 = constant i32 -457
+@f3820 = constant float 9.250000e+00
+@k3821 = constant i32 -383
+@f3822 = constant float 9.750000e+00
+@k3823 = constant i32 -309
+@f3824 = constant float 1.025000e+01
+@k3825 = constant i32 -235
+@f3826 = constant float 1.075000e+01
+@k3827 = constant i32 -161
+@f3828 = constant float 1.125000e+01
+@k3829 = constant i32 -87
+@f3830 = constant float 1.175000e+01
+@k3831 = constant i32 -13
+@f3832 = constant float 1.225000e+01
+@k3833 = constant i32 61
+@f3834 = constant float 1.275000e+01
+@k3835 = constant i32 135
+@f3836 = constant float 1.325000e+01
+@k3837 = constant i32 209
+@f3838 = constant float 1.375000e+01
+@k3839 = constant i32 283
+@f3840 = constant float 1.425000e+01
+@k3841 = constant i32 357
+@f3842 = constant float 1.475000e+01
+@k3843 = constant i32 431
+@f3844 = constant float 1.525000e+01
+@k3845 = constant i32 505
+@f3846 = constant float 1.575000e+01
+@k3847 = constant i32 -430
+@f3848 = constant float 1.625000e+01
+@k3849 = constant i32 -356
+@f3850 = constant float 1.675000e+01
+@k3851 = constant i32 -282
+@f3852 = constant float 1.725000e+01
+@k3853 = constant i32 -208
+@f3854 = constant float 1.775000e+01
+@k3855 = constant i32 -134
+@f3856 = constant float 1.825000e+01
+@k3857 = constant i32 -60
+@f3858 = constant float 1.875000e+01
+@k3859 = constant i32 14
+@f3860 = constant float 1.925000e+01
+@k3861 = constant i32 88
+@f3862 = constant float 1.975000e+01
+@k3863 = constant i32 162
+@f3864 = constant float 2.025000e+01
+@k3865 = constant i32 236
+@f3866 = constant float 2.075000e+01
+@k3867 = constant i32 310
+@f3868 = constant float 2.125000e+01
+@k3869 = constant i32 384
+@f3870 = constant float 2.175000e+01
+@k3871 = constant i32 458
+@f3872 = constant float 2.225000e+01
+@k3873 = constant i32 -477
+@f3874 = constant float 2.275000e+01
+@k3875 = constant i32 -403
+@f3876 = constant float 2.325000e+01
+@k3877 = constant i32 -329
+@f3878 = constant float 2.375000e+01
+@k3879 = constant i32 -255
+@f3880 = constant float 0.000000e+00
+@k3881 = constant i32 -181
+@f3882 = constant float 5.000000e-01
+@k3883 = constant i32 -107
+@f3884 = constant float 1.000000e+00
+@k3885 = constant i32 -33
+@f3886 = constant float 1.500000e+00
+@k3887 = constant i32 41
+@f3888 = constant float 2.000000e+00
+@k3889 = constant i32 115
+@f3890 = constant float 2.500000e+00
+@k3891 = constant i32 189
+@f3892 = constant float 3.000000e+00
+@k3893 = constant i32 263
+@f3894 = constant float 3.500000e+00
+@k3895 = constant i32 337
+@f3896 = constant float 4.000000e+00
+@k3897 = constant i32 411
+@f3898 = constant float 4.500000e+00
+@k3899 = constant i32 485
+@f3900 = constant float 5.000000e+00
+@k3901 = constant i32 -450
+@f3902 = constant float 5.500000e+00
+@k3903 = constant i32 -376
+@f3904 = constant float 6.000000e+00
+@k3905 = constant i32 -302
+@f3906 = constant float 6.500000e+00
+@k3907 = constant i32 -228
+@f3908 = constant float 7.000000e+00
+@k3909 = constant i32 -154
+@f3910 = constant float 7.500000e+00
+@k3911 = constant i32 -80
+@f3912 = constant float 8.000000e+00
+@k3913 = constant i32 -6
+@f3914 = constant float 8.500000e+00
+@k3915 = constant i32 68
+@f3916 = constant float 9.000000e+00
+@k3917 = constant i32 142
+@f3918 = constant float 9.500000e+00
+@k3919 = constant i32 216
+@f3920 = constant float 1.000000e+01
+@k3921 = constant i32 290
+@f3922 = constant float 1.050000e+01
+@k3923 = constant i32 364
+@f3924 = constant float 1.100000e+01
+@k3925 = constant i32 438
+@f3926 = constant float 1.150000e+01
+@k3927 = constant i32 -497
+@f3928 = constant float 1.200000e+01
+@k3929 = constant i32 -423
+@f3930 = constant float 1.250000e+01
+@k3931 = constant i32 -349
+@f3932 = constant float 1.300000e+01
+@k3933 = constant i32 -275
+@f3934 = constant float 1.350000e+01
+@k3935 = constant i32 -201
+@f3936 = constant float 1.400000e+01
+@k3937 = constant i32 -127
+@f3938 = constant float 1.450000e+01
+@k3939 = constant i32 -53
+@f3940 = constant float 1.500000e+01
+@k3941 = constant i32 21
+@f3942 = constant float 1.550000e+01
+@k3943 = constant i32 95
+@f3944 = constant float 1.600000e+01
+@k3945 = constant i32 169
+@f3946 = constant float 1.650000e+01
+@k3947 = constant i32 243
+@f3948 = constant float 1.700000e+01
+@k3949 = constant i32 317
+@f3950 = constant float 1.750000e+01
+@k3951 = constant i32 391
+@f3952 = constant float 1.800000e+01
+@k3953 = constant i32 465
+@f3954 = constant float 1.850000e+01
+@k3955 = constant i32 -470
+@f3956 = constant float 1.900000e+01
+@k3957 = constant i32 -396
+@f3958 = constant float 1.950000e+01
+@k3959 = constant i32 -322
+@f3960 = constant float 2.000000e+01
+@k3961 = constant i32 -248
+@f3962 = constant float 2.050000e+01
+@k3963 = constant i32 -174
+@f3964 = constant float 2.100000e+01
+@k3965 = constant i32 -100
+@f3966 = constant float 2.150000e+01
+@k3967 = constant i32 -26
+@f3968 = constant float 2.200000e+01
+@k3969 = constant i32 48
+@f3970 = constant float 2.250000e+01
+@k3971 = constant i32 122
+@f3972 = constant float 2.300000e+01
+@k3973 = constant i32 196
+@f3974 = constant float 2.350000e+01
+@k3975 = constant i32 270
+@f3976 = constant float 2.400000e+01
+@k3977 = constant i32 344
+@f3978 = constant float 2.500000e-01
+@k3979 = constant i32 418
+@f3980 = constant float 7.500000e-01
+@k3981 = constant i32 492
+@f3982 = constant float 1.250000e+00
+@k3983 = constant i32 -443
+@f3984 = constant float 1.750000e+00
+@k3985 = constant i32 -369
+@f3986 = constant float 2.250000e+00
+@k3987 = constant i32 -295
+@f3988 = constant float 2.750000e+00
+@k3989 = constant i32 -221
+@f3990 = constant float 3.250000e+00
+@k3991 = constant i32 -147
+@f3992 = constant float 3.750000e+00
+@k3993 = constant i32 -73
+@f3994 = constant float 4.250000e+00
+@k3995 = constant i32 1
+@f3996 = constant float 4.750000e+00
+@k3997 = constant i32 75
+@f3998 = constant float 5.250000e+00
+@k3999 = constant i32 149
+@table = constant [1024 x float] zeroinitializer
+
+define float @use_globals(i32 %i) {
+entry:
+  %lf0 = load float, float* @f0
+  %li0 = load i32, i32* @k1
+  %cf0 = sitofp i32 %li0 to float
+  %p0 = fmul float %lf0, %cf0
+  %acc0 = fadd float 0.000000e+00, %p0
+  %lf2 = load float, float* @f2
+  %li2 = load i32, i32* @k3
+  %cf2 = sitofp i32 %li2 to float
+  %p2 = fmul float %lf2, %cf2
+  %acc2 = fadd float %acc0, %p2
+  %lf4 = load float, float* @f4
+  %li4 = load i32, i32* @k5
+  %cf4 = sitofp i32 %li4 to float
+  %p4 = fmul float %lf4, %cf4
+  %acc4 = fadd float %acc2, %p4
+  %lf6 = load float, float* @f6
+  %li6 = load i32, i32* @k7
+  %cf6 = sitofp i32 %li6 to float
+  %p6 = fmul float %lf6, %cf6
+  %acc6 = fadd float %acc4, %p6
+  %lf8 = load float, float* @f8
+  %li8 = load i32, i32* @k9
+  %cf8 = sitofp i32 %li8 to float
+  %p8 = fmul float %lf8, %cf8
+  %acc8 = fadd float %acc6, %p8
+  %lf10 = load float, float* @f10
+  %li10 = load i32, i32* @k11
+  %cf10 = sitofp i32 %li10 to float
+  %p10 = fmul float %lf10, %cf10
+  %acc10 = fadd float %acc8, %p10
+  %lf12 = load float, float* @f12
+  %li12 = load i32, i32* @k13
+  %cf12 = sitofp i32 %li12 to float
+  %p12 = fmul float %lf12, %cf12
+  %acc12 = fadd float %acc10, %p12
+  %lf14 = load float, float* @f14
+  %li14 = load i32, i32* @k15
+  %cf14 = sitofp i32 %li14 to float
+  %p14 = fmul float %lf14, %cf14
+  %acc14 = fadd float %acc12, %p14
+  %lf16 = load float, float* @f16
+  %li16 = load i32, i32* @k17
+  %cf16 = sitofp i32 %li16 to float
+  %p16 = fmul float %lf16, %cf16
+  %acc16 = fadd float %acc14, %p16
+  %lf18 = load float, float* @f18
+  %li18 = load i32, i32* @k19
+  %cf18 = sitofp i32 %li18 to float
+  %p18 = fmul float %lf18, %cf18
+  %acc18 = fadd float %acc16, %p18
+  %lf20 = load float, float* @f20
+  %li20 = load i32, i32* @k21
+  %cf20 = sitofp i32 %li20 to float
+  %p20 = fmul float %lf20, %cf20
+  %acc20 = fadd float %acc18, %p20
+  %lf22 = load float, float* @f22
+  %li22 = load i32, i32* @k23
+  %cf22 = sitofp i32 %li22 to float
+  %p22 = fmul float %lf22, %cf22
+  %acc22 = fadd float %acc20, %p22
+  %lf24 = load float, float* @f24
+  %li24 = load i32, i32* @k25
+  %cf24 = sitofp i32 %li24 to float
+  %p24 = fmul float %lf24, %cf24
+  %acc24 = fadd float %acc22, %p24
+  %lf26 = load float, float* @f26
+  %li26 = load i32, i32* @k27
+  %cf26 = sitofp i32 %li26 to float
+  %p26 = fmul float %lf26, %cf26
+  %acc26 = fadd float %acc24, %p26
+  %lf28 = load float, float* @f28
+  %li28 = load i32, i32* @k29
+  %cf28 = sitofp i32 %li28 to float
+  %p28 = fmul float %lf28, %cf28
+  %acc28 = fadd float %acc26, %p28
+  %lf30 = load float, float* @f30
+  %li30 = load i32, i32* @k31
+  %cf30 = sitofp i32 %li30 to float
+  %p30 = fmul float %lf30, %cf30
+  %acc30 = fadd float %acc28, %p30
+  %lf32 = load float, float* @f32
+  %li32 = load i32, i32* @k33
+  %cf32 = sitofp i32 %li32 to float
+  %p32 = fmul float %lf32, %cf32
+  %acc32 = fadd float %acc30, %p32
+  %lf34 = load float, float* @f34
+  %li34 = load i32, i32* @k35
+  %cf34 = sitofp i32 %li34 to float
+  %p34 = fmul float %lf34, %cf34
+  %acc34 = fadd float %acc32, %p34
+  %lf36 = load float, float* @f36
+  %li36 = load i32, i32* @k37
+  %cf36 = sitofp i32 %li36 to float
+  %p36 = fmul float %lf36, %cf36
+  %acc36 = fadd float %acc34, %p36
+  %lf38 = load float, float* @f38
+  %li38 = load i32, i32* @k39
+  %cf38 = sitofp i32 %li38 to float
+  %p38 = fmul float %lf38, %cf38
+  %acc38 = fadd float %acc36, %p38
+  %lf40 = load float, float* @f40
+  %li40 = load i32, i32* @k41
+  %cf40 = sitofp i32 %li40 to float
+  %p40 = fmul float %lf40, %cf40
+  %acc40 = fadd float %acc38, %p40
+  %lf42 = load float, float* @f42
+  %li42 = load i32, i32* @k43
+  %cf42 = sitofp i32 %li42 to float
+  %p42 = fmul float %lf42, %cf42
+  %acc42 = fadd float %acc40, %p42
+  %lf44 = load float, float* @f44
+  %li44 = load i32, i32* @k45
+  %cf44 = sitofp i32 %li44 to float
+  %p44 = fmul float %lf44, %cf44
+  %acc44 = fadd float %acc42, %p44
+  %lf46 = load float, float* @f46
+  %li46 = load i32, i32* @k47
+  %cf46 = sitofp i32 %li46 to float
+  %p46 = fmul float %lf46, %cf46
+  %acc46 = fadd float %acc44, %p46
+  %lf48 = load float, float* @f48
+  %li48 = load i32, i32* @k49
+  %cf48 = sitofp i32 %li48 to float
+  %p48 = fmul float %lf48, %cf48
+  %acc48 = fadd float %acc46, %p48
+  %lf50 = load float, float* @f50
+  %li50 = load i32, i32* @k51
+  %cf50 = sitofp i32 %li50 to float
+  %p50 = fmul float %lf50, %cf50
+  %acc50 = fadd float %acc48, %p50
+  %lf52 = load float, float* @f52
+  %li52 = load i32, i32* @k53
+  %cf52 = sitofp i32 %li52 to float
+  %p52 = fmul float %lf52, %cf52
+  %acc52 = fadd float %acc50, %p52
+  %lf54 = load float, float* @f54
+  %li54 = load i32, i32* @k55
+  %cf54 = sitofp i32 %li54 to float
+  %p54 = fmul float %lf54, %cf54
+  %acc54 = fadd float %acc52, %p54
+  %lf56 = load float, float* @f56
+  %li56 = load i32, i32* @k57
+  %cf56 = sitofp i32 %li56 to float
+  %p56 = fmul float %lf56, %cf56
+  %acc56 = fadd float %acc54, %p56
+  %lf58 = load float, float* @f58
+  %li58 = load i32, i32* @k59
+  %cf58 = sitofp i32 %li58 to float
+  %p58 = fmul float %lf58, %cf58
+  %acc58 = fadd float %acc56, %p58
+  %lf60 = load float, float* @f60
+  %li60 = load i32, i32* @k61
+  %cf60 = sitofp i32 %li60 to float
+  %p60 = fmul float %lf60, %cf60
+  %acc60 = fadd float %acc58, %p60
+  %lf62 = load float, float* @f62
+  %li62 = load i32, i32* @k63
+  %cf62 = sitofp i32 %li62 to float
+  %p62 = fmul float %lf62, %cf62
+  %acc62 = fadd float %acc60, %p62
+  %lf64 = load float, float* @f64
+  %li64 = load i32, i32* @k65
+  %cf64 = sitofp i32 %li64 to float
+  %p64 = fmul float %lf64, %cf64
+  %acc64 = fadd float %acc62, %p64
+  %lf66 = load float, float* @f66
+  %li66 = load i32, i32* @k67
+  %cf66 = sitofp i32 %li66 to float
+  %p66 = fmul float %lf66, %cf66
+  %acc66 = fadd float %acc64, %p66
+  %lf68 = load float, float* @f68
+  %li68 = load i32, i32* @k69
+  %cf68 = sitofp i32 %li68 to float
+  %p68 = fmul float %lf68, %cf68
+  %acc68 = fadd float %acc66, %p68
+  %lf70 = load float, float* @f70
+  %li70 = load i32, i32* @k71
+  %cf70 = sitofp i32 %li70 to float
+  %p70 = fmul float %lf70, %cf70
+  %acc70 = fadd float %acc68, %p70
+  %lf72 = load float, float* @f72
+  %li72 = load i32, i32* @k73
+  %cf72 = sitofp i32 %li72 to float
+  %p72 = fmul float %lf72, %cf72
+  %acc72 = fadd float %acc70, %p72
+  %lf74 = load float, float* @f74
+  %li74 = load i32, i32* @k75
+  %cf74 = sitofp i32 %li74 to float
+  %p74 = fmul float %lf74, %cf74
+  %acc74 = fadd float %acc72, %p74
+  %lf76 = load float, float* @f76
+  %li76 = load i32, i32* @k77
+  %cf76 = sitofp i32 %li76 to float
+  %p76 = fmul float %lf76, %cf76
+  %acc76 = fadd float %acc74, %p76
+  %lf78 = load float, float* @f78
+  %li78 = load i32, i32* @k79
+  %cf78 = sitofp i32 %li78 to float
+  %p78 = fmul float %lf78, %cf78
+  %acc78 = fadd float %acc76, %p78
+  %lf80 = load float, float* @f80
+  %li80 = load i32, i32* @k81
+  %cf80 = sitofp i32 %li80 to float
+  %p80 = fmul float %lf80, %cf80
+  %acc80 = fadd float %acc78, %p80
+  %lf82 = load float, float* @f82
+  %li82 = load i32, i32* @k83
+  %cf82 = sitofp i32 %li82 to float
+  %p82 = fmul float %lf82, %cf82
+  %acc82 = fadd float %acc80, %p82
+  %lf84 = load float, float* @f84
+  %li84 = load i32, i32* @k85
+  %cf84 = sitofp i32 %li84 to float
+  %p84 = fmul float %lf84, %cf84
+  %acc84 = fadd float %acc82, %p84
+  %lf86 = load float, float* @f86
+  %li86 = load i32, i32* @k87
+  %cf86 = sitofp i32 %li86 to float
+  %p86 = fmul float %lf86, %cf86
+  %acc86 = fadd float %acc84, %p86
+  %lf88 = load float, float* @f88
+  %li88 = load i32, i32* @k89
+  %cf88 = sitofp i32 %li88 to float
+  %p88 = fmul float %lf88, %cf88
+  %acc88 = fadd float %acc86, %p88
+  %lf90 = load float, float* @f90
+  %li90 = load i32, i32* @k91
+  %cf90 = sitofp i32 %li90 to float
+  %p90 = fmul float %lf90, %cf90
+  %acc90 = fadd float %acc88, %p90
+  %lf92 = load float, float* @f92
+  %li92 = load i32, i32* @k93
+  %cf92 = sitofp i32 %li92 to float
+  %p92 = fmul float %lf92, %cf92
+  %acc92 = fadd float %acc90, %p92
+  %lf94 = load float, float* @f94
+  %li94 = load i32, i32* @k95
+  %cf94 = sitofp i32 %li94 to float
+  %p94 = fmul float %lf94, %cf94
+  %acc94 = fadd float %acc92, %p94
+  %lf96 = load float, float* @f96
+  %li96 = load i32, i32* @k97
+  %cf96 = sitofp i32 %li96 to float
+  %p96 = fmul float %lf96, %cf96
+  %acc96 = fadd float %acc94, %p96
+  %lf98 = load float, float* @f98
+  %li98 = load i32, i32* @k99
+  %cf98 = sitofp i32 %li98 to float
+  %p98 = fmul float %lf98, %cf98
+  %acc98 = fadd float %acc96, %p98
+  %lf100 = load float, float* @f100
+  %li100 = load i32, i32* @k101
+  %cf100 = sitofp i32 %li100 to float
+  %p100 = fmul float %lf100, %cf100
+  %acc100 = fadd float %acc98, %p100
+  %lf102 = load float, float* @f102
+  %li102 = load i32, i32* @k103
+  %cf102 = sitofp i32 %li102 to float
+  %p102 = fmul float %lf102, %cf102
+  %acc102 = fadd float %acc100, %p102
+  %lf104 = load float, float* @f104
+  %li104 = load i32, i32* @k105
+  %cf104 = sitofp i32 %li104 to float
+  %p104 = fmul float %lf104, %cf104
+  %acc104 = fadd float %acc102, %p104
+  %lf106 = load float, float* @f106
+  %li106 = load i32, i32* @k107
+  %cf106 = sitofp i32 %li106 to float
+  %p106 = fmul float %lf106, %cf106
+  %acc106 = fadd float %acc104, %p106
+  %lf108 = load float, float* @f108
+  %li108 = load i32, i32* @k109
+  %cf108 = sitofp i32 %li108 to float
+  %p108 = fmul float %lf108, %cf108
+  %acc108 = fadd float %acc106, %p108
+  %lf110 = load float, float* @f110
+  %li110 = load i32, i32* @k111
+  %cf110 = sitofp i32 %li110 to float
+  %p110 = fmul float %lf110, %cf110
+  %acc110 = fadd float %acc108, %p110
+  %lf112 = load float, float* @f112
+  %li112 = load i32, i32* @k113
+  %cf112 = sitofp i32 %li112 to float
+  %p112 = fmul float %lf112, %cf112
+  %acc112 = fadd float %acc110, %p112
+  %lf114 = load float, float* @f114
+  %li114 = load i32, i32* @k115
+  %cf114 = sitofp i32 %li114 to float
+  %p114 = fmul float %lf114, %cf114
+  %acc114 = fadd float %acc112, %p114
+  %lf116 = load float, float* @f116
+  %li116 = load i32, i32* @k117
+  %cf116 = sitofp i32 %li116 to float
+  %p116 = fmul float %lf116, %cf116
+  %acc116 = fadd float %acc114, %p116
+  %lf118 = load float, float* @f118
+  %li118 = load i32, i32* @k119
+  %cf118 = sitofp i32 %li118 to float
+  %p118 = fmul float %lf118, %cf118
+  %acc118 = fadd float %acc116, %p118
+  %lf120 = load float, float* @f120
+  %li120 = load i32, i32* @k121
+  %cf120 = sitofp i32 %li120 to float
+  %p120 = fmul float %lf120, %cf120
+  %acc120 = fadd float %acc118, %p120
+  %lf122 = load float, float* @f122
+  %li122 = load i32, i32* @k123
+  %cf122 = sitofp i32 %li122 to float
+  %p122 = fmul float %lf122, %cf122
+  %acc122 = fadd float %acc120, %p122
+  %lf124 = load float, float* @f124
+  %li124 = load i32, i32* @k125
+  %cf124 = sitofp i32 %li124 to float
+  %p124 = fmul float %lf124, %cf124
+  %acc124 = fadd float %acc122, %p124
+  %lf126 = load float, float* @f126
+  %li126 = load i32, i32* @k127
+  %cf126 = sitofp i32 %li126 to float
+  %p126 = fmul float %lf126, %cf126
+  %acc126 = fadd float %acc124, %p126
+  %lf128 = load float, float* @f128
+  %li128 = load i32, i32* @k129
+  %cf128 = sitofp i32 %li128 to float
+  %p128 = fmul float %lf128, %cf128
+  %acc128 = fadd float %acc126, %p128
+  %lf130 = load float, float* @f130
+  %li130 = load i32, i32* @k131
+  %cf130 = sitofp i32 %li130 to float
+  %p130 = fmul float %lf130, %cf130
+  %acc130 = fadd float %acc128, %p130
+  %lf132 = load float, float* @f132
+  %li132 = load i32, i32* @k133
+  %cf132 = sitofp i32 %li132 to float
+  %p132 = fmul float %lf132, %cf132
+  %acc132 = fadd float %acc130, %p132
+  %lf134 = load float, float* @f134
+  %li134 = load i32, i32* @k135
+  %cf134 = sitofp i32 %li134 to float
+  %p134 = fmul float %lf134, %cf134
+  %acc134 = fadd float %acc132, %p134
+  %lf136 = load float, float* @f136
+  %li136 = load i32, i32* @k137
+  %cf136 = sitofp i32 %li136 to float
+  %p136 = fmul float %lf136, %cf136
+  %acc136 = fadd float %acc134, %p136
+  %lf138 = load float, float* @f138
+  %li138 = load i32, i32* @k139
+  %cf138 = sitofp i32 %li138 to float
+  %p138 = fmul float %lf138, %cf138
+  %acc138 = fadd float %acc136, %p138
+  %lf140 = load float, float* @f140
+  %li140 = load i32, i32* @k141
+  %cf140 = sitofp i32 %li140 to float
+  %p140 = fmul float %lf140, %cf140
+  %acc140 = fadd float %acc138, %p140
+  %lf142 = load float, float* @f142
+  %li142 = load i32, i32* @k143
+  %cf142 = sitofp i32 %li142 to float
+  %p142 = fmul float %lf142, %cf142
+  %acc142 = fadd float %acc140, %p142
+  %lf144 = load float, float* @f144
+  %li144 = load i32, i32* @k145
+  %cf144 = sitofp i32 %li144 to float
+  %p144 = fmul float %lf144, %cf144
+  %acc144 = fadd float %acc142, %p144
+  %lf146 = load float, float* @f146
+  %li146 = load i32, i32* @k147
+  %cf146 = sitofp i32 %li146 to float
+  %p146 = fmul float %lf146, %cf146
+  %acc146 = fadd float %acc144, %p146
+  %lf148 = load float, float* @f148
+  %li148 = load i32, i32* @k149
+  %cf148 = sitofp i32 %li148 to float
+  %p148 = fmul float %lf148, %cf148
+  %acc148 = fadd float %acc146, %p148
+  %lf150 = load float, float* @f150
+  %li150 = load i32, i32* @k151
+  %cf150 = sitofp i32 %li150 to float
+  %p150 = fmul float %lf150, %cf150
+  %acc150 = fadd float %acc148, %p150
+  %lf152 = load float, float* @f152
+  %li152 = load i32, i32* @k153
+  %cf152 = sitofp i32 %li152 to float
+  %p152 = fmul float %lf152, %cf152
+  %acc152 = fadd float %acc150, %p152
+  %lf154 = load float, float* @f154
+  %li154 = load i32, i32* @k155
+  %cf154 = sitofp i32 %li154 to float
+  %p154 = fmul float %lf154, %cf154
+  %acc154 = fadd float %acc152, %p154
+  %lf156 = load float, float* @f156
+  %li156 = load i32, i32* @k157
+  %cf156 = sitofp i32 %li156 to float
+  %p156 = fmul float %lf156, %cf156
+  %acc156 = fadd float %acc154, %p156
+  %lf158 = load float, float* @f158
+  %li158 = load i32, i32* @k159
+  %cf158 = sitofp i32 %li158 to float
+  %p158 = fmul float %lf158, %cf158
+  %acc158 = fadd float %acc156, %p158
+  %lf160 = load float, float* @f160
+  %li160 = load i32, i32* @k161
+  %cf160 = sitofp i32 %li160 to float
+  %p160 = fmul float %lf160, %cf160
+  %acc160 = fadd float %acc158, %p160
+  %lf162 = load float, float* @f162
+  %li162 = load i32, i32* @k163
+  %cf162 = sitofp i32 %li162 to float
+  %p162 = fmul float %lf162, %cf162
+  %acc162 = fadd float %acc160, %p162
+  %lf164 = load float, float* @f164
+  %li164 = load i32, i32* @k165
+  %cf164 = sitofp i32 %li164 to float
+  %p164 = fmul float %lf164, %cf164
+  %acc164 = fadd float %acc162, %p164
+  %lf166 = load float, float* @f166
+  %li166 = load i32, i32* @k167
+  %cf166 = sitofp i32 %li166 to float
+  %p166 = fmul float %lf166, %cf166
+  %acc166 = fadd float %acc164, %p166
+  %lf168 = load float, float* @f168
+  %li168 = load i32, i32* @k169
+  %cf168 = sitofp i32 %li168 to float
+  %p168 = fmul float %lf168, %cf168
+  %acc168 = fadd float %acc166, %p168
+  %lf170 = load float, float* @f170
+  %li170 = load i32, i32* @k171
+  %cf170 = sitofp i32 %li170 to float
+  %p170 = fmul float %lf170, %cf170
+  %acc170 = fadd float %acc168, %p170
+  %lf172 = load float, float* @f172
+  %li172 = load i32, i32* @k173
+  %cf172 = sitofp i32 %li172 to float
+  %p172 = fmul float %lf172, %cf172
+  %acc172 = fadd float %acc170, %p172
+  %lf174 = load float, float* @f174
+  %li174 = load i32, i32* @k175
+  %cf174 = sitofp i32 %li174 to float
+  %p174 = fmul float %lf174, %cf174
+  %acc174 = fadd float %acc172, %p174
+  %lf176 = load float, float* @f176
+  %li176 = load i32, i32* @k177
+  %cf176 = sitofp i32 %li176 to float
+  %p176 = fmul float %lf176, %cf176
+  %acc176 = fadd float %acc174, %p176
+  %lf178 = load float, float* @f178
+  %li178 = load i32, i32* @k179
+  %cf178 = sitofp i32 %li178 to float
+  %p178 = fmul float %lf178, %cf178
+  %acc178 = fadd float %acc176, %p178
+  %lf180 = load float, float* @f180
+  %li180 = load i32, i32* @k181
+  %cf180 = sitofp i32 %li180 to float
+  %p180 = fmul float %lf180, %cf180
+  %acc180 = fadd float %acc178, %p180
+  %lf182 = load float, float* @f182
+  %li182 = load i32, i32* @k183
+  %cf182 = sitofp i32 %li182 to float
+  %p182 = fmul float %lf182, %cf182
+  %acc182 = fadd float %acc180, %p182
+  %lf184 = load float, float* @f184
+  %li184 = load i32, i32* @k185
+  %cf184 = sitofp i32 %li184 to float
+  %p184 = fmul float %lf184, %cf184
+  %acc184 = fadd float %acc182, %p184
+  %lf186 = load float, float* @f186
+  %li186 = load i32, i32* @k187
+  %cf186 = sitofp i32 %li186 to float
+  %p186 = fmul float %lf186, %cf186
+  %acc186 = fadd float %acc184, %p186
+  %lf188 = load float, float* @f188
+  %li188 = load i32, i32* @k189
+  %cf188 = sitofp i32 %li188 to float
+  %p188 = fmul float %lf188, %cf188
+  %acc188 = fadd float %acc186, %p188
+  %lf190 = load float, float* @f190
+  %li190 = load i32, i32* @k191
+  %cf190 = sitofp i32 %li190 to float
+  %p190 = fmul float %lf190, %cf190
+  %acc190 = fadd float %acc188, %p190
+  %lf192 = load float, float* @f192
+  %li192 = load i32, i32* @k193
+  %cf192 = sitofp i32 %li192 to float
+  %p192 = fmul float %lf192, %cf192
+  %acc192 = fadd float %acc190, %p192
+  %lf194 = load float, float* @f194
+  %li194 = load i32, i32* @k195
+  %cf194 = sitofp i32 %li194 to float
+  %p194 = fmul float %lf194, %cf194
+  %acc194 = fadd float %acc192, %p194
+  %lf196 = load float, float* @f196
+  %li196 = load i32, i32* @k197
+  %cf196 = sitofp i32 %li196 to float
+  %p196 = fmul float %lf196, %cf196
+  %acc196 = fadd float %acc194, %p196
+  %lf198 = load float, float* @f198
+  %li198 = load i32, i32* @k199
+  %cf198 = sitofp i32 %li198 to float
+  %p198 = fmul float %lf198, %cf198
+  %acc198 = fadd float %acc196, %p198
+  %lf200 = load float, float* @f200
+  %li200 = load i32, i32* @k201
+  %cf200 = sitofp i32 %li200 to float
+  %p200 = fmul float %lf200, %cf200
+  %acc200 = fadd float %acc198, %p200
+  %lf202 = load float, float* @f202
+  %li202 = load i32, i32* @k203
+  %cf202 = sitofp i32 %li202 to float
+  %p202 = fmul float %lf202, %cf202
+  %acc202 = fadd float %acc200, %p202
+  %lf204 = load float, float* @f204
+  %li204 = load i32, i32* @k205
+  %cf204 = sitofp i32 %li204 to float
+  %p204 = fmul float %lf204, %cf204
+  %acc204 = fadd float %acc202, %p204
+  %lf206 = load float, float* @f206
+  %li206 = load i32, i32* @k207
+  %cf206 = sitofp i32 %li206 to float
+  %p206 = fmul float %lf206, %cf206
+  %acc206 = fadd float %acc204, %p206
+  %lf208 = load float, float* @f208
+  %li208 = load i32, i32* @k209
+  %cf208 = sitofp i32 %li208 to float
+  %p208 = fmul float %lf208, %cf208
+  %acc208 = fadd float %acc206, %p208
+  %lf210 = load float, float* @f210
+  %li210 = load i32, i32* @k211
+  %cf210 = sitofp i32 %li210 to float
+  %p210 = fmul float %lf210, %cf210
+  %acc210 = fadd float %acc208, %p210
+  %lf212 = load float, float* @f212
+  %li212 = load i32, i32* @k213
+  %cf212 = sitofp i32 %li212 to float
+  %p212 = fmul float %lf212, %cf212
+  %acc212 = fadd float %acc210, %p212
+  %lf214 = load float, float* @f214
+  %li214 = load i32, i32* @k215
+  %cf214 = sitofp i32 %li214 to float
+  %p214 = fmul float %lf214, %cf214
+  %acc214 = fadd float %acc212, %p214
+  %lf216 = load float, float* @f216
+  %li216 = load i32, i32* @k217
+  %cf216 = sitofp i32 %li216 to float
+  %p216 = fmul float %lf216, %cf216
+  %acc216 = fadd float %acc214, %p216
+  %lf218 = load float, float* @f218
+  %li218 = load i32, i32* @k219
+  %cf218 = sitofp i32 %li218 to float
+  %p218 = fmul float %lf218, %cf218
+  %acc218 = fadd float %acc216, %p218
+  %lf220 = load float, float* @f220
+  %li220 = load i32, i32* @k221
+  %cf220 = sitofp i32 %li220 to float
+  %p220 = fmul float %lf220, %cf220
+  %acc220 = fadd float %acc218, %p220
+  %lf222 = load float, float* @f222
+  %li222 = load i32, i32* @k223
+  %cf222 = sitofp i32 %li222 to float
+  %p222 = fmul float %lf222, %cf222
+  %acc222 = fadd float %acc220, %p222
+  %lf224 = load float, float* @f224
+  %li224 = load i32, i32* @k225
+  %cf224 = sitofp i32 %li224 to float
+  %p224 = fmul float %lf224, %cf224
+  %acc224 = fadd float %acc222, %p224
+  %lf226 = load float, float* @f226
+  %li226 = load i32, i32* @k227
+  %cf226 = sitofp i32 %li226 to float
+  %p226 = fmul float %lf226, %cf226
+  %acc226 = fadd float %acc224, %p226
+  %lf228 = load float, float* @f228
+  %li228 = load i32, i32* @k229
+  %cf228 = sitofp i32 %li228 to float
+  %p228 = fmul float %lf228, %cf228
+  %acc228 = fadd float %acc226, %p228
+  %lf230 = load float, float* @f230
+  %li230 = load i32, i32* @k231
+  %cf230 = sitofp i32 %li230 to float
+  %p230 = fmul float %lf230, %cf230
+  %acc230 = fadd float %acc228, %p230
+  %lf232 = load float, float* @f232
+  %li232 = load i32, i32* @k233
+  %cf232 = sitofp i32 %li232 to float
+  %p232 = fmul float %lf232, %cf232
+  %acc232 = fadd float %acc230, %p232
+  %lf234 = load float, float* @f234
+  %li234 = load i32, i32* @k235
+  %cf234 = sitofp i32 %li234 to float
+  %p234 = fmul float %lf234, %cf234
+  %acc234 = fadd float %acc232, %p234
+  %lf236 = load float, float* @f236
+  %li236 = load i32, i32* @k237
+  %cf236 = sitofp i32 %li236 to float
+  %p236 = fmul float %lf236, %cf236
+  %acc236 = fadd float %acc234, %p236
+  %lf238 = load float, float* @f238
+  %li238 = load i32, i32* @k239
+  %cf238 = sitofp i32 %li238 to float
+  %p238 = fmul float %lf238, %cf238
+  %acc238 = fadd float %acc236, %p238
+  %lf240 = load float, float* @f240
+  %li240 = load i32, i32* @k241
+  %cf240 = sitofp i32 %li240 to float
+  %p240 = fmul float %lf240, %cf240
+  %acc240 = fadd float %acc238, %p240
+  %lf242 = load float, float* @f242
+  %li242 = load i32, i32* @k243
+  %cf242 = sitofp i32 %li242 to float
+  %p242 = fmul float %lf242, %cf242
+  %acc242 = fadd float %acc240, %p242
+  %lf244 = load float, float* @f244
+  %li244 = load i32, i32* @k245
+  %cf244 = sitofp i32 %li244 to float
+  %p244 = fmul float %lf244, %cf244
+  %acc244 = fadd float %acc242, %p244
+  %lf246 = load float, float* @f246
+  %li246 = load i32, i32* @k247
+  %cf246 = sitofp i32 %li246 to float
+  %p246 = fmul float %lf246, %cf246
+  %acc246 = fadd float %acc244, %p246
+  %lf248 = load float, float* @f248
+  %li248 = load i32, i32* @k249
+  %cf248 = sitofp i32 %li248 to float
+  %p248 = fmul float %lf248, %cf248
+  %acc248 = fadd float %acc246, %p248
+  %lf250 = load float, float* @f250
+  %li250 = load i32, i32* @k251
+  %cf250 = sitofp i32 %li250 to float
+  %p250 = fmul float %lf250, %cf250
+  %acc250 = fadd float %acc248, %p250
+  %lf252 = load float, float* @f252
+  %li252 = load i32, i32* @k253
+  %cf252 = sitofp i32 %li252 to float
+  %p252 = fmul float %lf252, %cf252
+  %acc252 = fadd float %acc250, %p252
+  %lf254 = load float, float* @f254
+  %li254 = load i32, i32* @k255
+  %cf254 = sitofp i32 %li254 to float
+  %p254 = fmul float %lf254, %cf254
+  %acc254 = fadd float %acc252, %p254
+  %lf256 = load float, float* @f256
+  %li256 = load i32, i32* @k257
+  %cf256 = sitofp i32 %li256 to float
+  %p256 = fmul float %lf256, %cf256
+  %acc256 = fadd float %acc254, %p256
+  %lf258 = load float, float* @f258
+  %li258 = load i32, i32* @k259
+  %cf258 = sitofp i32 %li258 to float
+  %p258 = fmul float %lf258, %cf258
+  %acc258 = fadd float %acc256, %p258
+  %lf260 = load float, float* @f260
+  %li260 = load i32, i32* @k261
+  %cf260 = sitofp i32 %li260 to float
+  %p260 = fmul float %lf260, %cf260
+  %acc260 = fadd float %acc258, %p260
+  %lf262 = load float, float* @f262
+  %li262 = load i32, i32* @k263
+  %cf262 = sitofp i32 %li262 to float
+  %p262 = fmul float %lf262, %cf262
+  %acc262 = fadd float %acc260, %p262
+  %lf264 = load float, float* @f264
+  %li264 = load i32, i32* @k265
+  %cf264 = sitofp i32 %li264 to float
+  %p264 = fmul float %lf264, %cf264
+  %acc264 = fadd float %acc262, %p264
+  %lf266 = load float, float* @f266
+  %li266 = load i32, i32* @k267
+  %cf266 = sitofp i32 %li266 to float
+  %p266 = fmul float %lf266, %cf266
+  %acc266 = fadd float %acc264, %p266
+  %lf268 = load float, float* @f268
+  %li268 = load i32, i32* @k269
+  %cf268 = sitofp i32 %li268 to float
+  %p268 = fmul float %lf268, %cf268
+  %acc268 = fadd float %acc266, %p268
+  %lf270 = load float, float* @f270
+  %li270 = load i32, i32* @k271
+  %cf270 = sitofp i32 %li270 to float
+  %p270 = fmul float %lf270, %cf270
+  %acc270 = fadd float %acc268, %p270
+  %lf272 = load float, float* @f272
+  %li272 = load i32, i32* @k273
+  %cf272 = sitofp i32 %li272 to float
+  %p272 = fmul float %lf272, %cf272
+  %acc272 = fadd float %acc270, %p272
+  %lf274 = load float, float* @f274
+  %li274 = load i32, i32* @k275
+  %cf274 = sitofp i32 %li274 to float
+  %p274 = fmul float %lf274, %cf274
+  %acc274 = fadd float %acc272, %p274
+  %lf276 = load float, float* @f276
+  %li276 = load i32, i32* @k277
+  %cf276 = sitofp i32 %li276 to float
+  %p276 = fmul float %lf276, %cf276
+  %acc276 = fadd float %acc274, %p276
+  %lf278 = load float, float* @f278
+  %li278 = load i32, i32* @k279
+  %cf278 = sitofp i32 %li278 to float
+  %p278 = fmul float %lf278, %cf278
+  %acc278 = fadd float %acc276, %p278
+  %lf280 = load float, float* @f280
+  %li280 = load i32, i32* @k281
+  %cf280 = sitofp i32 %li280 to float
+  %p280 = fmul float %lf280, %cf280
+  %acc280 = fadd float %acc278, %p280
+  %lf282 = load float, float* @f282
+  %li282 = load i32, i32* @k283
+  %cf282 = sitofp i32 %li282 to float
+  %p282 = fmul float %lf282, %cf282
+  %acc282 = fadd float %acc280, %p282
+  %lf284 = load float, float* @f284
+  %li284 = load i32, i32* @k285
+  %cf284 = sitofp i32 %li284 to float
+  %p284 = fmul float %lf284, %cf284
+  %acc284 = fadd float %acc282, %p284
+  %lf286 = load float, float* @f286
+  %li286 = load i32, i32* @k287
+  %cf286 = sitofp i32 %li286 to float
+  %p286 = fmul float %lf286, %cf286
+  %acc286 = fadd float %acc284, %p286
+  %lf288 = load float, float* @f288
+  %li288 = load i32, i32* @k289
+  %cf288 = sitofp i32 %li288 to float
+  %p288 = fmul float %lf288, %cf288
+  %acc288 = fadd float %acc286, %p288
+  %lf290 = load float, float* @f290
+  %li290 = load i32, i32* @k291
+  %cf290 = sitofp i32 %li290 to float
+  %p290 = fmul float %lf290, %cf290
+  %acc290 = fadd float %acc288, %p290
+  %lf292 = load float, float* @f292
+  %li292 = load i32, i32* @k293
+  %cf292 = sitofp i32 %li292 to float
+  %p292 = fmul float %lf292, %cf292
+  %acc292 = fadd float %acc290, %p292
+  %lf294 = load float, float* @f294
+  %li294 = load i32, i32* @k295
+  %cf294 = sitofp i32 %li294 to float
+  %p294 = fmul float %lf294, %cf294
+  %acc294 = fadd float %acc292, %p294
+  %lf296 = load float, float* @f296
+  %li296 = load i32, i32* @k297
+  %cf296 = sitofp i32 %li296 to float
+  %p296 = fmul float %lf296, %cf296
+  %acc296 = fadd float %acc294, %p296
+  %lf298 = load float, float* @f298
+  %li298 = load i32, i32* @k299
+  %cf298 = sitofp i32 %li298 to float
+  %p298 = fmul float %lf298, %cf298
+  %acc298 = fadd float %acc296, %p298
+  %lf300 = load float, float* @f300
+  %li300 = load i32, i32* @k301
+  %cf300 = sitofp i32 %li300 to float
+  %p300 = fmul float %lf300, %cf300
+  %acc300 = fadd float %acc298, %p300
+  %lf302 = load float, float* @f302
+  %li302 = load i32, i32* @k303
+  %cf302 = sitofp i32 %li302 to float
+  %p302 = fmul float %lf302, %cf302
+  %acc302 = fadd float %acc300, %p302
+  %lf304 = load float, float* @f304
+  %li304 = load i32, i32* @k305
+  %cf304 = sitofp i32 %li304 to float
+  %p304 = fmul float %lf304, %cf304
+  %acc304 = fadd float %acc302, %p304
+  %lf306 = load float, float* @f306
+  %li306 = load i32, i32* @k307
+  %cf306 = sitofp i32 %li306 to float
+  %p306 = fmul float %lf306, %cf306
+  %acc306 = fadd float %acc304, %p306
+  %lf308 = load float, float* @f308
+  %li308 = load i32, i32* @k309
+  %cf308 = sitofp i32 %li308 to float
+  %p308 = fmul float %lf308, %cf308
+  %acc308 = fadd float %acc306, %p308
+  %lf310 = load float, float* @f310
+  %li310 = load i32, i32* @k311
+  %cf310 = sitofp i32 %li310 to float
+  %p310 = fmul float %lf310, %cf310
+  %acc310 = fadd float %acc308, %p310
+  %lf312 = load float, float* @f312
+  %li312 = load i32, i32* @k313
+  %cf312 = sitofp i32 %li312 to float
+  %p312 = fmul float %lf312, %cf312
+  %acc312 = fadd float %acc310, %p312
+  %lf314 = load float, float* @f314
+  %li314 = load i32, i32* @k315
+  %cf314 = sitofp i32 %li314 to float
+  %p314 = fmul float %lf314, %cf314
+  %acc314 = fadd float %acc312, %p314
+  %lf316 = load float, float* @f316
+  %li316 = load i32, i32* @k317
+  %cf316 = sitofp i32 %li316 to float
+  %p316 = fmul float %lf316, %cf316
+  %acc316 = fadd float %acc314, %p316
+  %lf318 = load float, float* @f318
+  %li318 = load i32, i32* @k319
+  %cf318 = sitofp i32 %li318 to float
+  %p318 = fmul float %lf318, %cf318
+  %acc318 = fadd float %acc316, %p318
+  %lf320 = load float, float* @f320
+  %li320 = load i32, i32* @k321
+  %cf320 = sitofp i32 %li320 to float
+  %p320 = fmul float %lf320, %cf320
+  %acc320 = fadd float %acc318, %p320
+  %lf322 = load float, float* @f322
+  %li322 = load i32, i32* @k323
+  %cf322 = sitofp i32 %li322 to float
+  %p322 = fmul float %lf322, %cf322
+  %acc322 = fadd float %acc320, %p322
+  %lf324 = load float, float* @f324
+  %li324 = load i32, i32* @k325
+  %cf324 = sitofp i32 %li324 to float
+  %p324 = fmul float %lf324, %cf324
+  %acc324 = fadd float %acc322, %p324
+  %lf326 = load float, float* @f326
+  %li326 = load i32, i32* @k327
+  %cf326 = sitofp i32 %li326 to float
+  %p326 = fmul float %lf326, %cf326
+  %acc326 = fadd float %acc324, %p326
+  %lf328 = load float, float* @f328
+  %li328 = load i32, i32* @k329
+  %cf328 = sitofp i32 %li328 to float
+  %p328 = fmul float %lf328, %cf328
+  %acc328 = fadd float %acc326, %p328
+  %lf330 = load float, float* @f330
+  %li330 = load i32, i32* @k331
+  %cf330 = sitofp i32 %li330 to float
+  %p330 = fmul float %lf330, %cf330
+  %acc330 = fadd float %acc328, %p330
+  %lf332 = load float, float* @f332
+  %li332 = load i32, i32* @k333
+  %cf332 = sitofp i32 %li332 to float
+  %p332 = fmul float %lf332, %cf332
+  %acc332 = fadd float %acc330, %p332
+  %lf334 = load float, float* @f334
+  %li334 = load i32, i32* @k335
+  %cf334 = sitofp i32 %li334 to float
+  %p334 = fmul float %lf334, %cf334
+  %acc334 = fadd float %acc332, %p334
+  %lf336 = load float, float* @f336
+  %li336 = load i32, i32* @k337
+  %cf336 = sitofp i32 %li336 to float
+  %p336 = fmul float %lf336, %cf336
+  %acc336 = fadd float %acc334, %p336
+  %lf338 = load float, float* @f338
+  %li338 = load i32, i32* @k339
+  %cf338 = sitofp i32 %li338 to float
+  %p338 = fmul float %lf338, %cf338
+  %acc338 = fadd float %acc336, %p338
+  %lf340 = load float, float* @f340
+  %li340 = load i32, i32* @k341
+  %cf340 = sitofp i32 %li340 to float
+  %p340 = fmul float %lf340, %cf340
+  %acc340 = fadd float %acc338, %p340
+  %lf342 = load float, float* @f342
+  %li342 = load i32, i32* @k343
+  %cf342 = sitofp i32 %li342 to float
+  %p342 = fmul float %lf342, %cf342
+  %acc342 = fadd float %acc340, %p342
+  %lf344 = load float, float* @f344
+  %li344 = load i32, i32* @k345
+  %cf344 = sitofp i32 %li344 to float
+  %p344 = fmul float %lf344, %cf344
+  %acc344 = fadd float %acc342, %p344
+  %lf346 = load float, float* @f346
+  %li346 = load i32, i32* @k347
+  %cf346 = sitofp i32 %li346 to float
+  %p346 = fmul float %lf346, %cf346
+  %acc346 = fadd float %acc344, %p346
+  %lf348 = load float, float* @f348
+  %li348 = load i32, i32* @k349
+  %cf348 = sitofp i32 %li348 to float
+  %p348 = fmul float %lf348, %cf348
+  %acc348 = fadd float %acc346, %p348
+  %lf350 = load float, float* @f350
+  %li350 = load i32, i32* @k351
+  %cf350 = sitofp i32 %li350 to float
+  %p350 = fmul float %lf350, %cf350
+  %acc350 = fadd float %acc348, %p350
+  %lf352 = load float, float* @f352
+  %li352 = load i32, i32* @k353
+  %cf352 = sitofp i32 %li352 to float
+  %p352 = fmul float %lf352, %cf352
+  %acc352 = fadd float %acc350, %p352
+  %lf354 = load float, float* @f354
+  %li354 = load i32, i32* @k355
+  %cf354 = sitofp i32 %li354 to float
+  %p354 = fmul float %lf354, %cf354
+  %acc354 = fadd float %acc352, %p354
+  %lf356 = load float, float* @f356
+  %li356 = load i32, i32* @k357
+  %cf356 = sitofp i32 %li356 to float
+  %p356 = fmul float %lf356, %cf356
+  %acc356 = fadd float %acc354, %p356
+  %lf358 = load float, float* @f358
+  %li358 = load i32, i32* @k359
+  %cf358 = sitofp i32 %li358 to float
+  %p358 = fmul float %lf358, %cf358
+  %acc358 = fadd float %acc356, %p358
+  %lf360 = load float, float* @f360
+  %li360 = load i32, i32* @k361
+  %cf360 = sitofp i32 %li360 to float
+  %p360 = fmul float %lf360, %cf360
+  %acc360 = fadd float %acc358, %p360
+  %lf362 = load float, float* @f362
+  %li362 = load i32, i32* @k363
+  %cf362 = sitofp i32 %li362 to float
+  %p362 = fmul float %lf362, %cf362
+  %acc362 = fadd float %acc360, %p362
+  %lf364 = load float, float* @f364
+  %li364 = load i32, i32* @k365
+  %cf364 = sitofp i32 %li364 to float
+  %p364 = fmul float %lf364, %cf364
+  %acc364 = fadd float %acc362, %p364
+  %lf366 = load float, float* @f366
+  %li366 = load i32, i32* @k367
+  %cf366 = sitofp i32 %li366 to float
+  %p366 = fmul float %lf366, %cf366
+  %acc366 = fadd float %acc364, %p366
+  %lf368 = load float, float* @f368
+  %li368 = load i32, i32* @k369
+  %cf368 = sitofp i32 %li368 to float
+  %p368 = fmul float %lf368, %cf368
+  %acc368 = fadd float %acc366, %p368
+  %lf370 = load float, float* @f370
+  %li370 = load i32, i32* @k371
+  %cf370 = sitofp i32 %li370 to float
+  %p370 = fmul float %lf370, %cf370
+  %acc370 = fadd float %acc368, %p370
+  %lf372 = load float, float* @f372
+  %li372 = load i32, i32* @k373
+  %cf372 = sitofp i32 %li372 to float
+  %p372 = fmul float %lf372, %cf372
+  %acc372 = fadd float %acc370, %p372
+  %lf374 = load float, float* @f374
+  %li374 = load i32, i32* @k375
+  %cf374 = sitofp i32 %li374 to float
+  %p374 = fmul float %lf374, %cf374
+  %acc374 = fadd float %acc372, %p374
+  %lf376 = load float, float* @f376
+  %li376 = load i32, i32* @k377
+  %cf376 = sitofp i32 %li376 to float
+  %p376 = fmul float %lf376, %cf376
+  %acc376 = fadd float %acc374, %p376
+  %lf378 = load float, float* @f378
+  %li378 = load i32, i32* @k379
+  %cf378 = sitofp i32 %li378 to float
+  %p378 = fmul float %lf378, %cf378
+  %acc378 = fadd float %acc376, %p378
+  %lf380 = load float, float* @f380
+  %li380 = load i32, i32* @k381
+  %cf380 = sitofp i32 %li380 to float
+  %p380 = fmul float %lf380, %cf380
+  %acc380 = fadd float %acc378, %p380
+  %lf382 = load float, float* @f382
+  %li382 = load i32, i32* @k383
+  %cf382 = sitofp i32 %li382 to float
+  %p382 = fmul float %lf382, %cf382
+  %acc382 = fadd float %acc380, %p382
+  %lf384 = load float, float* @f384
+  %li384 = load i32, i32* @k385
+  %cf384 = sitofp i32 %li384 to float
+  %p384 = fmul float %lf384, %cf384
+  %acc384 = fadd float %acc382, %p384
+  %lf386 = load float, float* @f386
+  %li386 = load i32, i32* @k387
+  %cf386 = sitofp i32 %li386 to float
+  %p386 = fmul float %lf386, %cf386
+  %acc386 = fadd float %acc384, %p386
+  %lf388 = load float, float* @f388
+  %li388 = load i32, i32* @k389
+  %cf388 = sitofp i32 %li388 to float
+  %p388 = fmul float %lf388, %cf388
+  %acc388 = fadd float %acc386, %p388
+  %lf390 = load float, float* @f390
+  %li390 = load i32, i32* @k391
+  %cf390 = sitofp i32 %li390 to float
+  %p390 = fmul float %lf390, %cf390
+  %acc390 = fadd float %acc388, %p390
+  %lf392 = load float, float* @f392
+  %li392 = load i32, i32* @k393
+  %cf392 = sitofp i32 %li392 to float
+  %p392 = fmul float %lf392, %cf392
+  %acc392 = fadd float %acc390, %p392
+  %lf394 = load float, float* @f394
+  %li394 = load i32, i32* @k395
+  %cf394 = sitofp i32 %li394 to float
+  %p394 = fmul float %lf394, %cf394
+  %acc394 = fadd float %acc392, %p394
+  %lf396 = load float, float* @f396
+  %li396 = load i32, i32* @k397
+  %cf396 = sitofp i32 %li396 to float
+  %p396 = fmul float %lf396, %cf396
+  %acc396 = fadd float %acc394, %p396
+  %lf398 = load float, float* @f398
+  %li398 = load i32, i32* @k399
+  %cf398 = sitofp i32 %li398 to float
+  %p398 = fmul float %lf398, %cf398
+  %acc398 = fadd float %acc396, %p398
+  %tp = getelementptr [1024 x float], [1024 x float]* @table, i32 0, i32 %i
+  %tv = load float, float* %tp
+  %res = fadd float %acc398, %tv
+  ret float %res
+}
@@ -0,0 +1,2408 @@
+; 200 if/else diamonds in sequence, each one refining and combining the previous value
+define i32 @ifelse_chain(i32 %x, i32 %sel) {
+entry:
+  %v0 = add i32 %x, 0
+  br label %cond0
+cond0:
+  %c0 = icmp sgt i32 %sel, 0
+  br i1 %c0, label %then0, label %else0
+then0:
+  %t0 = add i32 %v0, 1
+  br label %join0
+else0:
+  %e0 = sub i32 %v0, 1
+  br label %join0
+join0:
+  %v1 = phi i32 [ %t0, %then0 ], [ %e0, %else0 ]
+  br label %cond1
+cond1:
+  %c1 = icmp sgt i32 %sel, 1
+  br i1 %c1, label %then1, label %else1
+then1:
+  %t1 = add i32 %v1, 2
+  br label %join1
+else1:
+  %e1 = sub i32 %v1, 2
+  br label %join1
+join1:
+  %v2 = phi i32 [ %t1, %then1 ], [ %e1, %else1 ]
+  br label %cond2
+cond2:
+  %c2 = icmp sgt i32 %sel, 2
+  br i1 %c2, label %then2, label %else2
+then2:
+  %t2 = add i32 %v2, 3
+  br label %join2
+else2:
+  %e2 = sub i32 %v2, 3
+  br label %join2
+join2:
+  %v3 = phi i32 [ %t2, %then2 ], [ %e2, %else2 ]
+  br label %cond3
+cond3:
+  %c3 = icmp sgt i32 %sel, 3
+  br i1 %c3, label %then3, label %else3
+then3:
+  %t3 = add i32 %v3, 4
+  br label %join3
+else3:
+  %e3 = sub i32 %v3, 4
+  br label %join3
+join3:
+  %v4 = phi i32 [ %t3, %then3 ], [ %e3, %else3 ]
+  br label %cond4
+cond4:
+  %c4 = icmp sgt i32 %sel, 4
+  br i1 %c4, label %then4, label %else4
+then4:
+  %t4 = add i32 %v4, 5
+  br label %join4
+else4:
+  %e4 = sub i32 %v4, 5
+  br label %join4
+join4:
+  %v5 = phi i32 [ %t4, %then4 ], [ %e4, %else4 ]
+  br label %cond5
+cond5:
+  %c5 = icmp sgt i32 %sel, 5
+  br i1 %c5, label %then5, label %else5
+then5:
+  %t5 = add i32 %v5, 6
+  br label %join5
+else5:
+  %e5 = sub i32 %v5, 1
+  br label %join5
+join5:
+  %v6 = phi i32 [ %t5, %then5 ], [ %e5, %else5 ]
+  br label %cond6
+cond6:
+  %c6 = icmp sgt i32 %sel, 6
+  br i1 %c6, label %then6, label %else6
+then6:
+  %t6 = add i32 %v6, 7
+  br label %join6
+else6:
+  %e6 = sub i32 %v6, 2
+  br label %join6
+join6:
+  %v7 = phi i32 [ %t6, %then6 ], [ %e6, %else6 ]
+  br label %cond7
+cond7:
+  %c7 = icmp sgt i32 %sel, 7
+  br i1 %c7, label %then7, label %else7
+then7:
+  %t7 = add i32 %v7, 1
+  br label %join7
+else7:
+  %e7 = sub i32 %v7, 3
+  br label %join7
+join7:
+  %v8 = phi i32 [ %t7, %then7 ], [ %e7, %else7 ]
+  br label %cond8
+cond8:
+  %c8 = icmp sgt i32 %sel, 8
+  br i1 %c8, label %then8, label %else8
+then8:
+  %t8 = add i32 %v8, 2
+  br label %join8
+else8:
+  %e8 = sub i32 %v8, 4
+  br label %join8
+join8:
+  %v9 = phi i32 [ %t8, %then8 ], [ %e8, %else8 ]
+  br label %cond9
+cond9:
+  %c9 = icmp sgt i32 %sel, 9
+  br i1 %c9, label %then9, label %else9
+then9:
+  %t9 = add i32 %v9, 3
+  br label %join9
+else9:
+  %e9 = sub i32 %v9, 5
+  br label %join9
+join9:
+  %v10 = phi i32 [ %t9, %then9 ], [ %e9, %else9 ]
+  br label %cond10
+cond10:
+  %c10 = icmp sgt i32 %sel, 10
+  br i1 %c10, label %then10, label %else10
+then10:
+  %t10 = add i32 %v10, 4
+  br label %join10
+else10:
+  %e10 = sub i32 %v10, 1
+  br label %join10
+join10:
+  %v11 = phi i32 [ %t10, %then10 ], [ %e10, %else10 ]
+  br label %cond11
+cond11:
+  %c11 = icmp sgt i32 %sel, 11
+  br i1 %c11, label %then11, label %else11
+then11:
+  %t11 = add i32 %v11, 5
+  br label %join11
+else11:
+  %e11 = sub i32 %v11, 2
+  br label %join11
+join11:
+  %v12 = phi i32 [ %t11, %then11 ], [ %e11, %else11 ]
+  br label %cond12
+cond12:
+  %c12 = icmp sgt i32 %sel, 12
+  br i1 %c12, label %then12, label %else12
+then12:
+  %t12 = add i32 %v12, 6
+  br label %join12
+else12:
+  %e12 = sub i32 %v12, 3
+  br label %join12
+join12:
+  %v13 = phi i32 [ %t12, %then12 ], [ %e12, %else12 ]
+  br label %cond13
+cond13:
+  %c13 = icmp sgt i32 %sel, 13
+  br i1 %c13, label %then13, label %else13
+then13:
+  %t13 = add i32 %v13, 7
+  br label %join13
+else13:
+  %e13 = sub i32 %v13, 4
+  br label %join13
+join13:
+  %v14 = phi i32 [ %t13, %then13 ], [ %e13, %else13 ]
+  br label %cond14
+cond14:
+  %c14 = icmp sgt i32 %sel, 14
+  br i1 %c14, label %then14, label %else14
+then14:
+  %t14 = add i32 %v14, 1
+  br label %join14
+else14:
+  %e14 = sub i32 %v14, 5
+  br label %join14
+join14:
+  %v15 = phi i32 [ %t14, %then14 ], [ %e14, %else14 ]
+  br label %cond15
+cond15:
+  %c15 = icmp sgt i32 %sel, 15
+  br i1 %c15, label %then15, label %else15
+then15:
+  %t15 = add i32 %v15, 2
+  br label %join15
+else15:
+  %e15 = sub i32 %v15, 1
+  br label %join15
+join15:
+  %v16 = phi i32 [ %t15, %then15 ], [ %e15, %else15 ]
+  br label %cond16
+cond16:
+  %c16 = icmp sgt i32 %sel, 16
+  br i1 %c16, label %then16, label %else16
+then16:
+  %t16 = add i32 %v16, 3
+  br label %join16
+else16:
+  %e16 = sub i32 %v16, 2
+  br label %join16
+join16:
+  %v17 = phi i32 [ %t16, %then16 ], [ %e16, %else16 ]
+  br label %cond17
+cond17:
+  %c17 = icmp sgt i32 %sel, 17
+  br i1 %c17, label %then17, label %else17
+then17:
+  %t17 = add i32 %v17, 4
+  br label %join17
+else17:
+  %e17 = sub i32 %v17, 3
+  br label %join17
+join17:
+  %v18 = phi i32 [ %t17, %then17 ], [ %e17, %else17 ]
+  br label %cond18
+cond18:
+  %c18 = icmp sgt i32 %sel, 18
+  br i1 %c18, label %then18, label %else18
+then18:
+  %t18 = add i32 %v18, 5
+  br label %join18
+else18:
+  %e18 = sub i32 %v18, 4
+  br label %join18
+join18:
+  %v19 = phi i32 [ %t18, %then18 ], [ %e18, %else18 ]
+  br label %cond19
+cond19:
+  %c19 = icmp sgt i32 %sel, 19
+  br i1 %c19, label %then19, label %else19
+then19:
+  %t19 = add i32 %v19, 6
+  br label %join19
+else19:
+  %e19 = sub i32 %v19, 5
+  br label %join19
+join19:
+  %v20 = phi i32 [ %t19, %then19 ], [ %e19, %else19 ]
+  br label %cond20
+cond20:
+  %c20 = icmp sgt i32 %sel, 20
+  br i1 %c20, label %then20, label %else20
+then20:
+  %t20 = add i32 %v20, 7
+  br label %join20
+else20:
+  %e20 = sub i32 %v20, 1
+  br label %join20
+join20:
+  %v21 = phi i32 [ %t20, %then20 ], [ %e20, %else20 ]
+  br label %cond21
+cond21:
+  %c21 = icmp sgt i32 %sel, 21
+  br i1 %c21, label %then21, label %else21
+then21:
+  %t21 = add i32 %v21, 1
+  br label %join21
+else21:
+  %e21 = sub i32 %v21, 2
+  br label %join21
+join21:
+  %v22 = phi i32 [ %t21, %then21 ], [ %e21, %else21 ]
+  br label %cond22
+cond22:
+  %c22 = icmp sgt i32 %sel, 22
+  br i1 %c22, label %then22, label %else22
+then22:
+  %t22 = add i32 %v22, 2
+  br label %join22
+else22:
+  %e22 = sub i32 %v22, 3
+  br label %join22
+join22:
+  %v23 = phi i32 [ %t22, %then22 ], [ %e22, %else22 ]
+  br label %cond23
+cond23:
+  %c23 = icmp sgt i32 %sel, 23
+  br i1 %c23, label %then23, label %else23
+then23:
+  %t23 = add i32 %v23, 3
+  br label %join23
+else23:
+  %e23 = sub i32 %v23, 4
+  br label %join23
+join23:
+  %v24 = phi i32 [ %t23, %then23 ], [ %e23, %else23 ]
+  br label %cond24
+cond24:
+  %c24 = icmp sgt i32 %sel, 24
+  br i1 %c24, label %then24, label %else24
+then24:
+  %t24 = add i32 %v24, 4
+  br label %join24
+else24:
+  %e24 = sub i32 %v24, 5
+  br label %join24
+join24:
+  %v25 = phi i32 [ %t24, %then24 ], [ %e24, %else24 ]
+  br label %cond25
+cond25:
+  %c25 = icmp sgt i32 %sel, 25
+  br i1 %c25, label %then25, label %else25
+then25:
+  %t25 = add i32 %v25, 5
+  br label %join25
+else25:
+  %e25 = sub i32 %v25, 1
+  br label %join25
+join25:
+  %v26 = phi i32 [ %t25, %then25 ], [ %e25, %else25 ]
+  br label %cond26
+cond26:
+  %c26 = icmp sgt i32 %sel, 26
+  br i1 %c26, label %then26, label %else26
+then26:
+  %t26 = add i32 %v26, 6
+  br label %join26
+else26:
+  %e26 = sub i32 %v26, 2
+  br label %join26
+join26:
+  %v27 = phi i32 [ %t26, %then26 ], [ %e26, %else26 ]
+  br label %cond27
+cond27:
+  %c27 = icmp sgt i32 %sel, 27
+  br i1 %c27, label %then27, label %else27
+then27:
+  %t27 = add i32 %v27, 7
+  br label %join27
+else27:
+  %e27 = sub i32 %v27, 3
+  br label %join27
+join27:
+  %v28 = phi i32 [ %t27, %then27 ], [ %e27, %else27 ]
+  br label %cond28
+cond28:
+  %c28 = icmp sgt i32 %sel, 28
+  br i1 %c28, label %then28, label %else28
+then28:
+  %t28 = add i32 %v28, 1
+  br label %join28
+else28:
+  %e28 = sub i32 %v28, 4
+  br label %join28
+join28:
+  %v29 = phi i32 [ %t28, %then28 ], [ %e28, %else28 ]
+  br label %cond29
+cond29:
+  %c29 = icmp sgt i32 %sel, 29
+  br i1 %c29, label %then29, label %else29
+then29:
+  %t29 = add i32 %v29, 2
+  br label %join29
+else29:
+  %e29 = sub i32 %v29, 5
+  br label %join29
+join29:
+  %v30 = phi i32 [ %t29, %then29 ], [ %e29, %else29 ]
+  br label %cond30
+cond30:
+  %c30 = icmp sgt i32 %sel, 30
+  br i1 %c30, label %then30, label %else30
+then30:
+  %t30 = add i32 %v30, 3
+  br label %join30
+else30:
+  %e30 = sub i32 %v30, 1
+  br label %join30
+join30:
+  %v31 = phi i32 [ %t30, %then30 ], [ %e30, %else30 ]
+  br label %cond31
+cond31:
+  %c31 = icmp sgt i32 %sel, 31
+  br i1 %c31, label %then31, label %else31
+then31:
+  %t31 = add i32 %v31, 4
+  br label %join31
+else31:
+  %e31 = sub i32 %v31, 2
+  br label %join31
+join31:
+  %v32 = phi i32 [ %t31, %then31 ], [ %e31, %else31 ]
+  br label %cond32
+cond32:
+  %c32 = icmp sgt i32 %sel, 32
+  br i1 %c32, label %then32, label %else32
+then32:
+  %t32 = add i32 %v32, 5
+  br label %join32
+else32:
+  %e32 = sub i32 %v32, 3
+  br label %join32
+join32:
+  %v33 = phi i32 [ %t32, %then32 ], [ %e32, %else32 ]
+  br label %cond33
+cond33:
+  %c33 = icmp sgt i32 %sel, 33
+  br i1 %c33, label %then33, label %else33
+then33:
+  %t33 = add i32 %v33, 6
+  br label %join33
+else33:
+  %e33 = sub i32 %v33, 4
+  br label %join33
+join33:
+  %v34 = phi i32 [ %t33, %then33 ], [ %e33, %else33 ]
+  br label %cond34
+cond34:
+  %c34 = icmp sgt i32 %sel, 34
+  br i1 %c34, label %then34, label %else34
+then34:
+  %t34 = add i32 %v34, 7
+  br label %join34
+else34:
+  %e34 = sub i32 %v34, 5
+  br label %join34
+join34:
+  %v35 = phi i32 [ %t34, %then34 ], [ %e34, %else34 ]
+  br label %cond35
+cond35:
+  %c35 = icmp sgt i32 %sel, 35
+  br i1 %c35, label %then35, label %else35
+then35:
+  %t35 = add i32 %v35, 1
+  br label %join35
+else35:
+  %e35 = sub i32 %v35, 1
+  br label %join35
+join35:
+  %v36 = phi i32 [ %t35, %then35 ], [ %e35, %else35 ]
+  br label %cond36
+cond36:
+  %c36 = icmp sgt i32 %sel, 36
+  br i1 %c36, label %then36, label %else36
+then36:
+  %t36 = add i32 %v36, 2
+  br label %join36
+else36:
+  %e36 = sub i32 %v36, 2
+  br label %join36
+join36:
+  %v37 = phi i32 [ %t36, %then36 ], [ %e36, %else36 ]
+  br label %cond37
+cond37:
+  %c37 = icmp sgt i32 %sel, 37
+  br i1 %c37, label %then37, label %else37
+then37:
+  %t37 = add i32 %v37, 3
+  br label %join37
+else37:
+  %e37 = sub i32 %v37, 3
+  br label %join37
+join37:
+  %v38 = phi i32 [ %t37, %then37 ], [ %e37, %else37 ]
+  br label %cond38
+cond38:
+  %c38 = icmp sgt i32 %sel, 38
+  br i1 %c38, label %then38, label %else38
+then38:
+  %t38 = add i32 %v38, 4
+  br label %join38
+else38:
+  %e38 = sub i32 %v38, 4
+  br label %join38
+join38:
+  %v39 = phi i32 [ %t38, %then38 ], [ %e38, %else38 ]
+  br label %cond39
+cond39:
+  %c39 = icmp sgt i32 %sel, 39
+  br i1 %c39, label %then39, label %else39
+then39:
+  %t39 = add i32 %v39, 5
+  br label %join39
+else39:
+  %e39 = sub i32 %v39, 5
+  br label %join39
+join39:
+  %v40 = phi i32 [ %t39, %then39 ], [ %e39, %else39 ]
+  br label %cond40
+cond40:
+  %c40 = icmp sgt i32 %sel, 40
+  br i1 %c40, label %then40, label %else40
+then40:
+  %t40 = add i32 %v40, 6
+  br label %join40
+else40:
+  %e40 = sub i32 %v40, 1
+  br label %join40
+join40:
+  %v41 = phi i32 [ %t40, %then40 ], [ %e40, %else40 ]
+  br label %cond41
+cond41:
+  %c41 = icmp sgt i32 %sel, 41
+  br i1 %c41, label %then41, label %else41
+then41:
+  %t41 = add i32 %v41, 7
+  br label %join41
+else41:
+  %e41 = sub i32 %v41, 2
+  br label %join41
+join41:
+  %v42 = phi i32 [ %t41, %then41 ], [ %e41, %else41 ]
+  br label %cond42
+cond42:
+  %c42 = icmp sgt i32 %sel, 42
+  br i1 %c42, label %then42, label %else42
+then42:
+  %t42 = add i32 %v42, 1
+  br label %join42
+else42:
+  %e42 = sub i32 %v42, 3
+  br label %join42
+join42:
+  %v43 = phi i32 [ %t42, %then42 ], [ %e42, %else42 ]
+  br label %cond43
+cond43:
+  %c43 = icmp sgt i32 %sel, 43
+  br i1 %c43, label %then43, label %else43
+then43:
+  %t43 = add i32 %v43, 2
+  br label %join43
+else43:
+  %e43 = sub i32 %v43, 4
+  br label %join43
+join43:
+  %v44 = phi i32 [ %t43, %then43 ], [ %e43, %else43 ]
+  br label %cond44
+cond44:
+  %c44 = icmp sgt i32 %sel, 44
+  br i1 %c44, label %then44, label %else44
+then44:
+  %t44 = add i32 %v44, 3
+  br label %join44
+else44:
+  %e44 = sub i32 %v44, 5
+  br label %join44
+join44:
+  %v45 = phi i32 [ %t44, %then44 ], [ %e44, %else44 ]
+  br label %cond45
+cond45:
+  %c45 = icmp sgt i32 %sel, 45
+  br i1 %c45, label %then45, label %else45
+then45:
+  %t45 = add i32 %v45, 4
+  br label %join45
+else45:
+  %e45 = sub i32 %v45, 1
+  br label %join45
+join45:
+  %v46 = phi i32 [ %t45, %then45 ], [ %e45, %else45 ]
+  br label %cond46
+cond46:
+  %c46 = icmp sgt i32 %sel, 46
+  br i1 %c46, label %then46, label %else46
+then46:
+  %t46 = add i32 %v46, 5
+  br label %join46
+else46:
+  %e46 = sub i32 %v46, 2
+  br label %join46
+join46:
+  %v47 = phi i32 [ %t46, %then46 ], [ %e46, %else46 ]
+  br label %cond47
+cond47:
+  %c47 = icmp sgt i32 %sel, 47
+  br i1 %c47, label %then47, label %else47
+then47:
+  %t47 = add i32 %v47, 6
+  br label %join47
+else47:
+  %e47 = sub i32 %v47, 3
+  br label %join47
+join47:
+  %v48 = phi i32 [ %t47, %then47 ], [ %e47, %else47 ]
+  br label %cond48
+cond48:
+  %c48 = icmp sgt i32 %sel, 48
+  br i1 %c48, label %then48, label %else48
+then48:
+  %t48 = add i32 %v48, 7
+  br label %join48
+else48:
+  %e48 = sub i32 %v48, 4
+  br label %join48
+join48:
+  %v49 = phi i32 [ %t48, %then48 ], [ %e48, %else48 ]
+  br label %cond49
+cond49:
+  %c49 = icmp sgt i32 %sel, 49
+  br i1 %c49, label %then49, label %else49
+then49:
+  %t49 = add i32 %v49, 1
+  br label %join49
+else49:
+  %e49 = sub i32 %v49, 5
+  br label %join49
+join49:
+  %v50 = phi i32 [ %t49, %then49 ], [ %e49, %else49 ]
+  br label %cond50
+cond50:
+  %c50 = icmp sgt i32 %sel, 50
+  br i1 %c50, label %then50, label %else50
+then50:
+  %t50 = add i32 %v50, 2
+  br label %join50
+else50:
+  %e50 = sub i32 %v50, 1
+  br label %join50
+join50:
+  %v51 = phi i32 [ %t50, %then50 ], [ %e50, %else50 ]
+  br label %cond51
+cond51:
+  %c51 = icmp sgt i32 %sel, 51
+  br i1 %c51, label %then51, label %else51
+then51:
+  %t51 = add i32 %v51, 3
+  br label %join51
+else51:
+  %e51 = sub i32 %v51, 2
+  br label %join51
+join51:
+  %v52 = phi i32 [ %t51, %then51 ], [ %e51, %else51 ]
+  br label %cond52
+cond52:
+  %c52 = icmp sgt i32 %sel, 52
+  br i1 %c52, label %then52, label %else52
+then52:
+  %t52 = add i32 %v52, 4
+  br label %join52
+else52:
+  %e52 = sub i32 %v52, 3
+  br label %join52
+join52:
+  %v53 = phi i32 [ %t52, %then52 ], [ %e52, %else52 ]
+  br label %cond53
+cond53:
+  %c53 = icmp sgt i32 %sel, 53
+  br i1 %c53, label %then53, label %else53
+then53:
+  %t53 = add i32 %v53, 5
+  br label %join53
+else53:
+  %e53 = sub i32 %v53, 4
+  br label %join53
+join53:
+  %v54 = phi i32 [ %t53, %then53 ], [ %e53, %else53 ]
+  br label %cond54
+cond54:
+  %c54 = icmp sgt i32 %sel, 54
+  br i1 %c54, label %then54, label %else54
+then54:
+  %t54 = add i32 %v54, 6
+  br label %join54
+else54:
+  %e54 = sub i32 %v54, 5
+  br label %join54
+join54:
+  %v55 = phi i32 [ %t54, %then54 ], [ %e54, %else54 ]
+  br label %cond55
+cond55:
+  %c55 = icmp sgt i32 %sel, 55
+  br i1 %c55, label %then55, label %else55
+then55:
+  %t55 = add i32 %v55, 7
+  br label %join55
+else55:
+  %e55 = sub i32 %v55, 1
+  br label %join55
+join55:
+  %v56 = phi i32 [ %t55, %then55 ], [ %e55, %else55 ]
+  br label %cond56
+cond56:
+  %c56 = icmp sgt i32 %sel, 56
+  br i1 %c56, label %then56, label %else56
+then56:
+  %t56 = add i32 %v56, 1
+  br label %join56
+else56:
+  %e56 = sub i32 %v56, 2
+  br label %join56
+join56:
+  %v57 = phi i32 [ %t56, %then56 ], [ %e56, %else56 ]
+  br label %cond57
+cond57:
+  %c57 = icmp sgt i32 %sel, 57
+  br i1 %c57, label %then57, label %else57
+then57:
+  %t57 = add i32 %v57, 2
+  br label %join57
+else57:
+  %e57 = sub i32 %v57, 3
+  br label %join57
+join57:
+  %v58 = phi i32 [ %t57, %then57 ], [ %e57, %else57 ]
+  br label %cond58
+cond58:
+  %c58 = icmp sgt i32 %sel, 58
+  br i1 %c58, label %then58, label %else58
+then58:
+  %t58 = add i32 %v58, 3
+  br label %join58
+else58:
+  %e58 = sub i32 %v58, 4
+  br label %join58
+join58:
+  %v59 = phi i32 [ %t58, %then58 ], [ %e58, %else58 ]
+  br label %cond59
+cond59:
+  %c59 = icmp sgt i32 %sel, 59
+  br i1 %c59, label %then59, label %else59
+then59:
+  %t59 = add i32 %v59, 4
+  br label %join59
+else59:
+  %e59 = sub i32 %v59, 5
+  br label %join59
+join59:
+  %v60 = phi i32 [ %t59, %then59 ], [ %e59, %else59 ]
+  br label %cond60
+cond60:
+  %c60 = icmp sgt i32 %sel, 60
+  br i1 %c60, label %then60, label %else60
+then60:
+  %t60 = add i32 %v60, 5
+  br label %join60
+else60:
+  %e60 = sub i32 %v60, 1
+  br label %join60
+join60:
+  %v61 = phi i32 [ %t60, %then60 ], [ %e60, %else60 ]
+  br label %cond61
+cond61:
+  %c61 = icmp sgt i32 %sel, 61
+  br i1 %c61, label %then61, label %else61
+then61:
+  %t61 = add i32 %v61, 6
+  br label %join61
+else61:
+  %e61 = sub i32 %v61, 2
+  br label %join61
+join61:
+  %v62 = phi i32 [ %t61, %then61 ], [ %e61, %else61 ]
+  br label %cond62
+cond62:
+  %c62 = icmp sgt i32 %sel, 62
+  br i1 %c62, label %then62, label %else62
+then62:
+  %t62 = add i32 %v62, 7
+  br label %join62
+else62:
+  %e62 = sub i32 %v62, 3
+  br label %join62
+join62:
+  %v63 = phi i32 [ %t62, %then62 ], [ %e62, %else62 ]
+  br label %cond63
+cond63:
+  %c63 = icmp sgt i32 %sel, 63
+  br i1 %c63, label %then63, label %else63
+then63:
+  %t63 = add i32 %v63, 1
+  br label %join63
+else63:
+  %e63 = sub i32 %v63, 4
+  br label %join63
+join63:
+  %v64 = phi i32 [ %t63, %then63 ], [ %e63, %else63 ]
+  br label %cond64
+cond64:
+  %c64 = icmp sgt i32 %sel, 64
+  br i1 %c64, label %then64, label %else64
+then64:
+  %t64 = add i32 %v64, 2
+  br label %join64
+else64:
+  %e64 = sub i32 %v64, 5
+  br label %join64
+join64:
+  %v65 = phi i32 [ %t64, %then64 ], [ %e64, %else64 ]
+  br label %cond65
+cond65:
+  %c65 = icmp sgt i32 %sel, 65
+  br i1 %c65, label %then65, label %else65
+then65:
+  %t65 = add i32 %v65, 3
+  br label %join65
+else65:
+  %e65 = sub i32 %v65, 1
+  br label %join65
+join65:
+  %v66 = phi i32 [ %t65, %then65 ], [ %e65, %else65 ]
+  br label %cond66
+cond66:
+  %c66 = icmp sgt i32 %sel, 66
+  br i1 %c66, label %then66, label %else66
+then66:
+  %t66 = add i32 %v66, 4
+  br label %join66
+else66:
+  %e66 = sub i32 %v66, 2
+  br label %join66
+join66:
+  %v67 = phi i32 [ %t66, %then66 ], [ %e66, %else66 ]
+  br label %cond67
+cond67:
+  %c67 = icmp sgt i32 %sel, 67
+  br i1 %c67, label %then67, label %else67
+then67:
+  %t67 = add i32 %v67, 5
+  br label %join67
+else67:
+  %e67 = sub i32 %v67, 3
+  br label %join67
+join67:
+  %v68 = phi i32 [ %t67, %then67 ], [ %e67, %else67 ]
+  br label %cond68
+cond68:
+  %c68 = icmp sgt i32 %sel, 68
+  br i1 %c68, label %then68, label %else68
+then68:
+  %t68 = add i32 %v68, 6
+  br label %join68
+else68:
+  %e68 = sub i32 %v68, 4
+  br label %join68
+join68:
+  %v69 = phi i32 [ %t68, %then68 ], [ %e68, %else68 ]
+  br label %cond69
+cond69:
+  %c69 = icmp sgt i32 %sel, 69
+  br i1 %c69, label %then69, label %else69
+then69:
+  %t69 = add i32 %v69, 7
+  br label %join69
+else69:
+  %e69 = sub i32 %v69, 5
+  br label %join69
+join69:
+  %v70 = phi i32 [ %t69, %then69 ], [ %e69, %else69 ]
+  br label %cond70
+cond70:
+  %c70 = icmp sgt i32 %sel, 70
+  br i1 %c70, label %then70, label %else70
+then70:
+  %t70 = add i32 %v70, 1
+  br label %join70
+else70:
+  %e70 = sub i32 %v70, 1
+  br label %join70
+join70:
+  %v71 = phi i32 [ %t70, %then70 ], [ %e70, %else70 ]
+  br label %cond71
+cond71:
+  %c71 = icmp sgt i32 %sel, 71
+  br i1 %c71, label %then71, label %else71
+then71:
+  %t71 = add i32 %v71, 2
+  br label %join71
+else71:
+  %e71 = sub i32 %v71, 2
+  br label %join71
+join71:
+  %v72 = phi i32 [ %t71, %then71 ], [ %e71, %else71 ]
+  br label %cond72
+cond72:
+  %c72 = icmp sgt i32 %sel, 72
+  br i1 %c72, label %then72, label %else72
+then72:
+  %t72 = add i32 %v72, 3
+  br label %join72
+else72:
+  %e72 = sub i32 %v72, 3
+  br label %join72
+join72:
+  %v73 = phi i32 [ %t72, %then72 ], [ %e72, %else72 ]
+  br label %cond73
+cond73:
+  %c73 = icmp sgt i32 %sel, 73
+  br i1 %c73, label %then73, label %else73
+then73:
+  %t73 = add i32 %v73, 4
+  br label %join73
+else73:
+  %e73 = sub i32 %v73, 4
+  br label %join73
+join73:
+  %v74 = phi i32 [ %t73, %then73 ], [ %e73, %else73 ]
+  br label %cond74
+cond74:
+  %c74 = icmp sgt i32 %sel, 74
+  br i1 %c74, label %then74, label %else74
+then74:
+  %t74 = add i32 %v74, 5
+  br label %join74
+else74:
+  %e74 = sub i32 %v74, 5
+  br label %join74
+join74:
+  %v75 = phi i32 [ %t74, %then74 ], [ %e74, %else74 ]
+  br label %cond75
+cond75:
+  %c75 = icmp sgt i32 %sel, 75
+  br i1 %c75, label %then75, label %else75
+then75:
+  %t75 = add i32 %v75, 6
+  br label %join75
+else75:
+  %e75 = sub i32 %v75, 1
+  br label %join75
+join75:
+  %v76 = phi i32 [ %t75, %then75 ], [ %e75, %else75 ]
+  br label %cond76
+cond76:
+  %c76 = icmp sgt i32 %sel, 76
+  br i1 %c76, label %then76, label %else76
+then76:
+  %t76 = add i32 %v76, 7
+  br label %join76
+else76:
+  %e76 = sub i32 %v76, 2
+  br label %join76
+join76:
+  %v77 = phi i32 [ %t76, %then76 ], [ %e76, %else76 ]
+  br label %cond77
+cond77:
+  %c77 = icmp sgt i32 %sel, 77
+  br i1 %c77, label %then77, label %else77
+then77:
+  %t77 = add i32 %v77, 1
+  br label %join77
+else77:
+  %e77 = sub i32 %v77, 3
+  br label %join77
+join77:
+  %v78 = phi i32 [ %t77, %then77 ], [ %e77, %else77 ]
+  br label %cond78
+cond78:
+  %c78 = icmp sgt i32 %sel, 78
+  br i1 %c78, label %then78, label %else78
+then78:
+  %t78 = add i32 %v78, 2
+  br label %join78
+else78:
+  %e78 = sub i32 %v78, 4
+  br label %join78
+join78:
+  %v79 = phi i32 [ %t78, %then78 ], [ %e78, %else78 ]
+  br label %cond79
+cond79:
+  %c79 = icmp sgt i32 %sel, 79
+  br i1 %c79, label %then79, label %else79
+then79:
+  %t79 = add i32 %v79, 3
+  br label %join79
+else79:
+  %e79 = sub i32 %v79, 5
+  br label %join79
+join79:
+  %v80 = phi i32 [ %t79, %then79 ], [ %e79, %else79 ]
+  br label %cond80
+cond80:
+  %c80 = icmp sgt i32 %sel, 80
+  br i1 %c80, label %then80, label %else80
+then80:
+  %t80 = add i32 %v80, 4
+  br label %join80
+else80:
+  %e80 = sub i32 %v80, 1
+  br label %join80
+join80:
+  %v81 = phi i32 [ %t80, %then80 ], [ %e80, %else80 ]
+  br label %cond81
+cond81:
+  %c81 = icmp sgt i32 %sel, 81
+  br i1 %c81, label %then81, label %else81
+then81:
+  %t81 = add i32 %v81, 5
+  br label %join81
+else81:
+  %e81 = sub i32 %v81, 2
+  br label %join81
+join81:
+  %v82 = phi i32 [ %t81, %then81 ], [ %e81, %else81 ]
+  br label %cond82
+cond82:
+  %c82 = icmp sgt i32 %sel, 82
+  br i1 %c82, label %then82, label %else82
+then82:
+  %t82 = add i32 %v82, 6
+  br label %join82
+else82:
+  %e82 = sub i32 %v82, 3
+  br label %join82
+join82:
+  %v83 = phi i32 [ %t82, %then82 ], [ %e82, %else82 ]
+  br label %cond83
+cond83:
+  %c83 = icmp sgt i32 %sel, 83
+  br i1 %c83, label %then83, label %else83
+then83:
+  %t83 = add i32 %v83, 7
+  br label %join83
+else83:
+  %e83 = sub i32 %v83, 4
+  br label %join83
+join83:
+  %v84 = phi i32 [ %t83, %then83 ], [ %e83, %else83 ]
+  br label %cond84
+cond84:
+  %c84 = icmp sgt i32 %sel, 84
+  br i1 %c84, label %then84, label %else84
+then84:
+  %t84 = add i32 %v84, 1
+  br label %join84
+else84:
+  %e84 = sub i32 %v84, 5
+  br label %join84
+join84:
+  %v85 = phi i32 [ %t84, %then84 ], [ %e84, %else84 ]
+  br label %cond85
+cond85:
+  %c85 = icmp sgt i32 %sel, 85
+  br i1 %c85, label %then85, label %else85
+then85:
+  %t85 = add i32 %v85, 2
+  br label %join85
+else85:
+  %e85 = sub i32 %v85, 1
+  br label %join85
+join85:
+  %v86 = phi i32 [ %t85, %then85 ], [ %e85, %else85 ]
+  br label %cond86
+cond86:
+  %c86 = icmp sgt i32 %sel, 86
+  br i1 %c86, label %then86, label %else86
+then86:
+  %t86 = add i32 %v86, 3
+  br label %join86
+else86:
+  %e86 = sub i32 %v86, 2
+  br label %join86
+join86:
+  %v87 = phi i32 [ %t86, %then86 ], [ %e86, %else86 ]
+  br label %cond87
+cond87:
+  %c87 = icmp sgt i32 %sel, 87
+  br i1 %c87, label %then87, label %else87
+then87:
+  %t87 = add i32 %v87, 4
+  br label %join87
+else87:
+  %e87 = sub i32 %v87, 3
+  br label %join87
+join87:
+  %v88 = phi i32 [ %t87, %then87 ], [ %e87, %else87 ]
+  br label %cond88
+cond88:
+  %c88 = icmp sgt i32 %sel, 88
+  br i1 %c88, label %then88, label %else88
+then88:
+  %t88 = add i32 %v88, 5
+  br label %join88
+else88:
+  %e88 = sub i32 %v88, 4
+  br label %join88
+join88:
+  %v89 = phi i32 [ %t88, %then88 ], [ %e88, %else88 ]
+  br label %cond89
+cond89:
+  %c89 = icmp sgt i32 %sel, 89
+  br i1 %c89, label %then89, label %else89
+then89:
+  %t89 = add i32 %v89, 6
+  br label %join89
+else89:
+  %e89 = sub i32 %v89, 5
+  br label %join89
+join89:
+  %v90 = phi i32 [ %t89, %then89 ], [ %e89, %else89 ]
+  br label %cond90
+cond90:
+  %c90 = icmp sgt i32 %sel, 90
+  br i1 %c90, label %then90, label %else90
+then90:
+  %t90 = add i32 %v90, 7
+  br label %join90
+else90:
+  %e90 = sub i32 %v90, 1
+  br label %join90
+join90:
+  %v91 = phi i32 [ %t90, %then90 ], [ %e90, %else90 ]
+  br label %cond91
+cond91:
+  %c91 = icmp sgt i32 %sel, 91
+  br i1 %c91, label %then91, label %else91
+then91:
+  %t91 = add i32 %v91, 1
+  br label %join91
+else91:
+  %e91 = sub i32 %v91, 2
+  br label %join91
+join91:
+  %v92 = phi i32 [ %t91, %then91 ], [ %e91, %else91 ]
+  br label %cond92
+cond92:
+  %c92 = icmp sgt i32 %sel, 92
+  br i1 %c92, label %then92, label %else92
+then92:
+  %t92 = add i32 %v92, 2
+  br label %join92
+else92:
+  %e92 = sub i32 %v92, 3
+  br label %join92
+join92:
+  %v93 = phi i32 [ %t92, %then92 ], [ %e92, %else92 ]
+  br label %cond93
+cond93:
+  %c93 = icmp sgt i32 %sel, 93
+  br i1 %c93, label %then93, label %else93
+then93:
+  %t93 = add i32 %v93, 3
+  br label %join93
+else93:
+  %e93 = sub i32 %v93, 4
+  br label %join93
+join93:
+  %v94 = phi i32 [ %t93, %then93 ], [ %e93, %else93 ]
+  br label %cond94
+cond94:
+  %c94 = icmp sgt i32 %sel, 94
+  br i1 %c94, label %then94, label %else94
+then94:
+  %t94 = add i32 %v94, 4
+  br label %join94
+else94:
+  %e94 = sub i32 %v94, 5
+  br label %join94
+join94:
+  %v95 = phi i32 [ %t94, %then94 ], [ %e94, %else94 ]
+  br label %cond95
+cond95:
+  %c95 = icmp sgt i32 %sel, 95
+  br i1 %c95, label %then95, label %else95
+then95:
+  %t95 = add i32 %v95, 5
+  br label %join95
+else95:
+  %e95 = sub i32 %v95, 1
+  br label %join95
+join95:
+  %v96 = phi i32 [ %t95, %then95 ], [ %e95, %else95 ]
+  br label %cond96
+cond96:
+  %c96 = icmp sgt i32 %sel, 96
+  br i1 %c96, label %then96, label %else96
+then96:
+  %t96 = add i32 %v96, 6
+  br label %join96
+else96:
+  %e96 = sub i32 %v96, 2
+  br label %join96
+join96:
+  %v97 = phi i32 [ %t96, %then96 ], [ %e96, %else96 ]
+  br label %cond97
+cond97:
+  %c97 = icmp sgt i32 %sel, 97
+  br i1 %c97, label %then97, label %else97
+then97:
+  %t97 = add i32 %v97, 7
+  br label %join97
+else97:
+  %e97 = sub i32 %v97, 3
+  br label %join97
+join97:
+  %v98 = phi i32 [ %t97, %then97 ], [ %e97, %else97 ]
+  br label %cond98
+cond98:
+  %c98 = icmp sgt i32 %sel, 98
+  br i1 %c98, label %then98, label %else98
+then98:
+  %t98 = add i32 %v98, 1
+  br label %join98
+else98:
+  %e98 = sub i32 %v98, 4
+  br label %join98
+join98:
+  %v99 = phi i32 [ %t98, %then98 ], [ %e98, %else98 ]
+  br label %cond99
+cond99:
+  %c99 = icmp sgt i32 %sel, 99
+  br i1 %c99, label %then99, label %else99
+then99:
+  %t99 = add i32 %v99, 2
+  br label %join99
+else99:
+  %e99 = sub i32 %v99, 5
+  br label %join99
+join99:
+  %v100 = phi i32 [ %t99, %then99 ], [ %e99, %else99 ]
+  br label %cond100
+cond100:
+  %c100 = icmp sgt i32 %sel, 100
+  br i1 %c100, label %then100, label %else100
+then100:
+  %t100 = add i32 %v100, 3
+  br label %join100
+else100:
+  %e100 = sub i32 %v100, 1
+  br label %join100
+join100:
+  %v101 = phi i32 [ %t100, %then100 ], [ %e100, %else100 ]
+  br label %cond101
+cond101:
+  %c101 = icmp sgt i32 %sel, 101
+  br i1 %c101, label %then101, label %else101
+then101:
+  %t101 = add i32 %v101, 4
+  br label %join101
+else101:
+  %e101 = sub i32 %v101, 2
+  br label %join101
+join101:
+  %v102 = phi i32 [ %t101, %then101 ], [ %e101, %else101 ]
+  br label %cond102
+cond102:
+  %c102 = icmp sgt i32 %sel, 102
+  br i1 %c102, label %then102, label %else102
+then102:
+  %t102 = add i32 %v102, 5
+  br label %join102
+else102:
+  %e102 = sub i32 %v102, 3
+  br label %join102
+join102:
+  %v103 = phi i32 [ %t102, %then102 ], [ %e102, %else102 ]
+  br label %cond103
+cond103:
+  %c103 = icmp sgt i32 %sel, 103
+  br i1 %c103, label %then103, label %else103
+then103:
+  %t103 = add i32 %v103, 6
+  br label %join103
+else103:
+  %e103 = sub i32 %v103, 4
+  br label %join103
+join103:
+  %v104 = phi i32 [ %t103, %then103 ], [ %e103, %else103 ]
+  br label %cond104
+cond104:
+  %c104 = icmp sgt i32 %sel, 104
+  br i1 %c104, label %then104, label %else104
+then104:
+  %t104 = add i32 %v104, 7
+  br label %join104
+else104:
+  %e104 = sub i32 %v104, 5
+  br label %join104
+join104:
+  %v105 = phi i32 [ %t104, %then104 ], [ %e104, %else104 ]
+  br label %cond105
+cond105:
+  %c105 = icmp sgt i32 %sel, 105
+  br i1 %c105, label %then105, label %else105
+then105:
+  %t105 = add i32 %v105, 1
+  br label %join105
+else105:
+  %e105 = sub i32 %v105, 1
+  br label %join105
+join105:
+  %v106 = phi i32 [ %t105, %then105 ], [ %e105, %else105 ]
+  br label %cond106
+cond106:
+  %c106 = icmp sgt i32 %sel, 106
+  br i1 %c106, label %then106, label %else106
+then106:
+  %t106 = add i32 %v106, 2
+  br label %join106
+else106:
+  %e106 = sub i32 %v106, 2
+  br label %join106
+join106:
+  %v107 = phi i32 [ %t106, %then106 ], [ %e106, %else106 ]
+  br label %cond107
+cond107:
+  %c107 = icmp sgt i32 %sel, 107
+  br i1 %c107, label %then107, label %else107
+then107:
+  %t107 = add i32 %v107, 3
+  br label %join107
+else107:
+  %e107 = sub i32 %v107, 3
+  br label %join107
+join107:
+  %v108 = phi i32 [ %t107, %then107 ], [ %e107, %else107 ]
+  br label %cond108
+cond108:
+  %c108 = icmp sgt i32 %sel, 108
+  br i1 %c108, label %then108, label %else108
+then108:
+  %t108 = add i32 %v108, 4
+  br label %join108
+else108:
+  %e108 = sub i32 %v108, 4
+  br label %join108
+join108:
+  %v109 = phi i32 [ %t108, %then108 ], [ %e108, %else108 ]
+  br label %cond109
+cond109:
+  %c109 = icmp sgt i32 %sel, 109
+  br i1 %c109, label %then109, label %else109
+then109:
+  %t109 = add i32 %v109, 5
+  br label %join109
+else109:
+  %e109 = sub i32 %v109, 5
+  br label %join109
+join109:
+  %v110 = phi i32 [ %t109, %then109 ], [ %e109, %else109 ]
+  br label %cond110
+cond110:
+  %c110 = icmp sgt i32 %sel, 110
+  br i1 %c110, label %then110, label %else110
+then110:
+  %t110 = add i32 %v110, 6
+  br label %join110
+else110:
+  %e110 = sub i32 %v110, 1
+  br label %join110
+join110:
+  %v111 = phi i32 [ %t110, %then110 ], [ %e110, %else110 ]
+  br label %cond111
+cond111:
+  %c111 = icmp sgt i32 %sel, 111
+  br i1 %c111, label %then111, label %else111
+then111:
+  %t111 = add i32 %v111, 7
+  br label %join111
+else111:
+  %e111 = sub i32 %v111, 2
+  br label %join111
+join111:
+  %v112 = phi i32 [ %t111, %then111 ], [ %e111, %else111 ]
+  br label %cond112
+cond112:
+  %c112 = icmp sgt i32 %sel, 112
+  br i1 %c112, label %then112, label %else112
+then112:
+  %t112 = add i32 %v112, 1
+  br label %join112
+else112:
+  %e112 = sub i32 %v112, 3
+  br label %join112
+join112:
+  %v113 = phi i32 [ %t112, %then112 ], [ %e112, %else112 ]
+  br label %cond113
+cond113:
+  %c113 = icmp sgt i32 %sel, 113
+  br i1 %c113, label %then113, label %else113
+then113:
+  %t113 = add i32 %v113, 2
+  br label %join113
+else113:
+  %e113 = sub i32 %v113, 4
+  br label %join113
+join113:
+  %v114 = phi i32 [ %t113, %then113 ], [ %e113, %else113 ]
+  br label %cond114
+cond114:
+  %c114 = icmp sgt i32 %sel, 114
+  br i1 %c114, label %then114, label %else114
+then114:
+  %t114 = add i32 %v114, 3
+  br label %join114
+else114:
+  %e114 = sub i32 %v114, 5
+  br label %join114
+join114:
+  %v115 = phi i32 [ %t114, %then114 ], [ %e114, %else114 ]
+  br label %cond115
+cond115:
+  %c115 = icmp sgt i32 %sel, 115
+  br i1 %c115, label %then115, label %else115
+then115:
+  %t115 = add i32 %v115, 4
+  br label %join115
+else115:
+  %e115 = sub i32 %v115, 1
+  br label %join115
+join115:
+  %v116 = phi i32 [ %t115, %then115 ], [ %e115, %else115 ]
+  br label %cond116
+cond116:
+  %c116 = icmp sgt i32 %sel, 116
+  br i1 %c116, label %then116, label %else116
+then116:
+  %t116 = add i32 %v116, 5
+  br label %join116
+else116:
+  %e116 = sub i32 %v116, 2
+  br label %join116
+join116:
+  %v117 = phi i32 [ %t116, %then116 ], [ %e116, %else116 ]
+  br label %cond117
+cond117:
+  %c117 = icmp sgt i32 %sel, 117
+  br i1 %c117, label %then117, label %else117
+then117:
+  %t117 = add i32 %v117, 6
+  br label %join117
+else117:
+  %e117 = sub i32 %v117, 3
+  br label %join117
+join117:
+  %v118 = phi i32 [ %t117, %then117 ], [ %e117, %else117 ]
+  br label %cond118
+cond118:
+  %c118 = icmp sgt i32 %sel, 118
+  br i1 %c118, label %then118, label %else118
+then118:
+  %t118 = add i32 %v118, 7
+  br label %join118
+else118:
+  %e118 = sub i32 %v118, 4
+  br label %join118
+join118:
+  %v119 = phi i32 [ %t118, %then118 ], [ %e118, %else118 ]
+  br label %cond119
+cond119:
+  %c119 = icmp sgt i32 %sel, 119
+  br i1 %c119, label %then119, label %else119
+then119:
+  %t119 = add i32 %v119, 1
+  br label %join119
+else119:
+  %e119 = sub i32 %v119, 5
+  br label %join119
+join119:
+  %v120 = phi i32 [ %t119, %then119 ], [ %e119, %else119 ]
+  br label %cond120
+cond120:
+  %c120 = icmp sgt i32 %sel, 120
+  br i1 %c120, label %then120, label %else120
+then120:
+  %t120 = add i32 %v120, 2
+  br label %join120
+else120:
+  %e120 = sub i32 %v120, 1
+  br label %join120
+join120:
+  %v121 = phi i32 [ %t120, %then120 ], [ %e120, %else120 ]
+  br label %cond121
+cond121:
+  %c121 = icmp sgt i32 %sel, 121
+  br i1 %c121, label %then121, label %else121
+then121:
+  %t121 = add i32 %v121, 3
+  br label %join121
+else121:
+  %e121 = sub i32 %v121, 2
+  br label %join121
+join121:
+  %v122 = phi i32 [ %t121, %then121 ], [ %e121, %else121 ]
+  br label %cond122
+cond122:
+  %c122 = icmp sgt i32 %sel, 122
+  br i1 %c122, label %then122, label %else122
+then122:
+  %t122 = add i32 %v122, 4
+  br label %join122
+else122:
+  %e122 = sub i32 %v122, 3
+  br label %join122
+join122:
+  %v123 = phi i32 [ %t122, %then122 ], [ %e122, %else122 ]
+  br label %cond123
+cond123:
+  %c123 = icmp sgt i32 %sel, 123
+  br i1 %c123, label %then123, label %else123
+then123:
+  %t123 = add i32 %v123, 5
+  br label %join123
+else123:
+  %e123 = sub i32 %v123, 4
+  br label %join123
+join123:
+  %v124 = phi i32 [ %t123, %then123 ], [ %e123, %else123 ]
+  br label %cond124
+cond124:
+  %c124 = icmp sgt i32 %sel, 124
+  br i1 %c124, label %then124, label %else124
+then124:
+  %t124 = add i32 %v124, 6
+  br label %join124
+else124:
+  %e124 = sub i32 %v124, 5
+  br label %join124
+join124:
+  %v125 = phi i32 [ %t124, %then124 ], [ %e124, %else124 ]
+  br label %cond125
+cond125:
+  %c125 = icmp sgt i32 %sel, 125
+  br i1 %c125, label %then125, label %else125
+then125:
+  %t125 = add i32 %v125, 7
+  br label %join125
+else125:
+  %e125 = sub i32 %v125, 1
+  br label %join125
+join125:
+  %v126 = phi i32 [ %t125, %then125 ], [ %e125, %else125 ]
+  br label %cond126
+cond126:
+  %c126 = icmp sgt i32 %sel, 126
+  br i1 %c126, label %then126, label %else126
+then126:
+  %t126 = add i32 %v126, 1
+  br label %join126
+else126:
+  %e126 = sub i32 %v126, 2
+  br label %join126
+join126:
+  %v127 = phi i32 [ %t126, %then126 ], [ %e126, %else126 ]
+  br label %cond127
+cond127:
+  %c127 = icmp sgt i32 %sel, 127
+  br i1 %c127, label %then127, label %else127
+then127:
+  %t127 = add i32 %v127, 2
+  br label %join127
+else127:
+  %e127 = sub i32 %v127, 3
+  br label %join127
+join127:
+  %v128 = phi i32 [ %t127, %then127 ], [ %e127, %else127 ]
+  br label %cond128
+cond128:
+  %c128 = icmp sgt i32 %sel, 128
+  br i1 %c128, label %then128, label %else128
+then128:
+  %t128 = add i32 %v128, 3
+  br label %join128
+else128:
+  %e128 = sub i32 %v128, 4
+  br label %join128
+join128:
+  %v129 = phi i32 [ %t128, %then128 ], [ %e128, %else128 ]
+  br label %cond129
+cond129:
+  %c129 = icmp sgt i32 %sel, 129
+  br i1 %c129, label %then129, label %else129
+then129:
+  %t129 = add i32 %v129, 4
+  br label %join129
+else129:
+  %e129 = sub i32 %v129, 5
+  br label %join129
+join129:
+  %v130 = phi i32 [ %t129, %then129 ], [ %e129, %else129 ]
+  br label %cond130
+cond130:
+  %c130 = icmp sgt i32 %sel, 130
+  br i1 %c130, label %then130, label %else130
+then130:
+  %t130 = add i32 %v130, 5
+  br label %join130
+else130:
+  %e130 = sub i32 %v130, 1
+  br label %join130
+join130:
+  %v131 = phi i32 [ %t130, %then130 ], [ %e130, %else130 ]
+  br label %cond131
+cond131:
+  %c131 = icmp sgt i32 %sel, 131
+  br i1 %c131, label %then131, label %else131
+then131:
+  %t131 = add i32 %v131, 6
+  br label %join131
+else131:
+  %e131 = sub i32 %v131, 2
+  br label %join131
+join131:
+  %v132 = phi i32 [ %t131, %then131 ], [ %e131, %else131 ]
+  br label %cond132
+cond132:
+  %c132 = icmp sgt i32 %sel, 132
+  br i1 %c132, label %then132, label %else132
+then132:
+  %t132 = add i32 %v132, 7
+  br label %join132
+else132:
+  %e132 = sub i32 %v132, 3
+  br label %join132
+join132:
+  %v133 = phi i32 [ %t132, %then132 ], [ %e132, %else132 ]
+  br label %cond133
+cond133:
+  %c133 = icmp sgt i32 %sel, 133
+  br i1 %c133, label %then133, label %else133
+then133:
+  %t133 = add i32 %v133, 1
+  br label %join133
+else133:
+  %e133 = sub i32 %v133, 4
+  br label %join133
+join133:
+  %v134 = phi i32 [ %t133, %then133 ], [ %e133, %else133 ]
+  br label %cond134
+cond134:
+  %c134 = icmp sgt i32 %sel, 134
+  br i1 %c134, label %then134, label %else134
+then134:
+  %t134 = add i32 %v134, 2
+  br label %join134
+else134:
+  %e134 = sub i32 %v134, 5
+  br label %join134
+join134:
+  %v135 = phi i32 [ %t134, %then134 ], [ %e134, %else134 ]
+  br label %cond135
+cond135:
+  %c135 = icmp sgt i32 %sel, 135
+  br i1 %c135, label %then135, label %else135
+then135:
+  %t135 = add i32 %v135, 3
+  br label %join135
+else135:
+  %e135 = sub i32 %v135, 1
+  br label %join135
+join135:
+  %v136 = phi i32 [ %t135, %then135 ], [ %e135, %else135 ]
+  br label %cond136
+cond136:
+  %c136 = icmp sgt i32 %sel, 136
+  br i1 %c136, label %then136, label %else136
+then136:
+  %t136 = add i32 %v136, 4
+  br label %join136
+else136:
+  %e136 = sub i32 %v136, 2
+  br label %join136
+join136:
+  %v137 = phi i32 [ %t136, %then136 ], [ %e136, %else136 ]
+  br label %cond137
+cond137:
+  %c137 = icmp sgt i32 %sel, 137
+  br i1 %c137, label %then137, label %else137
+then137:
+  %t137 = add i32 %v137, 5
+  br label %join137
+else137:
+  %e137 = sub i32 %v137, 3
+  br label %join137
+join137:
+  %v138 = phi i32 [ %t137, %then137 ], [ %e137, %else137 ]
+  br label %cond138
+cond138:
+  %c138 = icmp sgt i32 %sel, 138
+  br i1 %c138, label %then138, label %else138
+then138:
+  %t138 = add i32 %v138, 6
+  br label %join138
+else138:
+  %e138 = sub i32 %v138, 4
+  br label %join138
+join138:
+  %v139 = phi i32 [ %t138, %then138 ], [ %e138, %else138 ]
+  br label %cond139
+cond139:
+  %c139 = icmp sgt i32 %sel, 139
+  br i1 %c139, label %then139, label %else139
+then139:
+  %t139 = add i32 %v139, 7
+  br label %join139
+else139:
+  %e139 = sub i32 %v139, 5
+  br label %join139
+join139:
+  %v140 = phi i32 [ %t139, %then139 ], [ %e139, %else139 ]
+  br label %cond140
+cond140:
+  %c140 = icmp sgt i32 %sel, 140
+  br i1 %c140, label %then140, label %else140
+then140:
+  %t140 = add i32 %v140, 1
+  br label %join140
+else140:
+  %e140 = sub i32 %v140, 1
+  br label %join140
+join140:
+  %v141 = phi i32 [ %t140, %then140 ], [ %e140, %else140 ]
+  br label %cond141
+cond141:
+  %c141 = icmp sgt i32 %sel, 141
+  br i1 %c141, label %then141, label %else141
+then141:
+  %t141 = add i32 %v141, 2
+  br label %join141
+else141:
+  %e141 = sub i32 %v141, 2
+  br label %join141
+join141:
+  %v142 = phi i32 [ %t141, %then141 ], [ %e141, %else141 ]
+  br label %cond142
+cond142:
+  %c142 = icmp sgt i32 %sel, 142
+  br i1 %c142, label %then142, label %else142
+then142:
+  %t142 = add i32 %v142, 3
+  br label %join142
+else142:
+  %e142 = sub i32 %v142, 3
+  br label %join142
+join142:
+  %v143 = phi i32 [ %t142, %then142 ], [ %e142, %else142 ]
+  br label %cond143
+cond143:
+  %c143 = icmp sgt i32 %sel, 143
+  br i1 %c143, label %then143, label %else143
+then143:
+  %t143 = add i32 %v143, 4
+  br label %join143
+else143:
+  %e143 = sub i32 %v143, 4
+  br label %join143
+join143:
+  %v144 = phi i32 [ %t143, %then143 ], [ %e143, %else143 ]
+  br label %cond144
+cond144:
+  %c144 = icmp sgt i32 %sel, 144
+  br i1 %c144, label %then144, label %else144
+then144:
+  %t144 = add i32 %v144, 5
+  br label %join144
+else144:
+  %e144 = sub i32 %v144, 5
+  br label %join144
+join144:
+  %v145 = phi i32 [ %t144, %then144 ], [ %e144, %else144 ]
+  br label %cond145
+cond145:
+  %c145 = icmp sgt i32 %sel, 145
+  br i1 %c145, label %then145, label %else145
+then145:
+  %t145 = add i32 %v145, 6
+  br label %join145
+else145:
+  %e145 = sub i32 %v145, 1
+  br label %join145
+join145:
+  %v146 = phi i32 [ %t145, %then145 ], [ %e145, %else145 ]
+  br label %cond146
+cond146:
+  %c146 = icmp sgt i32 %sel, 146
+  br i1 %c146, label %then146, label %else146
+then146:
+  %t146 = add i32 %v146, 7
+  br label %join146
+else146:
+  %e146 = sub i32 %v146, 2
+  br label %join146
+join146:
+  %v147 = phi i32 [ %t146, %then146 ], [ %e146, %else146 ]
+  br label %cond147
+cond147:
+  %c147 = icmp sgt i32 %sel, 147
+  br i1 %c147, label %then147, label %else147
+then147:
+  %t147 = add i32 %v147, 1
+  br label %join147
+else147:
+  %e147 = sub i32 %v147, 3
+  br label %join147
+join147:
+  %v148 = phi i32 [ %t147, %then147 ], [ %e147, %else147 ]
+  br label %cond148
+cond148:
+  %c148 = icmp sgt i32 %sel, 148
+  br i1 %c148, label %then148, label %else148
+then148:
+  %t148 = add i32 %v148, 2
+  br label %join148
+else148:
+  %e148 = sub i32 %v148, 4
+  br label %join148
+join148:
+  %v149 = phi i32 [ %t148, %then148 ], [ %e148, %else148 ]
+  br label %cond149
+cond149:
+  %c149 = icmp sgt i32 %sel, 149
+  br i1 %c149, label %then149, label %else149
+then149:
+  %t149 = add i32 %v149, 3
+  br label %join149
+else149:
+  %e149 = sub i32 %v149, 5
+  br label %join149
+join149:
+  %v150 = phi i32 [ %t149, %then149 ], [ %e149, %else149 ]
+  br label %cond150
+cond150:
+  %c150 = icmp sgt i32 %sel, 150
+  br i1 %c150, label %then150, label %else150
+then150:
+  %t150 = add i32 %v150, 4
+  br label %join150
+else150:
+  %e150 = sub i32 %v150, 1
+  br label %join150
+join150:
+  %v151 = phi i32 [ %t150, %then150 ], [ %e150, %else150 ]
+  br label %cond151
+cond151:
+  %c151 = icmp sgt i32 %sel, 151
+  br i1 %c151, label %then151, label %else151
+then151:
+  %t151 = add i32 %v151, 5
+  br label %join151
+else151:
+  %e151 = sub i32 %v151, 2
+  br label %join151
+join151:
+  %v152 = phi i32 [ %t151, %then151 ], [ %e151, %else151 ]
+  br label %cond152
+cond152:
+  %c152 = icmp sgt i32 %sel, 152
+  br i1 %c152, label %then152, label %else152
+then152:
+  %t152 = add i32 %v152, 6
+  br label %join152
+else152:
+  %e152 = sub i32 %v152, 3
+  br label %join152
+join152:
+  %v153 = phi i32 [ %t152, %then152 ], [ %e152, %else152 ]
+  br label %cond153
+cond153:
+  %c153 = icmp sgt i32 %sel, 153
+  br i1 %c153, label %then153, label %else153
+then153:
+  %t153 = add i32 %v153, 7
+  br label %join153
+else153:
+  %e153 = sub i32 %v153, 4
+  br label %join153
+join153:
+  %v154 = phi i32 [ %t153, %then153 ], [ %e153, %else153 ]
+  br label %cond154
+cond154:
+  %c154 = icmp sgt i32 %sel, 154
+  br i1 %c154, label %then154, label %else154
+then154:
+  %t154 = add i32 %v154, 1
+  br label %join154
+else154:
+  %e154 = sub i32 %v154, 5
+  br label %join154
+join154:
+  %v155 = phi i32 [ %t154, %then154 ], [ %e154, %else154 ]
+  br label %cond155
+cond155:
+  %c155 = icmp sgt i32 %sel, 155
+  br i1 %c155, label %then155, label %else155
+then155:
+  %t155 = add i32 %v155, 2
+  br label %join155
+else155:
+  %e155 = sub i32 %v155, 1
+  br label %join155
+join155:
+  %v156 = phi i32 [ %t155, %then155 ], [ %e155, %else155 ]
+  br label %cond156
+cond156:
+  %c156 = icmp sgt i32 %sel, 156
+  br i1 %c156, label %then156, label %else156
+then156:
+  %t156 = add i32 %v156, 3
+  br label %join156
+else156:
+  %e156 = sub i32 %v156, 2
+  br label %join156
+join156:
+  %v157 = phi i32 [ %t156, %then156 ], [ %e156, %else156 ]
+  br label %cond157
+cond157:
+  %c157 = icmp sgt i32 %sel, 157
+  br i1 %c157, label %then157, label %else157
+then157:
+  %t157 = add i32 %v157, 4
+  br label %join157
+else157:
+  %e157 = sub i32 %v157, 3
+  br label %join157
+join157:
+  %v158 = phi i32 [ %t157, %then157 ], [ %e157, %else157 ]
+  br label %cond158
+cond158:
+  %c158 = icmp sgt i32 %sel, 158
+  br i1 %c158, label %then158, label %else158
+then158:
+  %t158 = add i32 %v158, 5
+  br label %join158
+else158:
+  %e158 = sub i32 %v158, 4
+  br label %join158
+join158:
+  %v159 = phi i32 [ %t158, %then158 ], [ %e158, %else158 ]
+  br label %cond159
+cond159:
+  %c159 = icmp sgt i32 %sel, 159
+  br i1 %c159, label %then159, label %else159
+then159:
+  %t159 = add i32 %v159, 6
+  br label %join159
+else159:
+  %e159 = sub i32 %v159, 5
+  br label %join159
+join159:
+  %v160 = phi i32 [ %t159, %then159 ], [ %e159, %else159 ]
+  br label %cond160
+cond160:
+  %c160 = icmp sgt i32 %sel, 160
+  br i1 %c160, label %then160, label %else160
+then160:
+  %t160 = add i32 %v160, 7
+  br label %join160
+else160:
+  %e160 = sub i32 %v160, 1
+  br label %join160
+join160:
+  %v161 = phi i32 [ %t160, %then160 ], [ %e160, %else160 ]
+  br label %cond161
+cond161:
+  %c161 = icmp sgt i32 %sel, 161
+  br i1 %c161, label %then161, label %else161
+then161:
+  %t161 = add i32 %v161, 1
+  br label %join161
+else161:
+  %e161 = sub i32 %v161, 2
+  br label %join161
+join161:
+  %v162 = phi i32 [ %t161, %then161 ], [ %e161, %else161 ]
+  br label %cond162
+cond162:
+  %c162 = icmp sgt i32 %sel, 162
+  br i1 %c162, label %then162, label %else162
+then162:
+  %t162 = add i32 %v162, 2
+  br label %join162
+else162:
+  %e162 = sub i32 %v162, 3
+  br label %join162
+join162:
+  %v163 = phi i32 [ %t162, %then162 ], [ %e162, %else162 ]
+  br label %cond163
+cond163:
+  %c163 = icmp sgt i32 %sel, 163
+  br i1 %c163, label %then163, label %else163
+then163:
+  %t163 = add i32 %v163, 3
+  br label %join163
+else163:
+  %e163 = sub i32 %v163, 4
+  br label %join163
+join163:
+  %v164 = phi i32 [ %t163, %then163 ], [ %e163, %else163 ]
+  br label %cond164
+cond164:
+  %c164 = icmp sgt i32 %sel, 164
+  br i1 %c164, label %then164, label %else164
+then164:
+  %t164 = add i32 %v164, 4
+  br label %join164
+else164:
+  %e164 = sub i32 %v164, 5
+  br label %join164
+join164:
+  %v165 = phi i32 [ %t164, %then164 ], [ %e164, %else164 ]
+  br label %cond165
+cond165:
+  %c165 = icmp sgt i32 %sel, 165
+  br i1 %c165, label %then165, label %else165
+then165:
+  %t165 = add i32 %v165, 5
+  br label %join165
+else165:
+  %e165 = sub i32 %v165, 1
+  br label %join165
+join165:
+  %v166 = phi i32 [ %t165, %then165 ], [ %e165, %else165 ]
+  br label %cond166
+cond166:
+  %c166 = icmp sgt i32 %sel, 166
+  br i1 %c166, label %then166, label %else166
+then166:
+  %t166 = add i32 %v166, 6
+  br label %join166
+else166:
+  %e166 = sub i32 %v166, 2
+  br label %join166
+join166:
+  %v167 = phi i32 [ %t166, %then166 ], [ %e166, %else166 ]
+  br label %cond167
+cond167:
+  %c167 = icmp sgt i32 %sel, 167
+  br i1 %c167, label %then167, label %else167
+then167:
+  %t167 = add i32 %v167, 7
+  br label %join167
+else167:
+  %e167 = sub i32 %v167, 3
+  br label %join167
+join167:
+  %v168 = phi i32 [ %t167, %then167 ], [ %e167, %else167 ]
+  br label %cond168
+cond168:
+  %c168 = icmp sgt i32 %sel, 168
+  br i1 %c168, label %then168, label %else168
+then168:
+  %t168 = add i32 %v168, 1
+  br label %join168
+else168:
+  %e168 = sub i32 %v168, 4
+  br label %join168
+join168:
+  %v169 = phi i32 [ %t168, %then168 ], [ %e168, %else168 ]
+  br label %cond169
+cond169:
+  %c169 = icmp sgt i32 %sel, 169
+  br i1 %c169, label %then169, label %else169
+then169:
+  %t169 = add i32 %v169, 2
+  br label %join169
+else169:
+  %e169 = sub i32 %v169, 5
+  br label %join169
+join169:
+  %v170 = phi i32 [ %t169, %then169 ], [ %e169, %else169 ]
+  br label %cond170
+cond170:
+  %c170 = icmp sgt i32 %sel, 170
+  br i1 %c170, label %then170, label %else170
+then170:
+  %t170 = add i32 %v170, 3
+  br label %join170
+else170:
+  %e170 = sub i32 %v170, 1
+  br label %join170
+join170:
+  %v171 = phi i32 [ %t170, %then170 ], [ %e170, %else170 ]
+  br label %cond171
+cond171:
+  %c171 = icmp sgt i32 %sel, 171
+  br i1 %c171, label %then171, label %else171
+then171:
+  %t171 = add i32 %v171, 4
+  br label %join171
+else171:
+  %e171 = sub i32 %v171, 2
+  br label %join171
+join171:
+  %v172 = phi i32 [ %t171, %then171 ], [ %e171, %else171 ]
+  br label %cond172
+cond172:
+  %c172 = icmp sgt i32 %sel, 172
+  br i1 %c172, label %then172, label %else172
+then172:
+  %t172 = add i32 %v172, 5
+  br label %join172
+else172:
+  %e172 = sub i32 %v172, 3
+  br label %join172
+join172:
+  %v173 = phi i32 [ %t172, %then172 ], [ %e172, %else172 ]
+  br label %cond173
+cond173:
+  %c173 = icmp sgt i32 %sel, 173
+  br i1 %c173, label %then173, label %else173
+then173:
+  %t173 = add i32 %v173, 6
+  br label %join173
+else173:
+  %e173 = sub i32 %v173, 4
+  br label %join173
+join173:
+  %v174 = phi i32 [ %t173, %then173 ], [ %e173, %else173 ]
+  br label %cond174
+cond174:
+  %c174 = icmp sgt i32 %sel, 174
+  br i1 %c174, label %then174, label %else174
+then174:
+  %t174 = add i32 %v174, 7
+  br label %join174
+else174:
+  %e174 = sub i32 %v174, 5
+  br label %join174
+join174:
+  %v175 = phi i32 [ %t174, %then174 ], [ %e174, %else174 ]
+  br label %cond175
+cond175:
+  %c175 = icmp sgt i32 %sel, 175
+  br i1 %c175, label %then175, label %else175
+then175:
+  %t175 = add i32 %v175, 1
+  br label %join175
+else175:
+  %e175 = sub i32 %v175, 1
+  br label %join175
+join175:
+  %v176 = phi i32 [ %t175, %then175 ], [ %e175, %else175 ]
+  br label %cond176
+cond176:
+  %c176 = icmp sgt i32 %sel, 176
+  br i1 %c176, label %then176, label %else176
+then176:
+  %t176 = add i32 %v176, 2
+  br label %join176
+else176:
+  %e176 = sub i32 %v176, 2
+  br label %join176
+join176:
+  %v177 = phi i32 [ %t176, %then176 ], [ %e176, %else176 ]
+  br label %cond177
+cond177:
+  %c177 = icmp sgt i32 %sel, 177
+  br i1 %c177, label %then177, label %else177
+then177:
+  %t177 = add i32 %v177, 3
+  br label %join177
+else177:
+  %e177 = sub i32 %v177, 3
+  br label %join177
+join177:
+  %v178 = phi i32 [ %t177, %then177 ], [ %e177, %else177 ]
+  br label %cond178
+cond178:
+  %c178 = icmp sgt i32 %sel, 178
+  br i1 %c178, label %then178, label %else178
+then178:
+  %t178 = add i32 %v178, 4
+  br label %join178
+else178:
+  %e178 = sub i32 %v178, 4
+  br label %join178
+join178:
+  %v179 = phi i32 [ %t178, %then178 ], [ %e178, %else178 ]
+  br label %cond179
+cond179:
+  %c179 = icmp sgt i32 %sel, 179
+  br i1 %c179, label %then179, label %else179
+then179:
+  %t179 = add i32 %v179, 5
+  br label %join179
+else179:
+  %e179 = sub i32 %v179, 5
+  br label %join179
+join179:
+  %v180 = phi i32 [ %t179, %then179 ], [ %e179, %else179 ]
+  br label %cond180
+cond180:
+  %c180 = icmp sgt i32 %sel, 180
+  br i1 %c180, label %then180, label %else180
+then180:
+  %t180 = add i32 %v180, 6
+  br label %join180
+else180:
+  %e180 = sub i32 %v180, 1
+  br label %join180
+join180:
+  %v181 = phi i32 [ %t180, %then180 ], [ %e180, %else180 ]
+  br label %cond181
+cond181:
+  %c181 = icmp sgt i32 %sel, 181
+  br i1 %c181, label %then181, label %else181
+then181:
+  %t181 = add i32 %v181, 7
+  br label %join181
+else181:
+  %e181 = sub i32 %v181, 2
+  br label %join181
+join181:
+  %v182 = phi i32 [ %t181, %then181 ], [ %e181, %else181 ]
+  br label %cond182
+cond182:
+  %c182 = icmp sgt i32 %sel, 182
+  br i1 %c182, label %then182, label %else182
+then182:
+  %t182 = add i32 %v182, 1
+  br label %join182
+else182:
+  %e182 = sub i32 %v182, 3
+  br label %join182
+join182:
+  %v183 = phi i32 [ %t182, %then182 ], [ %e182, %else182 ]
+  br label %cond183
+cond183:
+  %c183 = icmp sgt i32 %sel, 183
+  br i1 %c183, label %then183, label %else183
+then183:
+  %t183 = add i32 %v183, 2
+  br label %join183
+else183:
+  %e183 = sub i32 %v183, 4
+  br label %join183
+join183:
+  %v184 = phi i32 [ %t183, %then183 ], [ %e183, %else183 ]
+  br label %cond184
+cond184:
+  %c184 = icmp sgt i32 %sel, 184
+  br i1 %c184, label %then184, label %else184
+then184:
+  %t184 = add i32 %v184, 3
+  br label %join184
+else184:
+  %e184 = sub i32 %v184, 5
+  br label %join184
+join184:
+  %v185 = phi i32 [ %t184, %then184 ], [ %e184, %else184 ]
+  br label %cond185
+cond185:
+  %c185 = icmp sgt i32 %sel, 185
+  br i1 %c185, label %then185, label %else185
+then185:
+  %t185 = add i32 %v185, 4
+  br label %join185
+else185:
+  %e185 = sub i32 %v185, 1
+  br label %join185
+join185:
+  %v186 = phi i32 [ %t185, %then185 ], [ %e185, %else185 ]
+  br label %cond186
+cond186:
+  %c186 = icmp sgt i32 %sel, 186
+  br i1 %c186, label %then186, label %else186
+then186:
+  %t186 = add i32 %v186, 5
+  br label %join186
+else186:
+  %e186 = sub i32 %v186, 2
+  br label %join186
+join186:
+  %v187 = phi i32 [ %t186, %then186 ], [ %e186, %else186 ]
+  br label %cond187
+cond187:
+  %c187 = icmp sgt i32 %sel, 187
+  br i1 %c187, label %then187, label %else187
+then187:
+  %t187 = add i32 %v187, 6
+  br label %join187
+else187:
+  %e187 = sub i32 %v187, 3
+  br label %join187
+join187:
+  %v188 = phi i32 [ %t187, %then187 ], [ %e187, %else187 ]
+  br label %cond188
+cond188:
+  %c188 = icmp sgt i32 %sel, 188
+  br i1 %c188, label %then188, label %else188
+then188:
+  %t188 = add i32 %v188, 7
+  br label %join188
+else188:
+  %e188 = sub i32 %v188, 4
+  br label %join188
+join188:
+  %v189 = phi i32 [ %t188, %then188 ], [ %e188, %else188 ]
+  br label %cond189
+cond189:
+  %c189 = icmp sgt i32 %sel, 189
+  br i1 %c189, label %then189, label %else189
+then189:
+  %t189 = add i32 %v189, 1
+  br label %join189
+else189:
+  %e189 = sub i32 %v189, 5
+  br label %join189
+join189:
+  %v190 = phi i32 [ %t189, %then189 ], [ %e189, %else189 ]
+  br label %cond190
+cond190:
+  %c190 = icmp sgt i32 %sel, 190
+  br i1 %c190, label %then190, label %else190
+then190:
+  %t190 = add i32 %v190, 2
+  br label %join190
+else190:
+  %e190 = sub i32 %v190, 1
+  br label %join190
+join190:
+  %v191 = phi i32 [ %t190, %then190 ], [ %e190, %else190 ]
+  br label %cond191
+cond191:
+  %c191 = icmp sgt i32 %sel, 191
+  br i1 %c191, label %then191, label %else191
+then191:
+  %t191 = add i32 %v191, 3
+  br label %join191
+else191:
+  %e191 = sub i32 %v191, 2
+  br label %join191
+join191:
+  %v192 = phi i32 [ %t191, %then191 ], [ %e191, %else191 ]
+  br label %cond192
+cond192:
+  %c192 = icmp sgt i32 %sel, 192
+  br i1 %c192, label %then192, label %else192
+then192:
+  %t192 = add i32 %v192, 4
+  br label %join192
+else192:
+  %e192 = sub i32 %v192, 3
+  br label %join192
+join192:
+  %v193 = phi i32 [ %t192, %then192 ], [ %e192, %else192 ]
+  br label %cond193
+cond193:
+  %c193 = icmp sgt i32 %sel, 193
+  br i1 %c193, label %then193, label %else193
+then193:
+  %t193 = add i32 %v193, 5
+  br label %join193
+else193:
+  %e193 = sub i32 %v193, 4
+  br label %join193
+join193:
+  %v194 = phi i32 [ %t193, %then193 ], [ %e193, %else193 ]
+  br label %cond194
+cond194:
+  %c194 = icmp sgt i32 %sel, 194
+  br i1 %c194, label %then194, label %else194
+then194:
+  %t194 = add i32 %v194, 6
+  br label %join194
+else194:
+  %e194 = sub i32 %v194, 5
+  br label %join194
+join194:
+  %v195 = phi i32 [ %t194, %then194 ], [ %e194, %else194 ]
+  br label %cond195
+cond195:
+  %c195 = icmp sgt i32 %sel, 195
+  br i1 %c195, label %then195, label %else195
+then195:
+  %t195 = add i32 %v195, 7
+  br label %join195
+else195:
+  %e195 = sub i32 %v195, 1
+  br label %join195
+join195:
+  %v196 = phi i32 [ %t195, %then195 ], [ %e195, %else195 ]
+  br label %cond196
+cond196:
+  %c196 = icmp sgt i32 %sel, 196
+  br i1 %c196, label %then196, label %else196
+then196:
+  %t196 = add i32 %v196, 1
+  br label %join196
+else196:
+  %e196 = sub i32 %v196, 2
+  br label %join196
+join196:
+  %v197 = phi i32 [ %t196, %then196 ], [ %e196, %else196 ]
+  br label %cond197
+cond197:
+  %c197 = icmp sgt i32 %sel, 197
+  br i1 %c197, label %then197, label %else197
+then197:
+  %t197 = add i32 %v197, 2
+  br label %join197
+else197:
+  %e197 = sub i32 %v197, 3
+  br label %join197
+join197:
+  %v198 = phi i32 [ %t197, %then197 ], [ %e197, %else197 ]
+  br label %cond198
+cond198:
+  %c198 = icmp sgt i32 %sel, 198
+  br i1 %c198, label %then198, label %else198
+then198:
+  %t198 = add i32 %v198, 3
+  br label %join198
+else198:
+  %e198 = sub i32 %v198, 4
+  br label %join198
+join198:
+  %v199 = phi i32 [ %t198, %then198 ], [ %e198, %else198 ]
+  br label %cond199
+cond199:
+  %c199 = icmp sgt i32 %sel, 199
+  br i1 %c199, label %then199, label %else199
+then199:
+  %t199 = add i32 %v199, 4
+  br label %join199
+else199:
+  %e199 = sub i32 %v199, 5
+  br label %join199
+join199:
+  %v200 = phi i32 [ %t199, %then199 ], [ %e199, %else199 ]
+  br label %exit
+exit:
+  ret i32 %v200
+}
@@ -0,0 +1,10181 @@
+; 600 functions, each one calling the two previous ones (call graph levels)
+define i32 @fn0(i32 %a, i32 %b) {
+entry:
+  %s = add i32 %a, 1
+  %c = icmp slt i32 %s, 100
+  %r = select i1 %c, i32 %s, i32 100
+  ret i32 %r
+}
+define i32 @fn1(i32 %a, i32 %b) {
+entry:
+  %s = add i32 %a, 2
+  %c = icmp slt i32 %s, 100
+  %r = select i1 %c, i32 %s, i32 100
+  ret i32 %r
+}
+define i32 @fn2(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn1(i32 %a, i32 2)
+  %y = call i32 @fn0(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn3(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn2(i32 %a, i32 3)
+  %y = call i32 @fn1(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn4(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn3(i32 %a, i32 4)
+  %y = call i32 @fn2(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn5(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn4(i32 %a, i32 5)
+  %y = call i32 @fn3(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn6(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn5(i32 %a, i32 6)
+  %y = call i32 @fn4(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn7(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn6(i32 %a, i32 7)
+  %y = call i32 @fn5(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn8(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn7(i32 %a, i32 8)
+  %y = call i32 @fn6(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn9(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn8(i32 %a, i32 9)
+  %y = call i32 @fn7(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn10(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn9(i32 %a, i32 0)
+  %y = call i32 @fn8(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn11(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn10(i32 %a, i32 1)
+  %y = call i32 @fn9(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn12(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn11(i32 %a, i32 2)
+  %y = call i32 @fn10(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn13(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn12(i32 %a, i32 3)
+  %y = call i32 @fn11(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn14(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn13(i32 %a, i32 4)
+  %y = call i32 @fn12(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn15(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn14(i32 %a, i32 5)
+  %y = call i32 @fn13(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn16(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn15(i32 %a, i32 6)
+  %y = call i32 @fn14(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn17(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn16(i32 %a, i32 7)
+  %y = call i32 @fn15(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn18(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn17(i32 %a, i32 8)
+  %y = call i32 @fn16(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn19(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn18(i32 %a, i32 9)
+  %y = call i32 @fn17(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn20(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn19(i32 %a, i32 0)
+  %y = call i32 @fn18(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn21(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn20(i32 %a, i32 1)
+  %y = call i32 @fn19(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn22(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn21(i32 %a, i32 2)
+  %y = call i32 @fn20(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn23(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn22(i32 %a, i32 3)
+  %y = call i32 @fn21(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn24(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn23(i32 %a, i32 4)
+  %y = call i32 @fn22(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn25(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn24(i32 %a, i32 5)
+  %y = call i32 @fn23(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn26(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn25(i32 %a, i32 6)
+  %y = call i32 @fn24(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn27(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn26(i32 %a, i32 7)
+  %y = call i32 @fn25(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn28(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn27(i32 %a, i32 8)
+  %y = call i32 @fn26(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn29(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn28(i32 %a, i32 9)
+  %y = call i32 @fn27(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn30(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn29(i32 %a, i32 0)
+  %y = call i32 @fn28(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn31(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn30(i32 %a, i32 1)
+  %y = call i32 @fn29(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn32(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn31(i32 %a, i32 2)
+  %y = call i32 @fn30(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn33(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn32(i32 %a, i32 3)
+  %y = call i32 @fn31(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn34(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn33(i32 %a, i32 4)
+  %y = call i32 @fn32(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn35(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn34(i32 %a, i32 5)
+  %y = call i32 @fn33(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn36(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn35(i32 %a, i32 6)
+  %y = call i32 @fn34(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn37(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn36(i32 %a, i32 7)
+  %y = call i32 @fn35(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn38(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn37(i32 %a, i32 8)
+  %y = call i32 @fn36(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn39(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn38(i32 %a, i32 9)
+  %y = call i32 @fn37(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn40(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn39(i32 %a, i32 0)
+  %y = call i32 @fn38(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn41(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn40(i32 %a, i32 1)
+  %y = call i32 @fn39(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn42(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn41(i32 %a, i32 2)
+  %y = call i32 @fn40(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn43(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn42(i32 %a, i32 3)
+  %y = call i32 @fn41(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn44(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn43(i32 %a, i32 4)
+  %y = call i32 @fn42(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn45(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn44(i32 %a, i32 5)
+  %y = call i32 @fn43(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn46(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn45(i32 %a, i32 6)
+  %y = call i32 @fn44(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn47(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn46(i32 %a, i32 7)
+  %y = call i32 @fn45(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn48(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn47(i32 %a, i32 8)
+  %y = call i32 @fn46(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn49(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn48(i32 %a, i32 9)
+  %y = call i32 @fn47(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn50(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn49(i32 %a, i32 0)
+  %y = call i32 @fn48(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn51(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn50(i32 %a, i32 1)
+  %y = call i32 @fn49(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn52(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn51(i32 %a, i32 2)
+  %y = call i32 @fn50(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn53(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn52(i32 %a, i32 3)
+  %y = call i32 @fn51(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn54(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn53(i32 %a, i32 4)
+  %y = call i32 @fn52(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn55(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn54(i32 %a, i32 5)
+  %y = call i32 @fn53(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn56(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn55(i32 %a, i32 6)
+  %y = call i32 @fn54(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn57(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn56(i32 %a, i32 7)
+  %y = call i32 @fn55(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn58(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn57(i32 %a, i32 8)
+  %y = call i32 @fn56(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn59(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn58(i32 %a, i32 9)
+  %y = call i32 @fn57(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn60(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn59(i32 %a, i32 0)
+  %y = call i32 @fn58(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn61(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn60(i32 %a, i32 1)
+  %y = call i32 @fn59(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn62(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn61(i32 %a, i32 2)
+  %y = call i32 @fn60(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn63(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn62(i32 %a, i32 3)
+  %y = call i32 @fn61(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn64(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn63(i32 %a, i32 4)
+  %y = call i32 @fn62(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn65(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn64(i32 %a, i32 5)
+  %y = call i32 @fn63(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn66(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn65(i32 %a, i32 6)
+  %y = call i32 @fn64(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn67(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn66(i32 %a, i32 7)
+  %y = call i32 @fn65(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn68(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn67(i32 %a, i32 8)
+  %y = call i32 @fn66(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn69(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn68(i32 %a, i32 9)
+  %y = call i32 @fn67(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn70(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn69(i32 %a, i32 0)
+  %y = call i32 @fn68(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn71(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn70(i32 %a, i32 1)
+  %y = call i32 @fn69(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn72(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn71(i32 %a, i32 2)
+  %y = call i32 @fn70(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn73(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn72(i32 %a, i32 3)
+  %y = call i32 @fn71(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn74(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn73(i32 %a, i32 4)
+  %y = call i32 @fn72(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn75(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn74(i32 %a, i32 5)
+  %y = call i32 @fn73(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn76(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn75(i32 %a, i32 6)
+  %y = call i32 @fn74(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn77(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn76(i32 %a, i32 7)
+  %y = call i32 @fn75(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn78(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn77(i32 %a, i32 8)
+  %y = call i32 @fn76(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn79(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn78(i32 %a, i32 9)
+  %y = call i32 @fn77(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn80(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn79(i32 %a, i32 0)
+  %y = call i32 @fn78(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn81(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn80(i32 %a, i32 1)
+  %y = call i32 @fn79(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn82(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn81(i32 %a, i32 2)
+  %y = call i32 @fn80(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn83(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn82(i32 %a, i32 3)
+  %y = call i32 @fn81(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn84(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn83(i32 %a, i32 4)
+  %y = call i32 @fn82(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn85(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn84(i32 %a, i32 5)
+  %y = call i32 @fn83(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn86(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn85(i32 %a, i32 6)
+  %y = call i32 @fn84(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn87(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn86(i32 %a, i32 7)
+  %y = call i32 @fn85(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn88(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn87(i32 %a, i32 8)
+  %y = call i32 @fn86(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn89(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn88(i32 %a, i32 9)
+  %y = call i32 @fn87(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn90(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn89(i32 %a, i32 0)
+  %y = call i32 @fn88(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn91(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn90(i32 %a, i32 1)
+  %y = call i32 @fn89(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn92(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn91(i32 %a, i32 2)
+  %y = call i32 @fn90(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn93(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn92(i32 %a, i32 3)
+  %y = call i32 @fn91(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn94(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn93(i32 %a, i32 4)
+  %y = call i32 @fn92(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn95(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn94(i32 %a, i32 5)
+  %y = call i32 @fn93(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn96(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn95(i32 %a, i32 6)
+  %y = call i32 @fn94(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn97(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn96(i32 %a, i32 7)
+  %y = call i32 @fn95(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn98(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn97(i32 %a, i32 8)
+  %y = call i32 @fn96(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn99(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn98(i32 %a, i32 9)
+  %y = call i32 @fn97(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn100(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn99(i32 %a, i32 0)
+  %y = call i32 @fn98(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn101(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn100(i32 %a, i32 1)
+  %y = call i32 @fn99(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn102(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn101(i32 %a, i32 2)
+  %y = call i32 @fn100(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn103(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn102(i32 %a, i32 3)
+  %y = call i32 @fn101(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn104(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn103(i32 %a, i32 4)
+  %y = call i32 @fn102(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn105(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn104(i32 %a, i32 5)
+  %y = call i32 @fn103(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn106(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn105(i32 %a, i32 6)
+  %y = call i32 @fn104(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn107(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn106(i32 %a, i32 7)
+  %y = call i32 @fn105(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn108(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn107(i32 %a, i32 8)
+  %y = call i32 @fn106(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn109(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn108(i32 %a, i32 9)
+  %y = call i32 @fn107(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn110(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn109(i32 %a, i32 0)
+  %y = call i32 @fn108(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn111(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn110(i32 %a, i32 1)
+  %y = call i32 @fn109(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn112(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn111(i32 %a, i32 2)
+  %y = call i32 @fn110(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn113(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn112(i32 %a, i32 3)
+  %y = call i32 @fn111(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn114(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn113(i32 %a, i32 4)
+  %y = call i32 @fn112(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn115(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn114(i32 %a, i32 5)
+  %y = call i32 @fn113(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn116(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn115(i32 %a, i32 6)
+  %y = call i32 @fn114(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn117(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn116(i32 %a, i32 7)
+  %y = call i32 @fn115(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn118(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn117(i32 %a, i32 8)
+  %y = call i32 @fn116(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn119(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn118(i32 %a, i32 9)
+  %y = call i32 @fn117(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn120(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn119(i32 %a, i32 0)
+  %y = call i32 @fn118(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn121(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn120(i32 %a, i32 1)
+  %y = call i32 @fn119(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn122(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn121(i32 %a, i32 2)
+  %y = call i32 @fn120(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn123(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn122(i32 %a, i32 3)
+  %y = call i32 @fn121(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn124(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn123(i32 %a, i32 4)
+  %y = call i32 @fn122(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn125(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn124(i32 %a, i32 5)
+  %y = call i32 @fn123(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn126(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn125(i32 %a, i32 6)
+  %y = call i32 @fn124(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn127(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn126(i32 %a, i32 7)
+  %y = call i32 @fn125(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn128(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn127(i32 %a, i32 8)
+  %y = call i32 @fn126(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn129(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn128(i32 %a, i32 9)
+  %y = call i32 @fn127(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn130(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn129(i32 %a, i32 0)
+  %y = call i32 @fn128(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn131(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn130(i32 %a, i32 1)
+  %y = call i32 @fn129(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn132(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn131(i32 %a, i32 2)
+  %y = call i32 @fn130(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn133(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn132(i32 %a, i32 3)
+  %y = call i32 @fn131(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn134(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn133(i32 %a, i32 4)
+  %y = call i32 @fn132(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn135(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn134(i32 %a, i32 5)
+  %y = call i32 @fn133(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn136(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn135(i32 %a, i32 6)
+  %y = call i32 @fn134(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn137(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn136(i32 %a, i32 7)
+  %y = call i32 @fn135(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn138(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn137(i32 %a, i32 8)
+  %y = call i32 @fn136(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn139(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn138(i32 %a, i32 9)
+  %y = call i32 @fn137(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn140(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn139(i32 %a, i32 0)
+  %y = call i32 @fn138(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn141(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn140(i32 %a, i32 1)
+  %y = call i32 @fn139(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn142(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn141(i32 %a, i32 2)
+  %y = call i32 @fn140(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn143(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn142(i32 %a, i32 3)
+  %y = call i32 @fn141(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn144(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn143(i32 %a, i32 4)
+  %y = call i32 @fn142(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn145(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn144(i32 %a, i32 5)
+  %y = call i32 @fn143(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn146(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn145(i32 %a, i32 6)
+  %y = call i32 @fn144(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn147(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn146(i32 %a, i32 7)
+  %y = call i32 @fn145(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn148(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn147(i32 %a, i32 8)
+  %y = call i32 @fn146(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn149(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn148(i32 %a, i32 9)
+  %y = call i32 @fn147(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn150(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn149(i32 %a, i32 0)
+  %y = call i32 @fn148(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn151(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn150(i32 %a, i32 1)
+  %y = call i32 @fn149(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn152(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn151(i32 %a, i32 2)
+  %y = call i32 @fn150(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn153(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn152(i32 %a, i32 3)
+  %y = call i32 @fn151(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn154(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn153(i32 %a, i32 4)
+  %y = call i32 @fn152(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn155(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn154(i32 %a, i32 5)
+  %y = call i32 @fn153(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn156(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn155(i32 %a, i32 6)
+  %y = call i32 @fn154(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn157(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn156(i32 %a, i32 7)
+  %y = call i32 @fn155(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn158(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn157(i32 %a, i32 8)
+  %y = call i32 @fn156(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn159(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn158(i32 %a, i32 9)
+  %y = call i32 @fn157(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn160(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn159(i32 %a, i32 0)
+  %y = call i32 @fn158(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn161(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn160(i32 %a, i32 1)
+  %y = call i32 @fn159(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn162(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn161(i32 %a, i32 2)
+  %y = call i32 @fn160(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn163(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn162(i32 %a, i32 3)
+  %y = call i32 @fn161(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn164(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn163(i32 %a, i32 4)
+  %y = call i32 @fn162(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn165(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn164(i32 %a, i32 5)
+  %y = call i32 @fn163(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn166(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn165(i32 %a, i32 6)
+  %y = call i32 @fn164(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn167(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn166(i32 %a, i32 7)
+  %y = call i32 @fn165(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn168(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn167(i32 %a, i32 8)
+  %y = call i32 @fn166(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn169(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn168(i32 %a, i32 9)
+  %y = call i32 @fn167(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn170(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn169(i32 %a, i32 0)
+  %y = call i32 @fn168(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn171(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn170(i32 %a, i32 1)
+  %y = call i32 @fn169(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn172(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn171(i32 %a, i32 2)
+  %y = call i32 @fn170(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn173(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn172(i32 %a, i32 3)
+  %y = call i32 @fn171(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn174(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn173(i32 %a, i32 4)
+  %y = call i32 @fn172(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn175(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn174(i32 %a, i32 5)
+  %y = call i32 @fn173(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn176(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn175(i32 %a, i32 6)
+  %y = call i32 @fn174(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn177(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn176(i32 %a, i32 7)
+  %y = call i32 @fn175(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn178(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn177(i32 %a, i32 8)
+  %y = call i32 @fn176(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn179(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn178(i32 %a, i32 9)
+  %y = call i32 @fn177(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn180(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn179(i32 %a, i32 0)
+  %y = call i32 @fn178(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn181(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn180(i32 %a, i32 1)
+  %y = call i32 @fn179(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn182(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn181(i32 %a, i32 2)
+  %y = call i32 @fn180(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn183(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn182(i32 %a, i32 3)
+  %y = call i32 @fn181(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn184(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn183(i32 %a, i32 4)
+  %y = call i32 @fn182(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn185(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn184(i32 %a, i32 5)
+  %y = call i32 @fn183(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn186(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn185(i32 %a, i32 6)
+  %y = call i32 @fn184(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn187(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn186(i32 %a, i32 7)
+  %y = call i32 @fn185(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn188(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn187(i32 %a, i32 8)
+  %y = call i32 @fn186(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn189(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn188(i32 %a, i32 9)
+  %y = call i32 @fn187(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn190(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn189(i32 %a, i32 0)
+  %y = call i32 @fn188(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn191(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn190(i32 %a, i32 1)
+  %y = call i32 @fn189(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn192(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn191(i32 %a, i32 2)
+  %y = call i32 @fn190(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn193(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn192(i32 %a, i32 3)
+  %y = call i32 @fn191(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn194(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn193(i32 %a, i32 4)
+  %y = call i32 @fn192(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn195(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn194(i32 %a, i32 5)
+  %y = call i32 @fn193(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn196(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn195(i32 %a, i32 6)
+  %y = call i32 @fn194(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn197(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn196(i32 %a, i32 7)
+  %y = call i32 @fn195(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn198(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn197(i32 %a, i32 8)
+  %y = call i32 @fn196(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn199(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn198(i32 %a, i32 9)
+  %y = call i32 @fn197(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn200(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn199(i32 %a, i32 0)
+  %y = call i32 @fn198(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn201(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn200(i32 %a, i32 1)
+  %y = call i32 @fn199(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn202(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn201(i32 %a, i32 2)
+  %y = call i32 @fn200(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn203(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn202(i32 %a, i32 3)
+  %y = call i32 @fn201(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn204(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn203(i32 %a, i32 4)
+  %y = call i32 @fn202(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn205(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn204(i32 %a, i32 5)
+  %y = call i32 @fn203(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn206(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn205(i32 %a, i32 6)
+  %y = call i32 @fn204(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn207(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn206(i32 %a, i32 7)
+  %y = call i32 @fn205(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn208(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn207(i32 %a, i32 8)
+  %y = call i32 @fn206(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn209(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn208(i32 %a, i32 9)
+  %y = call i32 @fn207(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn210(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn209(i32 %a, i32 0)
+  %y = call i32 @fn208(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn211(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn210(i32 %a, i32 1)
+  %y = call i32 @fn209(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn212(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn211(i32 %a, i32 2)
+  %y = call i32 @fn210(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn213(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn212(i32 %a, i32 3)
+  %y = call i32 @fn211(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn214(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn213(i32 %a, i32 4)
+  %y = call i32 @fn212(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn215(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn214(i32 %a, i32 5)
+  %y = call i32 @fn213(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn216(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn215(i32 %a, i32 6)
+  %y = call i32 @fn214(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn217(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn216(i32 %a, i32 7)
+  %y = call i32 @fn215(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn218(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn217(i32 %a, i32 8)
+  %y = call i32 @fn216(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn219(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn218(i32 %a, i32 9)
+  %y = call i32 @fn217(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn220(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn219(i32 %a, i32 0)
+  %y = call i32 @fn218(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn221(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn220(i32 %a, i32 1)
+  %y = call i32 @fn219(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn222(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn221(i32 %a, i32 2)
+  %y = call i32 @fn220(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn223(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn222(i32 %a, i32 3)
+  %y = call i32 @fn221(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn224(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn223(i32 %a, i32 4)
+  %y = call i32 @fn222(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn225(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn224(i32 %a, i32 5)
+  %y = call i32 @fn223(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn226(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn225(i32 %a, i32 6)
+  %y = call i32 @fn224(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn227(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn226(i32 %a, i32 7)
+  %y = call i32 @fn225(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn228(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn227(i32 %a, i32 8)
+  %y = call i32 @fn226(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn229(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn228(i32 %a, i32 9)
+  %y = call i32 @fn227(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn230(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn229(i32 %a, i32 0)
+  %y = call i32 @fn228(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn231(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn230(i32 %a, i32 1)
+  %y = call i32 @fn229(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn232(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn231(i32 %a, i32 2)
+  %y = call i32 @fn230(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn233(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn232(i32 %a, i32 3)
+  %y = call i32 @fn231(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn234(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn233(i32 %a, i32 4)
+  %y = call i32 @fn232(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn235(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn234(i32 %a, i32 5)
+  %y = call i32 @fn233(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn236(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn235(i32 %a, i32 6)
+  %y = call i32 @fn234(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn237(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn236(i32 %a, i32 7)
+  %y = call i32 @fn235(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn238(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn237(i32 %a, i32 8)
+  %y = call i32 @fn236(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn239(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn238(i32 %a, i32 9)
+  %y = call i32 @fn237(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn240(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn239(i32 %a, i32 0)
+  %y = call i32 @fn238(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn241(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn240(i32 %a, i32 1)
+  %y = call i32 @fn239(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn242(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn241(i32 %a, i32 2)
+  %y = call i32 @fn240(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn243(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn242(i32 %a, i32 3)
+  %y = call i32 @fn241(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn244(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn243(i32 %a, i32 4)
+  %y = call i32 @fn242(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn245(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn244(i32 %a, i32 5)
+  %y = call i32 @fn243(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn246(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn245(i32 %a, i32 6)
+  %y = call i32 @fn244(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn247(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn246(i32 %a, i32 7)
+  %y = call i32 @fn245(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn248(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn247(i32 %a, i32 8)
+  %y = call i32 @fn246(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn249(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn248(i32 %a, i32 9)
+  %y = call i32 @fn247(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn250(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn249(i32 %a, i32 0)
+  %y = call i32 @fn248(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn251(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn250(i32 %a, i32 1)
+  %y = call i32 @fn249(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn252(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn251(i32 %a, i32 2)
+  %y = call i32 @fn250(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn253(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn252(i32 %a, i32 3)
+  %y = call i32 @fn251(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn254(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn253(i32 %a, i32 4)
+  %y = call i32 @fn252(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn255(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn254(i32 %a, i32 5)
+  %y = call i32 @fn253(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn256(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn255(i32 %a, i32 6)
+  %y = call i32 @fn254(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn257(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn256(i32 %a, i32 7)
+  %y = call i32 @fn255(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn258(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn257(i32 %a, i32 8)
+  %y = call i32 @fn256(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn259(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn258(i32 %a, i32 9)
+  %y = call i32 @fn257(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn260(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn259(i32 %a, i32 0)
+  %y = call i32 @fn258(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn261(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn260(i32 %a, i32 1)
+  %y = call i32 @fn259(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn262(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn261(i32 %a, i32 2)
+  %y = call i32 @fn260(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn263(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn262(i32 %a, i32 3)
+  %y = call i32 @fn261(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn264(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn263(i32 %a, i32 4)
+  %y = call i32 @fn262(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn265(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn264(i32 %a, i32 5)
+  %y = call i32 @fn263(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn266(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn265(i32 %a, i32 6)
+  %y = call i32 @fn264(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn267(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn266(i32 %a, i32 7)
+  %y = call i32 @fn265(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn268(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn267(i32 %a, i32 8)
+  %y = call i32 @fn266(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn269(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn268(i32 %a, i32 9)
+  %y = call i32 @fn267(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn270(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn269(i32 %a, i32 0)
+  %y = call i32 @fn268(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn271(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn270(i32 %a, i32 1)
+  %y = call i32 @fn269(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn272(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn271(i32 %a, i32 2)
+  %y = call i32 @fn270(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn273(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn272(i32 %a, i32 3)
+  %y = call i32 @fn271(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn274(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn273(i32 %a, i32 4)
+  %y = call i32 @fn272(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn275(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn274(i32 %a, i32 5)
+  %y = call i32 @fn273(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn276(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn275(i32 %a, i32 6)
+  %y = call i32 @fn274(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn277(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn276(i32 %a, i32 7)
+  %y = call i32 @fn275(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn278(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn277(i32 %a, i32 8)
+  %y = call i32 @fn276(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn279(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn278(i32 %a, i32 9)
+  %y = call i32 @fn277(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn280(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn279(i32 %a, i32 0)
+  %y = call i32 @fn278(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn281(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn280(i32 %a, i32 1)
+  %y = call i32 @fn279(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn282(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn281(i32 %a, i32 2)
+  %y = call i32 @fn280(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn283(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn282(i32 %a, i32 3)
+  %y = call i32 @fn281(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn284(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn283(i32 %a, i32 4)
+  %y = call i32 @fn282(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn285(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn284(i32 %a, i32 5)
+  %y = call i32 @fn283(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn286(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn285(i32 %a, i32 6)
+  %y = call i32 @fn284(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn287(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn286(i32 %a, i32 7)
+  %y = call i32 @fn285(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn288(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn287(i32 %a, i32 8)
+  %y = call i32 @fn286(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn289(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn288(i32 %a, i32 9)
+  %y = call i32 @fn287(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn290(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn289(i32 %a, i32 0)
+  %y = call i32 @fn288(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn291(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn290(i32 %a, i32 1)
+  %y = call i32 @fn289(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn292(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn291(i32 %a, i32 2)
+  %y = call i32 @fn290(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn293(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn292(i32 %a, i32 3)
+  %y = call i32 @fn291(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn294(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn293(i32 %a, i32 4)
+  %y = call i32 @fn292(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn295(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn294(i32 %a, i32 5)
+  %y = call i32 @fn293(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn296(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn295(i32 %a, i32 6)
+  %y = call i32 @fn294(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn297(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn296(i32 %a, i32 7)
+  %y = call i32 @fn295(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn298(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn297(i32 %a, i32 8)
+  %y = call i32 @fn296(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn299(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn298(i32 %a, i32 9)
+  %y = call i32 @fn297(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn300(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn299(i32 %a, i32 0)
+  %y = call i32 @fn298(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn301(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn300(i32 %a, i32 1)
+  %y = call i32 @fn299(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn302(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn301(i32 %a, i32 2)
+  %y = call i32 @fn300(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn303(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn302(i32 %a, i32 3)
+  %y = call i32 @fn301(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn304(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn303(i32 %a, i32 4)
+  %y = call i32 @fn302(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn305(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn304(i32 %a, i32 5)
+  %y = call i32 @fn303(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn306(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn305(i32 %a, i32 6)
+  %y = call i32 @fn304(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn307(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn306(i32 %a, i32 7)
+  %y = call i32 @fn305(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn308(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn307(i32 %a, i32 8)
+  %y = call i32 @fn306(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn309(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn308(i32 %a, i32 9)
+  %y = call i32 @fn307(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn310(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn309(i32 %a, i32 0)
+  %y = call i32 @fn308(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn311(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn310(i32 %a, i32 1)
+  %y = call i32 @fn309(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn312(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn311(i32 %a, i32 2)
+  %y = call i32 @fn310(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn313(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn312(i32 %a, i32 3)
+  %y = call i32 @fn311(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn314(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn313(i32 %a, i32 4)
+  %y = call i32 @fn312(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn315(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn314(i32 %a, i32 5)
+  %y = call i32 @fn313(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn316(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn315(i32 %a, i32 6)
+  %y = call i32 @fn314(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn317(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn316(i32 %a, i32 7)
+  %y = call i32 @fn315(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn318(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn317(i32 %a, i32 8)
+  %y = call i32 @fn316(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn319(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn318(i32 %a, i32 9)
+  %y = call i32 @fn317(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn320(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn319(i32 %a, i32 0)
+  %y = call i32 @fn318(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn321(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn320(i32 %a, i32 1)
+  %y = call i32 @fn319(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn322(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn321(i32 %a, i32 2)
+  %y = call i32 @fn320(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn323(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn322(i32 %a, i32 3)
+  %y = call i32 @fn321(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn324(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn323(i32 %a, i32 4)
+  %y = call i32 @fn322(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn325(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn324(i32 %a, i32 5)
+  %y = call i32 @fn323(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn326(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn325(i32 %a, i32 6)
+  %y = call i32 @fn324(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn327(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn326(i32 %a, i32 7)
+  %y = call i32 @fn325(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn328(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn327(i32 %a, i32 8)
+  %y = call i32 @fn326(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn329(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn328(i32 %a, i32 9)
+  %y = call i32 @fn327(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn330(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn329(i32 %a, i32 0)
+  %y = call i32 @fn328(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn331(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn330(i32 %a, i32 1)
+  %y = call i32 @fn329(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn332(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn331(i32 %a, i32 2)
+  %y = call i32 @fn330(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn333(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn332(i32 %a, i32 3)
+  %y = call i32 @fn331(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn334(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn333(i32 %a, i32 4)
+  %y = call i32 @fn332(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn335(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn334(i32 %a, i32 5)
+  %y = call i32 @fn333(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn336(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn335(i32 %a, i32 6)
+  %y = call i32 @fn334(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn337(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn336(i32 %a, i32 7)
+  %y = call i32 @fn335(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn338(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn337(i32 %a, i32 8)
+  %y = call i32 @fn336(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn339(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn338(i32 %a, i32 9)
+  %y = call i32 @fn337(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn340(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn339(i32 %a, i32 0)
+  %y = call i32 @fn338(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn341(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn340(i32 %a, i32 1)
+  %y = call i32 @fn339(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn342(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn341(i32 %a, i32 2)
+  %y = call i32 @fn340(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn343(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn342(i32 %a, i32 3)
+  %y = call i32 @fn341(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn344(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn343(i32 %a, i32 4)
+  %y = call i32 @fn342(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn345(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn344(i32 %a, i32 5)
+  %y = call i32 @fn343(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn346(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn345(i32 %a, i32 6)
+  %y = call i32 @fn344(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn347(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn346(i32 %a, i32 7)
+  %y = call i32 @fn345(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn348(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn347(i32 %a, i32 8)
+  %y = call i32 @fn346(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn349(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn348(i32 %a, i32 9)
+  %y = call i32 @fn347(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn350(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn349(i32 %a, i32 0)
+  %y = call i32 @fn348(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn351(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn350(i32 %a, i32 1)
+  %y = call i32 @fn349(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn352(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn351(i32 %a, i32 2)
+  %y = call i32 @fn350(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn353(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn352(i32 %a, i32 3)
+  %y = call i32 @fn351(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn354(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn353(i32 %a, i32 4)
+  %y = call i32 @fn352(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn355(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn354(i32 %a, i32 5)
+  %y = call i32 @fn353(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn356(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn355(i32 %a, i32 6)
+  %y = call i32 @fn354(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn357(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn356(i32 %a, i32 7)
+  %y = call i32 @fn355(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn358(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn357(i32 %a, i32 8)
+  %y = call i32 @fn356(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn359(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn358(i32 %a, i32 9)
+  %y = call i32 @fn357(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn360(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn359(i32 %a, i32 0)
+  %y = call i32 @fn358(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn361(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn360(i32 %a, i32 1)
+  %y = call i32 @fn359(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn362(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn361(i32 %a, i32 2)
+  %y = call i32 @fn360(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn363(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn362(i32 %a, i32 3)
+  %y = call i32 @fn361(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn364(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn363(i32 %a, i32 4)
+  %y = call i32 @fn362(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn365(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn364(i32 %a, i32 5)
+  %y = call i32 @fn363(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn366(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn365(i32 %a, i32 6)
+  %y = call i32 @fn364(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn367(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn366(i32 %a, i32 7)
+  %y = call i32 @fn365(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn368(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn367(i32 %a, i32 8)
+  %y = call i32 @fn366(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn369(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn368(i32 %a, i32 9)
+  %y = call i32 @fn367(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn370(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn369(i32 %a, i32 0)
+  %y = call i32 @fn368(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn371(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn370(i32 %a, i32 1)
+  %y = call i32 @fn369(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn372(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn371(i32 %a, i32 2)
+  %y = call i32 @fn370(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn373(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn372(i32 %a, i32 3)
+  %y = call i32 @fn371(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn374(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn373(i32 %a, i32 4)
+  %y = call i32 @fn372(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn375(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn374(i32 %a, i32 5)
+  %y = call i32 @fn373(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn376(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn375(i32 %a, i32 6)
+  %y = call i32 @fn374(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn377(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn376(i32 %a, i32 7)
+  %y = call i32 @fn375(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn378(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn377(i32 %a, i32 8)
+  %y = call i32 @fn376(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn379(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn378(i32 %a, i32 9)
+  %y = call i32 @fn377(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn380(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn379(i32 %a, i32 0)
+  %y = call i32 @fn378(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn381(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn380(i32 %a, i32 1)
+  %y = call i32 @fn379(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn382(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn381(i32 %a, i32 2)
+  %y = call i32 @fn380(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn383(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn382(i32 %a, i32 3)
+  %y = call i32 @fn381(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn384(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn383(i32 %a, i32 4)
+  %y = call i32 @fn382(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn385(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn384(i32 %a, i32 5)
+  %y = call i32 @fn383(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn386(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn385(i32 %a, i32 6)
+  %y = call i32 @fn384(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn387(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn386(i32 %a, i32 7)
+  %y = call i32 @fn385(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn388(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn387(i32 %a, i32 8)
+  %y = call i32 @fn386(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn389(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn388(i32 %a, i32 9)
+  %y = call i32 @fn387(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn390(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn389(i32 %a, i32 0)
+  %y = call i32 @fn388(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn391(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn390(i32 %a, i32 1)
+  %y = call i32 @fn389(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn392(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn391(i32 %a, i32 2)
+  %y = call i32 @fn390(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn393(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn392(i32 %a, i32 3)
+  %y = call i32 @fn391(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn394(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn393(i32 %a, i32 4)
+  %y = call i32 @fn392(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn395(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn394(i32 %a, i32 5)
+  %y = call i32 @fn393(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn396(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn395(i32 %a, i32 6)
+  %y = call i32 @fn394(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn397(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn396(i32 %a, i32 7)
+  %y = call i32 @fn395(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn398(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn397(i32 %a, i32 8)
+  %y = call i32 @fn396(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn399(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn398(i32 %a, i32 9)
+  %y = call i32 @fn397(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn400(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn399(i32 %a, i32 0)
+  %y = call i32 @fn398(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn401(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn400(i32 %a, i32 1)
+  %y = call i32 @fn399(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn402(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn401(i32 %a, i32 2)
+  %y = call i32 @fn400(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn403(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn402(i32 %a, i32 3)
+  %y = call i32 @fn401(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn404(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn403(i32 %a, i32 4)
+  %y = call i32 @fn402(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn405(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn404(i32 %a, i32 5)
+  %y = call i32 @fn403(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn406(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn405(i32 %a, i32 6)
+  %y = call i32 @fn404(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn407(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn406(i32 %a, i32 7)
+  %y = call i32 @fn405(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn408(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn407(i32 %a, i32 8)
+  %y = call i32 @fn406(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn409(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn408(i32 %a, i32 9)
+  %y = call i32 @fn407(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn410(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn409(i32 %a, i32 0)
+  %y = call i32 @fn408(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn411(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn410(i32 %a, i32 1)
+  %y = call i32 @fn409(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn412(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn411(i32 %a, i32 2)
+  %y = call i32 @fn410(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn413(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn412(i32 %a, i32 3)
+  %y = call i32 @fn411(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn414(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn413(i32 %a, i32 4)
+  %y = call i32 @fn412(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn415(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn414(i32 %a, i32 5)
+  %y = call i32 @fn413(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn416(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn415(i32 %a, i32 6)
+  %y = call i32 @fn414(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn417(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn416(i32 %a, i32 7)
+  %y = call i32 @fn415(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn418(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn417(i32 %a, i32 8)
+  %y = call i32 @fn416(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn419(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn418(i32 %a, i32 9)
+  %y = call i32 @fn417(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn420(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn419(i32 %a, i32 0)
+  %y = call i32 @fn418(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn421(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn420(i32 %a, i32 1)
+  %y = call i32 @fn419(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn422(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn421(i32 %a, i32 2)
+  %y = call i32 @fn420(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn423(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn422(i32 %a, i32 3)
+  %y = call i32 @fn421(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn424(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn423(i32 %a, i32 4)
+  %y = call i32 @fn422(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn425(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn424(i32 %a, i32 5)
+  %y = call i32 @fn423(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn426(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn425(i32 %a, i32 6)
+  %y = call i32 @fn424(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn427(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn426(i32 %a, i32 7)
+  %y = call i32 @fn425(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn428(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn427(i32 %a, i32 8)
+  %y = call i32 @fn426(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn429(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn428(i32 %a, i32 9)
+  %y = call i32 @fn427(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn430(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn429(i32 %a, i32 0)
+  %y = call i32 @fn428(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn431(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn430(i32 %a, i32 1)
+  %y = call i32 @fn429(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn432(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn431(i32 %a, i32 2)
+  %y = call i32 @fn430(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn433(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn432(i32 %a, i32 3)
+  %y = call i32 @fn431(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn434(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn433(i32 %a, i32 4)
+  %y = call i32 @fn432(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn435(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn434(i32 %a, i32 5)
+  %y = call i32 @fn433(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn436(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn435(i32 %a, i32 6)
+  %y = call i32 @fn434(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn437(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn436(i32 %a, i32 7)
+  %y = call i32 @fn435(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn438(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn437(i32 %a, i32 8)
+  %y = call i32 @fn436(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn439(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn438(i32 %a, i32 9)
+  %y = call i32 @fn437(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn440(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn439(i32 %a, i32 0)
+  %y = call i32 @fn438(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn441(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn440(i32 %a, i32 1)
+  %y = call i32 @fn439(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn442(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn441(i32 %a, i32 2)
+  %y = call i32 @fn440(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn443(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn442(i32 %a, i32 3)
+  %y = call i32 @fn441(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn444(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn443(i32 %a, i32 4)
+  %y = call i32 @fn442(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn445(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn444(i32 %a, i32 5)
+  %y = call i32 @fn443(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn446(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn445(i32 %a, i32 6)
+  %y = call i32 @fn444(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn447(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn446(i32 %a, i32 7)
+  %y = call i32 @fn445(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn448(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn447(i32 %a, i32 8)
+  %y = call i32 @fn446(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn449(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn448(i32 %a, i32 9)
+  %y = call i32 @fn447(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn450(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn449(i32 %a, i32 0)
+  %y = call i32 @fn448(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn451(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn450(i32 %a, i32 1)
+  %y = call i32 @fn449(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn452(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn451(i32 %a, i32 2)
+  %y = call i32 @fn450(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn453(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn452(i32 %a, i32 3)
+  %y = call i32 @fn451(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn454(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn453(i32 %a, i32 4)
+  %y = call i32 @fn452(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn455(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn454(i32 %a, i32 5)
+  %y = call i32 @fn453(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn456(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn455(i32 %a, i32 6)
+  %y = call i32 @fn454(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn457(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn456(i32 %a, i32 7)
+  %y = call i32 @fn455(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn458(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn457(i32 %a, i32 8)
+  %y = call i32 @fn456(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn459(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn458(i32 %a, i32 9)
+  %y = call i32 @fn457(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn460(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn459(i32 %a, i32 0)
+  %y = call i32 @fn458(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn461(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn460(i32 %a, i32 1)
+  %y = call i32 @fn459(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn462(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn461(i32 %a, i32 2)
+  %y = call i32 @fn460(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn463(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn462(i32 %a, i32 3)
+  %y = call i32 @fn461(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn464(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn463(i32 %a, i32 4)
+  %y = call i32 @fn462(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn465(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn464(i32 %a, i32 5)
+  %y = call i32 @fn463(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn466(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn465(i32 %a, i32 6)
+  %y = call i32 @fn464(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn467(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn466(i32 %a, i32 7)
+  %y = call i32 @fn465(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn468(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn467(i32 %a, i32 8)
+  %y = call i32 @fn466(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn469(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn468(i32 %a, i32 9)
+  %y = call i32 @fn467(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn470(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn469(i32 %a, i32 0)
+  %y = call i32 @fn468(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn471(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn470(i32 %a, i32 1)
+  %y = call i32 @fn469(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn472(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn471(i32 %a, i32 2)
+  %y = call i32 @fn470(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn473(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn472(i32 %a, i32 3)
+  %y = call i32 @fn471(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn474(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn473(i32 %a, i32 4)
+  %y = call i32 @fn472(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn475(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn474(i32 %a, i32 5)
+  %y = call i32 @fn473(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn476(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn475(i32 %a, i32 6)
+  %y = call i32 @fn474(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn477(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn476(i32 %a, i32 7)
+  %y = call i32 @fn475(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn478(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn477(i32 %a, i32 8)
+  %y = call i32 @fn476(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn479(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn478(i32 %a, i32 9)
+  %y = call i32 @fn477(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn480(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn479(i32 %a, i32 0)
+  %y = call i32 @fn478(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn481(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn480(i32 %a, i32 1)
+  %y = call i32 @fn479(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn482(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn481(i32 %a, i32 2)
+  %y = call i32 @fn480(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn483(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn482(i32 %a, i32 3)
+  %y = call i32 @fn481(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn484(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn483(i32 %a, i32 4)
+  %y = call i32 @fn482(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn485(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn484(i32 %a, i32 5)
+  %y = call i32 @fn483(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn486(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn485(i32 %a, i32 6)
+  %y = call i32 @fn484(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn487(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn486(i32 %a, i32 7)
+  %y = call i32 @fn485(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn488(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn487(i32 %a, i32 8)
+  %y = call i32 @fn486(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn489(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn488(i32 %a, i32 9)
+  %y = call i32 @fn487(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn490(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn489(i32 %a, i32 0)
+  %y = call i32 @fn488(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn491(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn490(i32 %a, i32 1)
+  %y = call i32 @fn489(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn492(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn491(i32 %a, i32 2)
+  %y = call i32 @fn490(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn493(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn492(i32 %a, i32 3)
+  %y = call i32 @fn491(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn494(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn493(i32 %a, i32 4)
+  %y = call i32 @fn492(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn495(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn494(i32 %a, i32 5)
+  %y = call i32 @fn493(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn496(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn495(i32 %a, i32 6)
+  %y = call i32 @fn494(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn497(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn496(i32 %a, i32 7)
+  %y = call i32 @fn495(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn498(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn497(i32 %a, i32 8)
+  %y = call i32 @fn496(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn499(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn498(i32 %a, i32 9)
+  %y = call i32 @fn497(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn500(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn499(i32 %a, i32 0)
+  %y = call i32 @fn498(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn501(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn500(i32 %a, i32 1)
+  %y = call i32 @fn499(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn502(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn501(i32 %a, i32 2)
+  %y = call i32 @fn500(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn503(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn502(i32 %a, i32 3)
+  %y = call i32 @fn501(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn504(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn503(i32 %a, i32 4)
+  %y = call i32 @fn502(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn505(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn504(i32 %a, i32 5)
+  %y = call i32 @fn503(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn506(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn505(i32 %a, i32 6)
+  %y = call i32 @fn504(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn507(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn506(i32 %a, i32 7)
+  %y = call i32 @fn505(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn508(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn507(i32 %a, i32 8)
+  %y = call i32 @fn506(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn509(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn508(i32 %a, i32 9)
+  %y = call i32 @fn507(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn510(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn509(i32 %a, i32 0)
+  %y = call i32 @fn508(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn511(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn510(i32 %a, i32 1)
+  %y = call i32 @fn509(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn512(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn511(i32 %a, i32 2)
+  %y = call i32 @fn510(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn513(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn512(i32 %a, i32 3)
+  %y = call i32 @fn511(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn514(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn513(i32 %a, i32 4)
+  %y = call i32 @fn512(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn515(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn514(i32 %a, i32 5)
+  %y = call i32 @fn513(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn516(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn515(i32 %a, i32 6)
+  %y = call i32 @fn514(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn517(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn516(i32 %a, i32 7)
+  %y = call i32 @fn515(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn518(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn517(i32 %a, i32 8)
+  %y = call i32 @fn516(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn519(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn518(i32 %a, i32 9)
+  %y = call i32 @fn517(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn520(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn519(i32 %a, i32 0)
+  %y = call i32 @fn518(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn521(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn520(i32 %a, i32 1)
+  %y = call i32 @fn519(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn522(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn521(i32 %a, i32 2)
+  %y = call i32 @fn520(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn523(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn522(i32 %a, i32 3)
+  %y = call i32 @fn521(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn524(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn523(i32 %a, i32 4)
+  %y = call i32 @fn522(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn525(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn524(i32 %a, i32 5)
+  %y = call i32 @fn523(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn526(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn525(i32 %a, i32 6)
+  %y = call i32 @fn524(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn527(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn526(i32 %a, i32 7)
+  %y = call i32 @fn525(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn528(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn527(i32 %a, i32 8)
+  %y = call i32 @fn526(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn529(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn528(i32 %a, i32 9)
+  %y = call i32 @fn527(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn530(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn529(i32 %a, i32 0)
+  %y = call i32 @fn528(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn531(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn530(i32 %a, i32 1)
+  %y = call i32 @fn529(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn532(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn531(i32 %a, i32 2)
+  %y = call i32 @fn530(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn533(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn532(i32 %a, i32 3)
+  %y = call i32 @fn531(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn534(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn533(i32 %a, i32 4)
+  %y = call i32 @fn532(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn535(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn534(i32 %a, i32 5)
+  %y = call i32 @fn533(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn536(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn535(i32 %a, i32 6)
+  %y = call i32 @fn534(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn537(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn536(i32 %a, i32 7)
+  %y = call i32 @fn535(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn538(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn537(i32 %a, i32 8)
+  %y = call i32 @fn536(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn539(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn538(i32 %a, i32 9)
+  %y = call i32 @fn537(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn540(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn539(i32 %a, i32 0)
+  %y = call i32 @fn538(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn541(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn540(i32 %a, i32 1)
+  %y = call i32 @fn539(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn542(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn541(i32 %a, i32 2)
+  %y = call i32 @fn540(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn543(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn542(i32 %a, i32 3)
+  %y = call i32 @fn541(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn544(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn543(i32 %a, i32 4)
+  %y = call i32 @fn542(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn545(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn544(i32 %a, i32 5)
+  %y = call i32 @fn543(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn546(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn545(i32 %a, i32 6)
+  %y = call i32 @fn544(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn547(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn546(i32 %a, i32 7)
+  %y = call i32 @fn545(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn548(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn547(i32 %a, i32 8)
+  %y = call i32 @fn546(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn549(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn548(i32 %a, i32 9)
+  %y = call i32 @fn547(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn550(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn549(i32 %a, i32 0)
+  %y = call i32 @fn548(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn551(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn550(i32 %a, i32 1)
+  %y = call i32 @fn549(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn552(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn551(i32 %a, i32 2)
+  %y = call i32 @fn550(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn553(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn552(i32 %a, i32 3)
+  %y = call i32 @fn551(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn554(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn553(i32 %a, i32 4)
+  %y = call i32 @fn552(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn555(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn554(i32 %a, i32 5)
+  %y = call i32 @fn553(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn556(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn555(i32 %a, i32 6)
+  %y = call i32 @fn554(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn557(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn556(i32 %a, i32 7)
+  %y = call i32 @fn555(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn558(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn557(i32 %a, i32 8)
+  %y = call i32 @fn556(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn559(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn558(i32 %a, i32 9)
+  %y = call i32 @fn557(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn560(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn559(i32 %a, i32 0)
+  %y = call i32 @fn558(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn561(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn560(i32 %a, i32 1)
+  %y = call i32 @fn559(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn562(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn561(i32 %a, i32 2)
+  %y = call i32 @fn560(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn563(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn562(i32 %a, i32 3)
+  %y = call i32 @fn561(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn564(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn563(i32 %a, i32 4)
+  %y = call i32 @fn562(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn565(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn564(i32 %a, i32 5)
+  %y = call i32 @fn563(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn566(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn565(i32 %a, i32 6)
+  %y = call i32 @fn564(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn567(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn566(i32 %a, i32 7)
+  %y = call i32 @fn565(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn568(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn567(i32 %a, i32 8)
+  %y = call i32 @fn566(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn569(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn568(i32 %a, i32 9)
+  %y = call i32 @fn567(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn570(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn569(i32 %a, i32 0)
+  %y = call i32 @fn568(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn571(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn570(i32 %a, i32 1)
+  %y = call i32 @fn569(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn572(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn571(i32 %a, i32 2)
+  %y = call i32 @fn570(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn573(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn572(i32 %a, i32 3)
+  %y = call i32 @fn571(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn574(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn573(i32 %a, i32 4)
+  %y = call i32 @fn572(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn575(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn574(i32 %a, i32 5)
+  %y = call i32 @fn573(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn576(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn575(i32 %a, i32 6)
+  %y = call i32 @fn574(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn577(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn576(i32 %a, i32 7)
+  %y = call i32 @fn575(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn578(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn577(i32 %a, i32 8)
+  %y = call i32 @fn576(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn579(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn578(i32 %a, i32 9)
+  %y = call i32 @fn577(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn580(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn579(i32 %a, i32 0)
+  %y = call i32 @fn578(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn581(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn580(i32 %a, i32 1)
+  %y = call i32 @fn579(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn582(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn581(i32 %a, i32 2)
+  %y = call i32 @fn580(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn583(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn582(i32 %a, i32 3)
+  %y = call i32 @fn581(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn584(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn583(i32 %a, i32 4)
+  %y = call i32 @fn582(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn585(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn584(i32 %a, i32 5)
+  %y = call i32 @fn583(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn586(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn585(i32 %a, i32 6)
+  %y = call i32 @fn584(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn587(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn586(i32 %a, i32 7)
+  %y = call i32 @fn585(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn588(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn587(i32 %a, i32 8)
+  %y = call i32 @fn586(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn589(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn588(i32 %a, i32 9)
+  %y = call i32 @fn587(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn590(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn589(i32 %a, i32 0)
+  %y = call i32 @fn588(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn591(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn590(i32 %a, i32 1)
+  %y = call i32 @fn589(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn592(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn591(i32 %a, i32 2)
+  %y = call i32 @fn590(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn593(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn592(i32 %a, i32 3)
+  %y = call i32 @fn591(i32 5, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn594(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn593(i32 %a, i32 4)
+  %y = call i32 @fn592(i32 6, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn595(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn594(i32 %a, i32 5)
+  %y = call i32 @fn593(i32 0, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn596(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn595(i32 %a, i32 6)
+  %y = call i32 @fn594(i32 1, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn597(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn596(i32 %a, i32 7)
+  %y = call i32 @fn595(i32 2, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 0
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn598(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn597(i32 %a, i32 8)
+  %y = call i32 @fn596(i32 3, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 1
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
+define i32 @fn599(i32 %a, i32 %b) {
+entry:
+  %x = call i32 @fn598(i32 %a, i32 9)
+  %y = call i32 @fn597(i32 4, i32 %b)
+  %s = add i32 %x, %y
+  %c = icmp sgt i32 %s, 1000
+  br i1 %c, label %big, label %small
+big:
+  %h = sdiv i32 %s, 2
+  br label %done
+small:
+  %l = add i32 %s, 2
+  br label %done
+done:
+  %r = phi i32 [ %h, %big ], [ %l, %small ]
+  ret i32 %r
+}
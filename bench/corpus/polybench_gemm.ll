@@ -0,0 +1,62 @@
+; PolyBench-style gemm: C = alpha * A * B + beta * C on 64x64 float matrices
+@A = global [64 x [64 x float]] zeroinitializer
+@B = global [64 x [64 x float]] zeroinitializer
+@C = global [64 x [64 x float]] zeroinitializer
+@alpha = constant float 1.500000e+00
+@beta = constant float 1.250000e+00
+
+define void @kernel_gemm() {
+entry:
+  %alpha = load float, float* @alpha
+  %beta = load float, float* @beta
+  br label %i.header
+
+i.header:
+  %i = phi i32 [ 0, %entry ], [ %i.next, %i.latch ]
+  %i.cmp = icmp slt i32 %i, 64
+  br i1 %i.cmp, label %j.pre, label %exit
+
+j.pre:
+  br label %j.header
+
+j.header:
+  %j = phi i32 [ 0, %j.pre ], [ %j.next, %j.latch ]
+  %j.cmp = icmp slt i32 %j, 64
+  br i1 %j.cmp, label %j.body, label %i.latch
+
+j.body:
+  %c.ptr = getelementptr [64 x [64 x float]], [64 x [64 x float]]* @C, i32 0, i32 %i, i32 %j
+  %c = load float, float* %c.ptr
+  %c.scaled = fmul float %c, %beta
+  store float %c.scaled, float* %c.ptr
+  br label %k.header
+
+k.header:
+  %k = phi i32 [ 0, %j.body ], [ %k.next, %k.body ]
+  %acc = phi float [ %c.scaled, %j.body ], [ %acc.next, %k.body ]
+  %k.cmp = icmp slt i32 %k, 64
+  br i1 %k.cmp, label %k.body, label %j.latch
+
+k.body:
+  %a.ptr = getelementptr [64 x [64 x float]], [64 x [64 x float]]* @A, i32 0, i32 %i, i32 %k
+  %a = load float, float* %a.ptr
+  %b.ptr = getelementptr [64 x [64 x float]], [64 x [64 x float]]* @B, i32 0, i32 %k, i32 %j
+  %b = load float, float* %b.ptr
+  %ab = fmul float %a, %b
+  %t = fmul float %alpha, %ab
+  %acc.next = fadd float %acc, %t
+  %k.next = add i32 %k, 1
+  br label %k.header
+
+j.latch:
+  store float %acc, float* %c.ptr
+  %j.next = add i32 %j, 1
+  br label %j.header
+
+i.latch:
+  %i.next = add i32 %i, 1
+  br label %i.header
+
+exit:
+  ret void
+}
@@ -0,0 +1,70 @@
+; PolyBench-style jacobi-1d: 100 time steps of a 3 point stencil on 400 floats
+@A = global [400 x float] zeroinitializer
+@B = global [400 x float] zeroinitializer
+
+define void @kernel_jacobi_1d() {
+entry:
+  br label %t.header
+
+t.header:
+  %t = phi i32 [ 0, %entry ], [ %t.next, %t.latch ]
+  %t.cmp = icmp slt i32 %t, 100
+  br i1 %t.cmp, label %i.pre, label %exit
+
+i.pre:
+  br label %i.header
+
+i.header:
+  %i = phi i32 [ 1, %i.pre ], [ %i.next, %i.body ]
+  %i.cmp = icmp slt i32 %i, 399
+  br i1 %i.cmp, label %i.body, label %j.pre
+
+i.body:
+  %im1 = sub i32 %i, 1
+  %ip1 = add i32 %i, 1
+  %p0 = getelementptr [400 x float], [400 x float]* @A, i32 0, i32 %im1
+  %p1 = getelementptr [400 x float], [400 x float]* @A, i32 0, i32 %i
+  %p2 = getelementptr [400 x float], [400 x float]* @A, i32 0, i32 %ip1
+  %a0 = load float, float* %p0
+  %a1 = load float, float* %p1
+  %a2 = load float, float* %p2
+  %s0 = fadd float %a0, %a1
+  %s1 = fadd float %s0, %a2
+  %v = fmul float %s1, 0x3FD5555560000000
+  %q = getelementptr [400 x float], [400 x float]* @B, i32 0, i32 %i
+  store float %v, float* %q
+  %i.next = add i32 %i, 1
+  br label %i.header
+
+j.pre:
+  br label %j.header
+
+j.header:
+  %j = phi i32 [ 1, %j.pre ], [ %j.next, %j.body ]
+  %j.cmp = icmp slt i32 %j, 399
+  br i1 %j.cmp, label %j.body, label %t.latch
+
+j.body:
+  %jm1 = sub i32 %j, 1
+  %jp1 = add i32 %j, 1
+  %r0 = getelementptr [400 x float], [400 x float]* @B, i32 0, i32 %jm1
+  %r1 = getelementptr [400 x float], [400 x float]* @B, i32 0, i32 %j
+  %r2 = getelementptr [400 x float], [400 x float]* @B, i32 0, i32 %jp1
+  %b0 = load float, float* %r0
+  %b1 = load float, float* %r1
+  %b2 = load float, float* %r2
+  %u0 = fadd float %b0, %b1
+  %u1 = fadd float %u0, %b2
+  %w = fmul float %u1, 0x3FD5555560000000
+  %z = getelementptr [400 x float], [400 x float]* @A, i32 0, i32 %j
+  store float %w, float* %z
+  %j.next = add i32 %j, 1
+  br label %j.header
+
+t.latch:
+  %t.next = add i32 %t, 1
+  br label %t.header
+
+exit:
+  ret void
+}
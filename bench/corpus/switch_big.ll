@@ -0,0 +1,2059 @@
+; switch with 512 cases, every one feeding the final phi
+define i32 @big_switch(i32 %x) {
+entry:
+  switch i32 %x, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+    i32 6, label %case6
+    i32 7, label %case7
+    i32 8, label %case8
+    i32 9, label %case9
+    i32 10, label %case10
+    i32 11, label %case11
+    i32 12, label %case12
+    i32 13, label %case13
+    i32 14, label %case14
+    i32 15, label %case15
+    i32 16, label %case16
+    i32 17, label %case17
+    i32 18, label %case18
+    i32 19, label %case19
+    i32 20, label %case20
+    i32 21, label %case21
+    i32 22, label %case22
+    i32 23, label %case23
+    i32 24, label %case24
+    i32 25, label %case25
+    i32 26, label %case26
+    i32 27, label %case27
+    i32 28, label %case28
+    i32 29, label %case29
+    i32 30, label %case30
+    i32 31, label %case31
+    i32 32, label %case32
+    i32 33, label %case33
+    i32 34, label %case34
+    i32 35, label %case35
+    i32 36, label %case36
+    i32 37, label %case37
+    i32 38, label %case38
+    i32 39, label %case39
+    i32 40, label %case40
+    i32 41, label %case41
+    i32 42, label %case42
+    i32 43, label %case43
+    i32 44, label %case44
+    i32 45, label %case45
+    i32 46, label %case46
+    i32 47, label %case47
+    i32 48, label %case48
+    i32 49, label %case49
+    i32 50, label %case50
+    i32 51, label %case51
+    i32 52, label %case52
+    i32 53, label %case53
+    i32 54, label %case54
+    i32 55, label %case55
+    i32 56, label %case56
+    i32 57, label %case57
+    i32 58, label %case58
+    i32 59, label %case59
+    i32 60, label %case60
+    i32 61, label %case61
+    i32 62, label %case62
+    i32 63, label %case63
+    i32 64, label %case64
+    i32 65, label %case65
+    i32 66, label %case66
+    i32 67, label %case67
+    i32 68, label %case68
+    i32 69, label %case69
+    i32 70, label %case70
+    i32 71, label %case71
+    i32 72, label %case72
+    i32 73, label %case73
+    i32 74, label %case74
+    i32 75, label %case75
+    i32 76, label %case76
+    i32 77, label %case77
+    i32 78, label %case78
+    i32 79, label %case79
+    i32 80, label %case80
+    i32 81, label %case81
+    i32 82, label %case82
+    i32 83, label %case83
+    i32 84, label %case84
+    i32 85, label %case85
+    i32 86, label %case86
+    i32 87, label %case87
+    i32 88, label %case88
+    i32 89, label %case89
+    i32 90, label %case90
+    i32 91, label %case91
+    i32 92, label %case92
+    i32 93, label %case93
+    i32 94, label %case94
+    i32 95, label %case95
+    i32 96, label %case96
+    i32 97, label %case97
+    i32 98, label %case98
+    i32 99, label %case99
+    i32 100, label %case100
+    i32 101, label %case101
+    i32 102, label %case102
+    i32 103, label %case103
+    i32 104, label %case104
+    i32 105, label %case105
+    i32 106, label %case106
+    i32 107, label %case107
+    i32 108, label %case108
+    i32 109, label %case109
+    i32 110, label %case110
+    i32 111, label %case111
+    i32 112, label %case112
+    i32 113, label %case113
+    i32 114, label %case114
+    i32 115, label %case115
+    i32 116, label %case116
+    i32 117, label %case117
+    i32 118, label %case118
+    i32 119, label %case119
+    i32 120, label %case120
+    i32 121, label %case121
+    i32 122, label %case122
+    i32 123, label %case123
+    i32 124, label %case124
+    i32 125, label %case125
+    i32 126, label %case126
+    i32 127, label %case127
+    i32 128, label %case128
+    i32 129, label %case129
+    i32 130, label %case130
+    i32 131, label %case131
+    i32 132, label %case132
+    i32 133, label %case133
+    i32 134, label %case134
+    i32 135, label %case135
+    i32 136, label %case136
+    i32 137, label %case137
+    i32 138, label %case138
+    i32 139, label %case139
+    i32 140, label %case140
+    i32 141, label %case141
+    i32 142, label %case142
+    i32 143, label %case143
+    i32 144, label %case144
+    i32 145, label %case145
+    i32 146, label %case146
+    i32 147, label %case147
+    i32 148, label %case148
+    i32 149, label %case149
+    i32 150, label %case150
+    i32 151, label %case151
+    i32 152, label %case152
+    i32 153, label %case153
+    i32 154, label %case154
+    i32 155, label %case155
+    i32 156, label %case156
+    i32 157, label %case157
+    i32 158, label %case158
+    i32 159, label %case159
+    i32 160, label %case160
+    i32 161, label %case161
+    i32 162, label %case162
+    i32 163, label %case163
+    i32 164, label %case164
+    i32 165, label %case165
+    i32 166, label %case166
+    i32 167, label %case167
+    i32 168, label %case168
+    i32 169, label %case169
+    i32 170, label %case170
+    i32 171, label %case171
+    i32 172, label %case172
+    i32 173, label %case173
+    i32 174, label %case174
+    i32 175, label %case175
+    i32 176, label %case176
+    i32 177, label %case177
+    i32 178, label %case178
+    i32 179, label %case179
+    i32 180, label %case180
+    i32 181, label %case181
+    i32 182, label %case182
+    i32 183, label %case183
+    i32 184, label %case184
+    i32 185, label %case185
+    i32 186, label %case186
+    i32 187, label %case187
+    i32 188, label %case188
+    i32 189, label %case189
+    i32 190, label %case190
+    i32 191, label %case191
+    i32 192, label %case192
+    i32 193, label %case193
+    i32 194, label %case194
+    i32 195, label %case195
+    i32 196, label %case196
+    i32 197, label %case197
+    i32 198, label %case198
+    i32 199, label %case199
+    i32 200, label %case200
+    i32 201, label %case201
+    i32 202, label %case202
+    i32 203, label %case203
+    i32 204, label %case204
+    i32 205, label %case205
+    i32 206, label %case206
+    i32 207, label %case207
+    i32 208, label %case208
+    i32 209, label %case209
+    i32 210, label %case210
+    i32 211, label %case211
+    i32 212, label %case212
+    i32 213, label %case213
+    i32 214, label %case214
+    i32 215, label %case215
+    i32 216, label %case216
+    i32 217, label %case217
+    i32 218, label %case218
+    i32 219, label %case219
+    i32 220, label %case220
+    i32 221, label %case221
+    i32 222, label %case222
+    i32 223, label %case223
+    i32 224, label %case224
+    i32 225, label %case225
+    i32 226, label %case226
+    i32 227, label %case227
+    i32 228, label %case228
+    i32 229, label %case229
+    i32 230, label %case230
+    i32 231, label %case231
+    i32 232, label %case232
+    i32 233, label %case233
+    i32 234, label %case234
+    i32 235, label %case235
+    i32 236, label %case236
+    i32 237, label %case237
+    i32 238, label %case238
+    i32 239, label %case239
+    i32 240, label %case240
+    i32 241, label %case241
+    i32 242, label %case242
+    i32 243, label %case243
+    i32 244, label %case244
+    i32 245, label %case245
+    i32 246, label %case246
+    i32 247, label %case247
+    i32 248, label %case248
+    i32 249, label %case249
+    i32 250, label %case250
+    i32 251, label %case251
+    i32 252, label %case252
+    i32 253, label %case253
+    i32 254, label %case254
+    i32 255, label %case255
+    i32 256, label %case256
+    i32 257, label %case257
+    i32 258, label %case258
+    i32 259, label %case259
+    i32 260, label %case260
+    i32 261, label %case261
+    i32 262, label %case262
+    i32 263, label %case263
+    i32 264, label %case264
+    i32 265, label %case265
+    i32 266, label %case266
+    i32 267, label %case267
+    i32 268, label %case268
+    i32 269, label %case269
+    i32 270, label %case270
+    i32 271, label %case271
+    i32 272, label %case272
+    i32 273, label %case273
+    i32 274, label %case274
+    i32 275, label %case275
+    i32 276, label %case276
+    i32 277, label %case277
+    i32 278, label %case278
+    i32 279, label %case279
+    i32 280, label %case280
+    i32 281, label %case281
+    i32 282, label %case282
+    i32 283, label %case283
+    i32 284, label %case284
+    i32 285, label %case285
+    i32 286, label %case286
+    i32 287, label %case287
+    i32 288, label %case288
+    i32 289, label %case289
+    i32 290, label %case290
+    i32 291, label %case291
+    i32 292, label %case292
+    i32 293, label %case293
+    i32 294, label %case294
+    i32 295, label %case295
+    i32 296, label %case296
+    i32 297, label %case297
+    i32 298, label %case298
+    i32 299, label %case299
+    i32 300, label %case300
+    i32 301, label %case301
+    i32 302, label %case302
+    i32 303, label %case303
+    i32 304, label %case304
+    i32 305, label %case305
+    i32 306, label %case306
+    i32 307, label %case307
+    i32 308, label %case308
+    i32 309, label %case309
+    i32 310, label %case310
+    i32 311, label %case311
+    i32 312, label %case312
+    i32 313, label %case313
+    i32 314, label %case314
+    i32 315, label %case315
+    i32 316, label %case316
+    i32 317, label %case317
+    i32 318, label %case318
+    i32 319, label %case319
+    i32 320, label %case320
+    i32 321, label %case321
+    i32 322, label %case322
+    i32 323, label %case323
+    i32 324, label %case324
+    i32 325, label %case325
+    i32 326, label %case326
+    i32 327, label %case327
+    i32 328, label %case328
+    i32 329, label %case329
+    i32 330, label %case330
+    i32 331, label %case331
+    i32 332, label %case332
+    i32 333, label %case333
+    i32 334, label %case334
+    i32 335, label %case335
+    i32 336, label %case336
+    i32 337, label %case337
+    i32 338, label %case338
+    i32 339, label %case339
+    i32 340, label %case340
+    i32 341, label %case341
+    i32 342, label %case342
+    i32 343, label %case343
+    i32 344, label %case344
+    i32 345, label %case345
+    i32 346, label %case346
+    i32 347, label %case347
+    i32 348, label %case348
+    i32 349, label %case349
+    i32 350, label %case350
+    i32 351, label %case351
+    i32 352, label %case352
+    i32 353, label %case353
+    i32 354, label %case354
+    i32 355, label %case355
+    i32 356, label %case356
+    i32 357, label %case357
+    i32 358, label %case358
+    i32 359, label %case359
+    i32 360, label %case360
+    i32 361, label %case361
+    i32 362, label %case362
+    i32 363, label %case363
+    i32 364, label %case364
+    i32 365, label %case365
+    i32 366, label %case366
+    i32 367, label %case367
+    i32 368, label %case368
+    i32 369, label %case369
+    i32 370, label %case370
+    i32 371, label %case371
+    i32 372, label %case372
+    i32 373, label %case373
+    i32 374, label %case374
+    i32 375, label %case375
+    i32 376, label %case376
+    i32 377, label %case377
+    i32 378, label %case378
+    i32 379, label %case379
+    i32 380, label %case380
+    i32 381, label %case381
+    i32 382, label %case382
+    i32 383, label %case383
+    i32 384, label %case384
+    i32 385, label %case385
+    i32 386, label %case386
+    i32 387, label %case387
+    i32 388, label %case388
+    i32 389, label %case389
+    i32 390, label %case390
+    i32 391, label %case391
+    i32 392, label %case392
+    i32 393, label %case393
+    i32 394, label %case394
+    i32 395, label %case395
+    i32 396, label %case396
+    i32 397, label %case397
+    i32 398, label %case398
+    i32 399, label %case399
+    i32 400, label %case400
+    i32 401, label %case401
+    i32 402, label %case402
+    i32 403, label %case403
+    i32 404, label %case404
+    i32 405, label %case405
+    i32 406, label %case406
+    i32 407, label %case407
+    i32 408, label %case408
+    i32 409, label %case409
+    i32 410, label %case410
+    i32 411, label %case411
+    i32 412, label %case412
+    i32 413, label %case413
+    i32 414, label %case414
+    i32 415, label %case415
+    i32 416, label %case416
+    i32 417, label %case417
+    i32 418, label %case418
+    i32 419, label %case419
+    i32 420, label %case420
+    i32 421, label %case421
+    i32 422, label %case422
+    i32 423, label %case423
+    i32 424, label %case424
+    i32 425, label %case425
+    i32 426, label %case426
+    i32 427, label %case427
+    i32 428, label %case428
+    i32 429, label %case429
+    i32 430, label %case430
+    i32 431, label %case431
+    i32 432, label %case432
+    i32 433, label %case433
+    i32 434, label %case434
+    i32 435, label %case435
+    i32 436, label %case436
+    i32 437, label %case437
+    i32 438, label %case438
+    i32 439, label %case439
+    i32 440, label %case440
+    i32 441, label %case441
+    i32 442, label %case442
+    i32 443, label %case443
+    i32 444, label %case444
+    i32 445, label %case445
+    i32 446, label %case446
+    i32 447, label %case447
+    i32 448, label %case448
+    i32 449, label %case449
+    i32 450, label %case450
+    i32 451, label %case451
+    i32 452, label %case452
+    i32 453, label %case453
+    i32 454, label %case454
+    i32 455, label %case455
+    i32 456, label %case456
+    i32 457, label %case457
+    i32 458, label %case458
+    i32 459, label %case459
+    i32 460, label %case460
+    i32 461, label %case461
+    i32 462, label %case462
+    i32 463, label %case463
+    i32 464, label %case464
+    i32 465, label %case465
+    i32 466, label %case466
+    i32 467, label %case467
+    i32 468, label %case468
+    i32 469, label %case469
+    i32 470, label %case470
+    i32 471, label %case471
+    i32 472, label %case472
+    i32 473, label %case473
+    i32 474, label %case474
+    i32 475, label %case475
+    i32 476, label %case476
+    i32 477, label %case477
+    i32 478, label %case478
+    i32 479, label %case479
+    i32 480, label %case480
+    i32 481, label %case481
+    i32 482, label %case482
+    i32 483, label %case483
+    i32 484, label %case484
+    i32 485, label %case485
+    i32 486, label %case486
+    i32 487, label %case487
+    i32 488, label %case488
+    i32 489, label %case489
+    i32 490, label %case490
+    i32 491, label %case491
+    i32 492, label %case492
+    i32 493, label %case493
+    i32 494, label %case494
+    i32 495, label %case495
+    i32 496, label %case496
+    i32 497, label %case497
+    i32 498, label %case498
+    i32 499, label %case499
+    i32 500, label %case500
+    i32 501, label %case501
+    i32 502, label %case502
+    i32 503, label %case503
+    i32 504, label %case504
+    i32 505, label %case505
+    i32 506, label %case506
+    i32 507, label %case507
+    i32 508, label %case508
+    i32 509, label %case509
+    i32 510, label %case510
+    i32 511, label %case511
+  ]
+case0:
+  %r0 = mul i32 %x, 1
+  br label %exit
+case1:
+  %r1 = mul i32 %x, 2
+  br label %exit
+case2:
+  %r2 = mul i32 %x, 3
+  br label %exit
+case3:
+  %r3 = mul i32 %x, 4
+  br label %exit
+case4:
+  %r4 = mul i32 %x, 5
+  br label %exit
+case5:
+  %r5 = mul i32 %x, 6
+  br label %exit
+case6:
+  %r6 = mul i32 %x, 7
+  br label %exit
+case7:
+  %r7 = mul i32 %x, 8
+  br label %exit
+case8:
+  %r8 = mul i32 %x, 9
+  br label %exit
+case9:
+  %r9 = mul i32 %x, 10
+  br label %exit
+case10:
+  %r10 = mul i32 %x, 11
+  br label %exit
+case11:
+  %r11 = mul i32 %x, 12
+  br label %exit
+case12:
+  %r12 = mul i32 %x, 13
+  br label %exit
+case13:
+  %r13 = mul i32 %x, 1
+  br label %exit
+case14:
+  %r14 = mul i32 %x, 2
+  br label %exit
+case15:
+  %r15 = mul i32 %x, 3
+  br label %exit
+case16:
+  %r16 = mul i32 %x, 4
+  br label %exit
+case17:
+  %r17 = mul i32 %x, 5
+  br label %exit
+case18:
+  %r18 = mul i32 %x, 6
+  br label %exit
+case19:
+  %r19 = mul i32 %x, 7
+  br label %exit
+case20:
+  %r20 = mul i32 %x, 8
+  br label %exit
+case21:
+  %r21 = mul i32 %x, 9
+  br label %exit
+case22:
+  %r22 = mul i32 %x, 10
+  br label %exit
+case23:
+  %r23 = mul i32 %x, 11
+  br label %exit
+case24:
+  %r24 = mul i32 %x, 12
+  br label %exit
+case25:
+  %r25 = mul i32 %x, 13
+  br label %exit
+case26:
+  %r26 = mul i32 %x, 1
+  br label %exit
+case27:
+  %r27 = mul i32 %x, 2
+  br label %exit
+case28:
+  %r28 = mul i32 %x, 3
+  br label %exit
+case29:
+  %r29 = mul i32 %x, 4
+  br label %exit
+case30:
+  %r30 = mul i32 %x, 5
+  br label %exit
+case31:
+  %r31 = mul i32 %x, 6
+  br label %exit
+case32:
+  %r32 = mul i32 %x, 7
+  br label %exit
+case33:
+  %r33 = mul i32 %x, 8
+  br label %exit
+case34:
+  %r34 = mul i32 %x, 9
+  br label %exit
+case35:
+  %r35 = mul i32 %x, 10
+  br label %exit
+case36:
+  %r36 = mul i32 %x, 11
+  br label %exit
+case37:
+  %r37 = mul i32 %x, 12
+  br label %exit
+case38:
+  %r38 = mul i32 %x, 13
+  br label %exit
+case39:
+  %r39 = mul i32 %x, 1
+  br label %exit
+case40:
+  %r40 = mul i32 %x, 2
+  br label %exit
+case41:
+  %r41 = mul i32 %x, 3
+  br label %exit
+case42:
+  %r42 = mul i32 %x, 4
+  br label %exit
+case43:
+  %r43 = mul i32 %x, 5
+  br label %exit
+case44:
+  %r44 = mul i32 %x, 6
+  br label %exit
+case45:
+  %r45 = mul i32 %x, 7
+  br label %exit
+case46:
+  %r46 = mul i32 %x, 8
+  br label %exit
+case47:
+  %r47 = mul i32 %x, 9
+  br label %exit
+case48:
+  %r48 = mul i32 %x, 10
+  br label %exit
+case49:
+  %r49 = mul i32 %x, 11
+  br label %exit
+case50:
+  %r50 = mul i32 %x, 12
+  br label %exit
+case51:
+  %r51 = mul i32 %x, 13
+  br label %exit
+case52:
+  %r52 = mul i32 %x, 1
+  br label %exit
+case53:
+  %r53 = mul i32 %x, 2
+  br label %exit
+case54:
+  %r54 = mul i32 %x, 3
+  br label %exit
+case55:
+  %r55 = mul i32 %x, 4
+  br label %exit
+case56:
+  %r56 = mul i32 %x, 5
+  br label %exit
+case57:
+  %r57 = mul i32 %x, 6
+  br label %exit
+case58:
+  %r58 = mul i32 %x, 7
+  br label %exit
+case59:
+  %r59 = mul i32 %x, 8
+  br label %exit
+case60:
+  %r60 = mul i32 %x, 9
+  br label %exit
+case61:
+  %r61 = mul i32 %x, 10
+  br label %exit
+case62:
+  %r62 = mul i32 %x, 11
+  br label %exit
+case63:
+  %r63 = mul i32 %x, 12
+  br label %exit
+case64:
+  %r64 = mul i32 %x, 13
+  br label %exit
+case65:
+  %r65 = mul i32 %x, 1
+  br label %exit
+case66:
+  %r66 = mul i32 %x, 2
+  br label %exit
+case67:
+  %r67 = mul i32 %x, 3
+  br label %exit
+case68:
+  %r68 = mul i32 %x, 4
+  br label %exit
+case69:
+  %r69 = mul i32 %x, 5
+  br label %exit
+case70:
+  %r70 = mul i32 %x, 6
+  br label %exit
+case71:
+  %r71 = mul i32 %x, 7
+  br label %exit
+case72:
+  %r72 = mul i32 %x, 8
+  br label %exit
+case73:
+  %r73 = mul i32 %x, 9
+  br label %exit
+case74:
+  %r74 = mul i32 %x, 10
+  br label %exit
+case75:
+  %r75 = mul i32 %x, 11
+  br label %exit
+case76:
+  %r76 = mul i32 %x, 12
+  br label %exit
+case77:
+  %r77 = mul i32 %x, 13
+  br label %exit
+case78:
+  %r78 = mul i32 %x, 1
+  br label %exit
+case79:
+  %r79 = mul i32 %x, 2
+  br label %exit
+case80:
+  %r80 = mul i32 %x, 3
+  br label %exit
+case81:
+  %r81 = mul i32 %x, 4
+  br label %exit
+case82:
+  %r82 = mul i32 %x, 5
+  br label %exit
+case83:
+  %r83 = mul i32 %x, 6
+  br label %exit
+case84:
+  %r84 = mul i32 %x, 7
+  br label %exit
+case85:
+  %r85 = mul i32 %x, 8
+  br label %exit
+case86:
+  %r86 = mul i32 %x, 9
+  br label %exit
+case87:
+  %r87 = mul i32 %x, 10
+  br label %exit
+case88:
+  %r88 = mul i32 %x, 11
+  br label %exit
+case89:
+  %r89 = mul i32 %x, 12
+  br label %exit
+case90:
+  %r90 = mul i32 %x, 13
+  br label %exit
+case91:
+  %r91 = mul i32 %x, 1
+  br label %exit
+case92:
+  %r92 = mul i32 %x, 2
+  br label %exit
+case93:
+  %r93 = mul i32 %x, 3
+  br label %exit
+case94:
+  %r94 = mul i32 %x, 4
+  br label %exit
+case95:
+  %r95 = mul i32 %x, 5
+  br label %exit
+case96:
+  %r96 = mul i32 %x, 6
+  br label %exit
+case97:
+  %r97 = mul i32 %x, 7
+  br label %exit
+case98:
+  %r98 = mul i32 %x, 8
+  br label %exit
+case99:
+  %r99 = mul i32 %x, 9
+  br label %exit
+case100:
+  %r100 = mul i32 %x, 10
+  br label %exit
+case101:
+  %r101 = mul i32 %x, 11
+  br label %exit
+case102:
+  %r102 = mul i32 %x, 12
+  br label %exit
+case103:
+  %r103 = mul i32 %x, 13
+  br label %exit
+case104:
+  %r104 = mul i32 %x, 1
+  br label %exit
+case105:
+  %r105 = mul i32 %x, 2
+  br label %exit
+case106:
+  %r106 = mul i32 %x, 3
+  br label %exit
+case107:
+  %r107 = mul i32 %x, 4
+  br label %exit
+case108:
+  %r108 = mul i32 %x, 5
+  br label %exit
+case109:
+  %r109 = mul i32 %x, 6
+  br label %exit
+case110:
+  %r110 = mul i32 %x, 7
+  br label %exit
+case111:
+  %r111 = mul i32 %x, 8
+  br label %exit
+case112:
+  %r112 = mul i32 %x, 9
+  br label %exit
+case113:
+  %r113 = mul i32 %x, 10
+  br label %exit
+case114:
+  %r114 = mul i32 %x, 11
+  br label %exit
+case115:
+  %r115 = mul i32 %x, 12
+  br label %exit
+case116:
+  %r116 = mul i32 %x, 13
+  br label %exit
+case117:
+  %r117 = mul i32 %x, 1
+  br label %exit
+case118:
+  %r118 = mul i32 %x, 2
+  br label %exit
+case119:
+  %r119 = mul i32 %x, 3
+  br label %exit
+case120:
+  %r120 = mul i32 %x, 4
+  br label %exit
+case121:
+  %r121 = mul i32 %x, 5
+  br label %exit
+case122:
+  %r122 = mul i32 %x, 6
+  br label %exit
+case123:
+  %r123 = mul i32 %x, 7
+  br label %exit
+case124:
+  %r124 = mul i32 %x, 8
+  br label %exit
+case125:
+  %r125 = mul i32 %x, 9
+  br label %exit
+case126:
+  %r126 = mul i32 %x, 10
+  br label %exit
+case127:
+  %r127 = mul i32 %x, 11
+  br label %exit
+case128:
+  %r128 = mul i32 %x, 12
+  br label %exit
+case129:
+  %r129 = mul i32 %x, 13
+  br label %exit
+case130:
+  %r130 = mul i32 %x, 1
+  br label %exit
+case131:
+  %r131 = mul i32 %x, 2
+  br label %exit
+case132:
+  %r132 = mul i32 %x, 3
+  br label %exit
+case133:
+  %r133 = mul i32 %x, 4
+  br label %exit
+case134:
+  %r134 = mul i32 %x, 5
+  br label %exit
+case135:
+  %r135 = mul i32 %x, 6
+  br label %exit
+case136:
+  %r136 = mul i32 %x, 7
+  br label %exit
+case137:
+  %r137 = mul i32 %x, 8
+  br label %exit
+case138:
+  %r138 = mul i32 %x, 9
+  br label %exit
+case139:
+  %r139 = mul i32 %x, 10
+  br label %exit
+case140:
+  %r140 = mul i32 %x, 11
+  br label %exit
+case141:
+  %r141 = mul i32 %x, 12
+  br label %exit
+case142:
+  %r142 = mul i32 %x, 13
+  br label %exit
+case143:
+  %r143 = mul i32 %x, 1
+  br label %exit
+case144:
+  %r144 = mul i32 %x, 2
+  br label %exit
+case145:
+  %r145 = mul i32 %x, 3
+  br label %exit
+case146:
+  %r146 = mul i32 %x, 4
+  br label %exit
+case147:
+  %r147 = mul i32 %x, 5
+  br label %exit
+case148:
+  %r148 = mul i32 %x, 6
+  br label %exit
+case149:
+  %r149 = mul i32 %x, 7
+  br label %exit
+case150:
+  %r150 = mul i32 %x, 8
+  br label %exit
+case151:
+  %r151 = mul i32 %x, 9
+  br label %exit
+case152:
+  %r152 = mul i32 %x, 10
+  br label %exit
+case153:
+  %r153 = mul i32 %x, 11
+  br label %exit
+case154:
+  %r154 = mul i32 %x, 12
+  br label %exit
+case155:
+  %r155 = mul i32 %x, 13
+  br label %exit
+case156:
+  %r156 = mul i32 %x, 1
+  br label %exit
+case157:
+  %r157 = mul i32 %x, 2
+  br label %exit
+case158:
+  %r158 = mul i32 %x, 3
+  br label %exit
+case159:
+  %r159 = mul i32 %x, 4
+  br label %exit
+case160:
+  %r160 = mul i32 %x, 5
+  br label %exit
+case161:
+  %r161 = mul i32 %x, 6
+  br label %exit
+case162:
+  %r162 = mul i32 %x, 7
+  br label %exit
+case163:
+  %r163 = mul i32 %x, 8
+  br label %exit
+case164:
+  %r164 = mul i32 %x, 9
+  br label %exit
+case165:
+  %r165 = mul i32 %x, 10
+  br label %exit
+case166:
+  %r166 = mul i32 %x, 11
+  br label %exit
+case167:
+  %r167 = mul i32 %x, 12
+  br label %exit
+case168:
+  %r168 = mul i32 %x, 13
+  br label %exit
+case169:
+  %r169 = mul i32 %x, 1
+  br label %exit
+case170:
+  %r170 = mul i32 %x, 2
+  br label %exit
+case171:
+  %r171 = mul i32 %x, 3
+  br label %exit
+case172:
+  %r172 = mul i32 %x, 4
+  br label %exit
+case173:
+  %r173 = mul i32 %x, 5
+  br label %exit
+case174:
+  %r174 = mul i32 %x, 6
+  br label %exit
+case175:
+  %r175 = mul i32 %x, 7
+  br label %exit
+case176:
+  %r176 = mul i32 %x, 8
+  br label %exit
+case177:
+  %r177 = mul i32 %x, 9
+  br label %exit
+case178:
+  %r178 = mul i32 %x, 10
+  br label %exit
+case179:
+  %r179 = mul i32 %x, 11
+  br label %exit
+case180:
+  %r180 = mul i32 %x, 12
+  br label %exit
+case181:
+  %r181 = mul i32 %x, 13
+  br label %exit
+case182:
+  %r182 = mul i32 %x, 1
+  br label %exit
+case183:
+  %r183 = mul i32 %x, 2
+  br label %exit
+case184:
+  %r184 = mul i32 %x, 3
+  br label %exit
+case185:
+  %r185 = mul i32 %x, 4
+  br label %exit
+case186:
+  %r186 = mul i32 %x, 5
+  br label %exit
+case187:
+  %r187 = mul i32 %x, 6
+  br label %exit
+case188:
+  %r188 = mul i32 %x, 7
+  br label %exit
+case189:
+  %r189 = mul i32 %x, 8
+  br label %exit
+case190:
+  %r190 = mul i32 %x, 9
+  br label %exit
+case191:
+  %r191 = mul i32 %x, 10
+  br label %exit
+case192:
+  %r192 = mul i32 %x, 11
+  br label %exit
+case193:
+  %r193 = mul i32 %x, 12
+  br label %exit
+case194:
+  %r194 = mul i32 %x, 13
+  br label %exit
+case195:
+  %r195 = mul i32 %x, 1
+  br label %exit
+case196:
+  %r196 = mul i32 %x, 2
+  br label %exit
+case197:
+  %r197 = mul i32 %x, 3
+  br label %exit
+case198:
+  %r198 = mul i32 %x, 4
+  br label %exit
+case199:
+  %r199 = mul i32 %x, 5
+  br label %exit
+case200:
+  %r200 = mul i32 %x, 6
+  br label %exit
+case201:
+  %r201 = mul i32 %x, 7
+  br label %exit
+case202:
+  %r202 = mul i32 %x, 8
+  br label %exit
+case203:
+  %r203 = mul i32 %x, 9
+  br label %exit
+case204:
+  %r204 = mul i32 %x, 10
+  br label %exit
+case205:
+  %r205 = mul i32 %x, 11
+  br label %exit
+case206:
+  %r206 = mul i32 %x, 12
+  br label %exit
+case207:
+  %r207 = mul i32 %x, 13
+  br label %exit
+case208:
+  %r208 = mul i32 %x, 1
+  br label %exit
+case209:
+  %r209 = mul i32 %x, 2
+  br label %exit
+case210:
+  %r210 = mul i32 %x, 3
+  br label %exit
+case211:
+  %r211 = mul i32 %x, 4
+  br label %exit
+case212:
+  %r212 = mul i32 %x, 5
+  br label %exit
+case213:
+  %r213 = mul i32 %x, 6
+  br label %exit
+case214:
+  %r214 = mul i32 %x, 7
+  br label %exit
+case215:
+  %r215 = mul i32 %x, 8
+  br label %exit
+case216:
+  %r216 = mul i32 %x, 9
+  br label %exit
+case217:
+  %r217 = mul i32 %x, 10
+  br label %exit
+case218:
+  %r218 = mul i32 %x, 11
+  br label %exit
+case219:
+  %r219 = mul i32 %x, 12
+  br label %exit
+case220:
+  %r220 = mul i32 %x, 13
+  br label %exit
+case221:
+  %r221 = mul i32 %x, 1
+  br label %exit
+case222:
+  %r222 = mul i32 %x, 2
+  br label %exit
+case223:
+  %r223 = mul i32 %x, 3
+  br label %exit
+case224:
+  %r224 = mul i32 %x, 4
+  br label %exit
+case225:
+  %r225 = mul i32 %x, 5
+  br label %exit
+case226:
+  %r226 = mul i32 %x, 6
+  br label %exit
+case227:
+  %r227 = mul i32 %x, 7
+  br label %exit
+case228:
+  %r228 = mul i32 %x, 8
+  br label %exit
+case229:
+  %r229 = mul i32 %x, 9
+  br label %exit
+case230:
+  %r230 = mul i32 %x, 10
+  br label %exit
+case231:
+  %r231 = mul i32 %x, 11
+  br label %exit
+case232:
+  %r232 = mul i32 %x, 12
+  br label %exit
+case233:
+  %r233 = mul i32 %x, 13
+  br label %exit
+case234:
+  %r234 = mul i32 %x, 1
+  br label %exit
+case235:
+  %r235 = mul i32 %x, 2
+  br label %exit
+case236:
+  %r236 = mul i32 %x, 3
+  br label %exit
+case237:
+  %r237 = mul i32 %x, 4
+  br label %exit
+case238:
+  %r238 = mul i32 %x, 5
+  br label %exit
+case239:
+  %r239 = mul i32 %x, 6
+  br label %exit
+case240:
+  %r240 = mul i32 %x, 7
+  br label %exit
+case241:
+  %r241 = mul i32 %x, 8
+  br label %exit
+case242:
+  %r242 = mul i32 %x, 9
+  br label %exit
+case243:
+  %r243 = mul i32 %x, 10
+  br label %exit
+case244:
+  %r244 = mul i32 %x, 11
+  br label %exit
+case245:
+  %r245 = mul i32 %x, 12
+  br label %exit
+case246:
+  %r246 = mul i32 %x, 13
+  br label %exit
+case247:
+  %r247 = mul i32 %x, 1
+  br label %exit
+case248:
+  %r248 = mul i32 %x, 2
+  br label %exit
+case249:
+  %r249 = mul i32 %x, 3
+  br label %exit
+case250:
+  %r250 = mul i32 %x, 4
+  br label %exit
+case251:
+  %r251 = mul i32 %x, 5
+  br label %exit
+case252:
+  %r252 = mul i32 %x, 6
+  br label %exit
+case253:
+  %r253 = mul i32 %x, 7
+  br label %exit
+case254:
+  %r254 = mul i32 %x, 8
+  br label %exit
+case255:
+  %r255 = mul i32 %x, 9
+  br label %exit
+case256:
+  %r256 = mul i32 %x, 10
+  br label %exit
+case257:
+  %r257 = mul i32 %x, 11
+  br label %exit
+case258:
+  %r258 = mul i32 %x, 12
+  br label %exit
+case259:
+  %r259 = mul i32 %x, 13
+  br label %exit
+case260:
+  %r260 = mul i32 %x, 1
+  br label %exit
+case261:
+  %r261 = mul i32 %x, 2
+  br label %exit
+case262:
+  %r262 = mul i32 %x, 3
+  br label %exit
+case263:
+  %r263 = mul i32 %x, 4
+  br label %exit
+case264:
+  %r264 = mul i32 %x, 5
+  br label %exit
+case265:
+  %r265 = mul i32 %x, 6
+  br label %exit
+case266:
+  %r266 = mul i32 %x, 7
+  br label %exit
+case267:
+  %r267 = mul i32 %x, 8
+  br label %exit
+case268:
+  %r268 = mul i32 %x, 9
+  br label %exit
+case269:
+  %r269 = mul i32 %x, 10
+  br label %exit
+case270:
+  %r270 = mul i32 %x, 11
+  br label %exit
+case271:
+  %r271 = mul i32 %x, 12
+  br label %exit
+case272:
+  %r272 = mul i32 %x, 13
+  br label %exit
+case273:
+  %r273 = mul i32 %x, 1
+  br label %exit
+case274:
+  %r274 = mul i32 %x, 2
+  br label %exit
+case275:
+  %r275 = mul i32 %x, 3
+  br label %exit
+case276:
+  %r276 = mul i32 %x, 4
+  br label %exit
+case277:
+  %r277 = mul i32 %x, 5
+  br label %exit
+case278:
+  %r278 = mul i32 %x, 6
+  br label %exit
+case279:
+  %r279 = mul i32 %x, 7
+  br label %exit
+case280:
+  %r280 = mul i32 %x, 8
+  br label %exit
+case281:
+  %r281 = mul i32 %x, 9
+  br label %exit
+case282:
+  %r282 = mul i32 %x, 10
+  br label %exit
+case283:
+  %r283 = mul i32 %x, 11
+  br label %exit
+case284:
+  %r284 = mul i32 %x, 12
+  br label %exit
+case285:
+  %r285 = mul i32 %x, 13
+  br label %exit
+case286:
+  %r286 = mul i32 %x, 1
+  br label %exit
+case287:
+  %r287 = mul i32 %x, 2
+  br label %exit
+case288:
+  %r288 = mul i32 %x, 3
+  br label %exit
+case289:
+  %r289 = mul i32 %x, 4
+  br label %exit
+case290:
+  %r290 = mul i32 %x, 5
+  br label %exit
+case291:
+  %r291 = mul i32 %x, 6
+  br label %exit
+case292:
+  %r292 = mul i32 %x, 7
+  br label %exit
+case293:
+  %r293 = mul i32 %x, 8
+  br label %exit
+case294:
+  %r294 = mul i32 %x, 9
+  br label %exit
+case295:
+  %r295 = mul i32 %x, 10
+  br label %exit
+case296:
+  %r296 = mul i32 %x, 11
+  br label %exit
+case297:
+  %r297 = mul i32 %x, 12
+  br label %exit
+case298:
+  %r298 = mul i32 %x, 13
+  br label %exit
+case299:
+  %r299 = mul i32 %x, 1
+  br label %exit
+case300:
+  %r300 = mul i32 %x, 2
+  br label %exit
+case301:
+  %r301 = mul i32 %x, 3
+  br label %exit
+case302:
+  %r302 = mul i32 %x, 4
+  br label %exit
+case303:
+  %r303 = mul i32 %x, 5
+  br label %exit
+case304:
+  %r304 = mul i32 %x, 6
+  br label %exit
+case305:
+  %r305 = mul i32 %x, 7
+  br label %exit
+case306:
+  %r306 = mul i32 %x, 8
+  br label %exit
+case307:
+  %r307 = mul i32 %x, 9
+  br label %exit
+case308:
+  %r308 = mul i32 %x, 10
+  br label %exit
+case309:
+  %r309 = mul i32 %x, 11
+  br label %exit
+case310:
+  %r310 = mul i32 %x, 12
+  br label %exit
+case311:
+  %r311 = mul i32 %x, 13
+  br label %exit
+case312:
+  %r312 = mul i32 %x, 1
+  br label %exit
+case313:
+  %r313 = mul i32 %x, 2
+  br label %exit
+case314:
+  %r314 = mul i32 %x, 3
+  br label %exit
+case315:
+  %r315 = mul i32 %x, 4
+  br label %exit
+case316:
+  %r316 = mul i32 %x, 5
+  br label %exit
+case317:
+  %r317 = mul i32 %x, 6
+  br label %exit
+case318:
+  %r318 = mul i32 %x, 7
+  br label %exit
+case319:
+  %r319 = mul i32 %x, 8
+  br label %exit
+case320:
+  %r320 = mul i32 %x, 9
+  br label %exit
+case321:
+  %r321 = mul i32 %x, 10
+  br label %exit
+case322:
+  %r322 = mul i32 %x, 11
+  br label %exit
+case323:
+  %r323 = mul i32 %x, 12
+  br label %exit
+case324:
+  %r324 = mul i32 %x, 13
+  br label %exit
+case325:
+  %r325 = mul i32 %x, 1
+  br label %exit
+case326:
+  %r326 = mul i32 %x, 2
+  br label %exit
+case327:
+  %r327 = mul i32 %x, 3
+  br label %exit
+case328:
+  %r328 = mul i32 %x, 4
+  br label %exit
+case329:
+  %r329 = mul i32 %x, 5
+  br label %exit
+case330:
+  %r330 = mul i32 %x, 6
+  br label %exit
+case331:
+  %r331 = mul i32 %x, 7
+  br label %exit
+case332:
+  %r332 = mul i32 %x, 8
+  br label %exit
+case333:
+  %r333 = mul i32 %x, 9
+  br label %exit
+case334:
+  %r334 = mul i32 %x, 10
+  br label %exit
+case335:
+  %r335 = mul i32 %x, 11
+  br label %exit
+case336:
+  %r336 = mul i32 %x, 12
+  br label %exit
+case337:
+  %r337 = mul i32 %x, 13
+  br label %exit
+case338:
+  %r338 = mul i32 %x, 1
+  br label %exit
+case339:
+  %r339 = mul i32 %x, 2
+  br label %exit
+case340:
+  %r340 = mul i32 %x, 3
+  br label %exit
+case341:
+  %r341 = mul i32 %x, 4
+  br label %exit
+case342:
+  %r342 = mul i32 %x, 5
+  br label %exit
+case343:
+  %r343 = mul i32 %x, 6
+  br label %exit
+case344:
+  %r344 = mul i32 %x, 7
+  br label %exit
+case345:
+  %r345 = mul i32 %x, 8
+  br label %exit
+case346:
+  %r346 = mul i32 %x, 9
+  br label %exit
+case347:
+  %r347 = mul i32 %x, 10
+  br label %exit
+case348:
+  %r348 = mul i32 %x, 11
+  br label %exit
+case349:
+  %r349 = mul i32 %x, 12
+  br label %exit
+case350:
+  %r350 = mul i32 %x, 13
+  br label %exit
+case351:
+  %r351 = mul i32 %x, 1
+  br label %exit
+case352:
+  %r352 = mul i32 %x, 2
+  br label %exit
+case353:
+  %r353 = mul i32 %x, 3
+  br label %exit
+case354:
+  %r354 = mul i32 %x, 4
+  br label %exit
+case355:
+  %r355 = mul i32 %x, 5
+  br label %exit
+case356:
+  %r356 = mul i32 %x, 6
+  br label %exit
+case357:
+  %r357 = mul i32 %x, 7
+  br label %exit
+case358:
+  %r358 = mul i32 %x, 8
+  br label %exit
+case359:
+  %r359 = mul i32 %x, 9
+  br label %exit
+case360:
+  %r360 = mul i32 %x, 10
+  br label %exit
+case361:
+  %r361 = mul i32 %x, 11
+  br label %exit
+case362:
+  %r362 = mul i32 %x, 12
+  br label %exit
+case363:
+  %r363 = mul i32 %x, 13
+  br label %exit
+case364:
+  %r364 = mul i32 %x, 1
+  br label %exit
+case365:
+  %r365 = mul i32 %x, 2
+  br label %exit
+case366:
+  %r366 = mul i32 %x, 3
+  br label %exit
+case367:
+  %r367 = mul i32 %x, 4
+  br label %exit
+case368:
+  %r368 = mul i32 %x, 5
+  br label %exit
+case369:
+  %r369 = mul i32 %x, 6
+  br label %exit
+case370:
+  %r370 = mul i32 %x, 7
+  br label %exit
+case371:
+  %r371 = mul i32 %x, 8
+  br label %exit
+case372:
+  %r372 = mul i32 %x, 9
+  br label %exit
+case373:
+  %r373 = mul i32 %x, 10
+  br label %exit
+case374:
+  %r374 = mul i32 %x, 11
+  br label %exit
+case375:
+  %r375 = mul i32 %x, 12
+  br label %exit
+case376:
+  %r376 = mul i32 %x, 13
+  br label %exit
+case377:
+  %r377 = mul i32 %x, 1
+  br label %exit
+case378:
+  %r378 = mul i32 %x, 2
+  br label %exit
+case379:
+  %r379 = mul i32 %x, 3
+  br label %exit
+case380:
+  %r380 = mul i32 %x, 4
+  br label %exit
+case381:
+  %r381 = mul i32 %x, 5
+  br label %exit
+case382:
+  %r382 = mul i32 %x, 6
+  br label %exit
+case383:
+  %r383 = mul i32 %x, 7
+  br label %exit
+case384:
+  %r384 = mul i32 %x, 8
+  br label %exit
+case385:
+  %r385 = mul i32 %x, 9
+  br label %exit
+case386:
+  %r386 = mul i32 %x, 10
+  br label %exit
+case387:
+  %r387 = mul i32 %x, 11
+  br label %exit
+case388:
+  %r388 = mul i32 %x, 12
+  br label %exit
+case389:
+  %r389 = mul i32 %x, 13
+  br label %exit
+case390:
+  %r390 = mul i32 %x, 1
+  br label %exit
+case391:
+  %r391 = mul i32 %x, 2
+  br label %exit
+case392:
+  %r392 = mul i32 %x, 3
+  br label %exit
+case393:
+  %r393 = mul i32 %x, 4
+  br label %exit
+case394:
+  %r394 = mul i32 %x, 5
+  br label %exit
+case395:
+  %r395 = mul i32 %x, 6
+  br label %exit
+case396:
+  %r396 = mul i32 %x, 7
+  br label %exit
+case397:
+  %r397 = mul i32 %x, 8
+  br label %exit
+case398:
+  %r398 = mul i32 %x, 9
+  br label %exit
+case399:
+  %r399 = mul i32 %x, 10
+  br label %exit
+case400:
+  %r400 = mul i32 %x, 11
+  br label %exit
+case401:
+  %r401 = mul i32 %x, 12
+  br label %exit
+case402:
+  %r402 = mul i32 %x, 13
+  br label %exit
+case403:
+  %r403 = mul i32 %x, 1
+  br label %exit
+case404:
+  %r404 = mul i32 %x, 2
+  br label %exit
+case405:
+  %r405 = mul i32 %x, 3
+  br label %exit
+case406:
+  %r406 = mul i32 %x, 4
+  br label %exit
+case407:
+  %r407 = mul i32 %x, 5
+  br label %exit
+case408:
+  %r408 = mul i32 %x, 6
+  br label %exit
+case409:
+  %r409 = mul i32 %x, 7
+  br label %exit
+case410:
+  %r410 = mul i32 %x, 8
+  br label %exit
+case411:
+  %r411 = mul i32 %x, 9
+  br label %exit
+case412:
+  %r412 = mul i32 %x, 10
+  br label %exit
+case413:
+  %r413 = mul i32 %x, 11
+  br label %exit
+case414:
+  %r414 = mul i32 %x, 12
+  br label %exit
+case415:
+  %r415 = mul i32 %x, 13
+  br label %exit
+case416:
+  %r416 = mul i32 %x, 1
+  br label %exit
+case417:
+  %r417 = mul i32 %x, 2
+  br label %exit
+case418:
+  %r418 = mul i32 %x, 3
+  br label %exit
+case419:
+  %r419 = mul i32 %x, 4
+  br label %exit
+case420:
+  %r420 = mul i32 %x, 5
+  br label %exit
+case421:
+  %r421 = mul i32 %x, 6
+  br label %exit
+case422:
+  %r422 = mul i32 %x, 7
+  br label %exit
+case423:
+  %r423 = mul i32 %x, 8
+  br label %exit
+case424:
+  %r424 = mul i32 %x, 9
+  br label %exit
+case425:
+  %r425 = mul i32 %x, 10
+  br label %exit
+case426:
+  %r426 = mul i32 %x, 11
+  br label %exit
+case427:
+  %r427 = mul i32 %x, 12
+  br label %exit
+case428:
+  %r428 = mul i32 %x, 13
+  br label %exit
+case429:
+  %r429 = mul i32 %x, 1
+  br label %exit
+case430:
+  %r430 = mul i32 %x, 2
+  br label %exit
+case431:
+  %r431 = mul i32 %x, 3
+  br label %exit
+case432:
+  %r432 = mul i32 %x, 4
+  br label %exit
+case433:
+  %r433 = mul i32 %x, 5
+  br label %exit
+case434:
+  %r434 = mul i32 %x, 6
+  br label %exit
+case435:
+  %r435 = mul i32 %x, 7
+  br label %exit
+case436:
+  %r436 = mul i32 %x, 8
+  br label %exit
+case437:
+  %r437 = mul i32 %x, 9
+  br label %exit
+case438:
+  %r438 = mul i32 %x, 10
+  br label %exit
+case439:
+  %r439 = mul i32 %x, 11
+  br label %exit
+case440:
+  %r440 = mul i32 %x, 12
+  br label %exit
+case441:
+  %r441 = mul i32 %x, 13
+  br label %exit
+case442:
+  %r442 = mul i32 %x, 1
+  br label %exit
+case443:
+  %r443 = mul i32 %x, 2
+  br label %exit
+case444:
+  %r444 = mul i32 %x, 3
+  br label %exit
+case445:
+  %r445 = mul i32 %x, 4
+  br label %exit
+case446:
+  %r446 = mul i32 %x, 5
+  br label %exit
+case447:
+  %r447 = mul i32 %x, 6
+  br label %exit
+case448:
+  %r448 = mul i32 %x, 7
+  br label %exit
+case449:
+  %r449 = mul i32 %x, 8
+  br label %exit
+case450:
+  %r450 = mul i32 %x, 9
+  br label %exit
+case451:
+  %r451 = mul i32 %x, 10
+  br label %exit
+case452:
+  %r452 = mul i32 %x, 11
+  br label %exit
+case453:
+  %r453 = mul i32 %x, 12
+  br label %exit
+case454:
+  %r454 = mul i32 %x, 13
+  br label %exit
+case455:
+  %r455 = mul i32 %x, 1
+  br label %exit
+case456:
+  %r456 = mul i32 %x, 2
+  br label %exit
+case457:
+  %r457 = mul i32 %x, 3
+  br label %exit
+case458:
+  %r458 = mul i32 %x, 4
+  br label %exit
+case459:
+  %r459 = mul i32 %x, 5
+  br label %exit
+case460:
+  %r460 = mul i32 %x, 6
+  br label %exit
+case461:
+  %r461 = mul i32 %x, 7
+  br label %exit
+case462:
+  %r462 = mul i32 %x, 8
+  br label %exit
+case463:
+  %r463 = mul i32 %x, 9
+  br label %exit
+case464:
+  %r464 = mul i32 %x, 10
+  br label %exit
+case465:
+  %r465 = mul i32 %x, 11
+  br label %exit
+case466:
+  %r466 = mul i32 %x, 12
+  br label %exit
+case467:
+  %r467 = mul i32 %x, 13
+  br label %exit
+case468:
+  %r468 = mul i32 %x, 1
+  br label %exit
+case469:
+  %r469 = mul i32 %x, 2
+  br label %exit
+case470:
+  %r470 = mul i32 %x, 3
+  br label %exit
+case471:
+  %r471 = mul i32 %x, 4
+  br label %exit
+case472:
+  %r472 = mul i32 %x, 5
+  br label %exit
+case473:
+  %r473 = mul i32 %x, 6
+  br label %exit
+case474:
+  %r474 = mul i32 %x, 7
+  br label %exit
+case475:
+  %r475 = mul i32 %x, 8
+  br label %exit
+case476:
+  %r476 = mul i32 %x, 9
+  br label %exit
+case477:
+  %r477 = mul i32 %x, 10
+  br label %exit
+case478:
+  %r478 = mul i32 %x, 11
+  br label %exit
+case479:
+  %r479 = mul i32 %x, 12
+  br label %exit
+case480:
+  %r480 = mul i32 %x, 13
+  br label %exit
+case481:
+  %r481 = mul i32 %x, 1
+  br label %exit
+case482:
+  %r482 = mul i32 %x, 2
+  br label %exit
+case483:
+  %r483 = mul i32 %x, 3
+  br label %exit
+case484:
+  %r484 = mul i32 %x, 4
+  br label %exit
+case485:
+  %r485 = mul i32 %x, 5
+  br label %exit
+case486:
+  %r486 = mul i32 %x, 6
+  br label %exit
+case487:
+  %r487 = mul i32 %x, 7
+  br label %exit
+case488:
+  %r488 = mul i32 %x, 8
+  br label %exit
+case489:
+  %r489 = mul i32 %x, 9
+  br label %exit
+case490:
+  %r490 = mul i32 %x, 10
+  br label %exit
+case491:
+  %r491 = mul i32 %x, 11
+  br label %exit
+case492:
+  %r492 = mul i32 %x, 12
+  br label %exit
+case493:
+  %r493 = mul i32 %x, 13
+  br label %exit
+case494:
+  %r494 = mul i32 %x, 1
+  br label %exit
+case495:
+  %r495 = mul i32 %x, 2
+  br label %exit
+case496:
+  %r496 = mul i32 %x, 3
+  br label %exit
+case497:
+  %r497 = mul i32 %x, 4
+  br label %exit
+case498:
+  %r498 = mul i32 %x, 5
+  br label %exit
+case499:
+  %r499 = mul i32 %x, 6
+  br label %exit
+case500:
+  %r500 = mul i32 %x, 7
+  br label %exit
+case501:
+  %r501 = mul i32 %x, 8
+  br label %exit
+case502:
+  %r502 = mul i32 %x, 9
+  br label %exit
+case503:
+  %r503 = mul i32 %x, 10
+  br label %exit
+case504:
+  %r504 = mul i32 %x, 11
+  br label %exit
+case505:
+  %r505 = mul i32 %x, 12
+  br label %exit
+case506:
+  %r506 = mul i32 %x, 13
+  br label %exit
+case507:
+  %r507 = mul i32 %x, 1
+  br label %exit
+case508:
+  %r508 = mul i32 %x, 2
+  br label %exit
+case509:
+  %r509 = mul i32 %x, 3
+  br label %exit
+case510:
+  %r510 = mul i32 %x, 4
+  br label %exit
+case511:
+  %r511 = mul i32 %x, 5
+  br label %exit
+default:
+  br label %exit
+exit:
+  %r = phi i32 [ %r0, %case0 ], [ %r1, %case1 ], [ %r2, %case2 ], [ %r3, %case3 ], [ %r4, %case4 ], [ %r5, %case5 ], [ %r6, %case6 ], [ %r7, %case7 ], [ %r8, %case8 ], [ %r9, %case9 ], [ %r10, %case10 ], [ %r11, %case11 ], [ %r12, %case12 ], [ %r13, %case13 ], [ %r14, %case14 ], [ %r15, %case15 ], [ %r16, %case16 ], [ %r17, %case17 ], [ %r18, %case18 ], [ %r19, %case19 ], [ %r20, %case20 ], [ %r21, %case21 ], [ %r22, %case22 ], [ %r23, %case23 ], [ %r24, %case24 ], [ %r25, %case25 ], [ %r26, %case26 ], [ %r27, %case27 ], [ %r28, %case28 ], [ %r29, %case29 ], [ %r30, %case30 ], [ %r31, %case31 ], [ %r32, %case32 ], [ %r33, %case33 ], [ %r34, %case34 ], [ %r35, %case35 ], [ %r36, %case36 ], [ %r37, %case37 ], [ %r38, %case38 ], [ %r39, %case39 ], [ %r40, %case40 ], [ %r41, %case41 ], [ %r42, %case42 ], [ %r43, %case43 ], [ %r44, %case44 ], [ %r45, %case45 ], [ %r46, %case46 ], [ %r47, %case47 ], [ %r48, %case48 ], [ %r49, %case49 ], [ %r50, %case50 ], [ %r51, %case51 ], [ %r52, %case52 ], [ %r53, %case53 ], [ %r54, %case54 ], [ %r55, %case55 ], [ %r56, %case56 ], [ %r57, %case57 ], [ %r58, %case58 ], [ %r59, %case59 ], [ %r60, %case60 ], [ %r61, %case61 ], [ %r62, %case62 ], [ %r63, %case63 ], [ %r64, %case64 ], [ %r65, %case65 ], [ %r66, %case66 ], [ %r67, %case67 ], [ %r68, %case68 ], [ %r69, %case69 ], [ %r70, %case70 ], [ %r71, %case71 ], [ %r72, %case72 ], [ %r73, %case73 ], [ %r74, %case74 ], [ %r75, %case75 ], [ %r76, %case76 ], [ %r77, %case77 ], [ %r78, %case78 ], [ %r79, %case79 ], [ %r80, %case80 ], [ %r81, %case81 ], [ %r82, %case82 ], [ %r83, %case83 ], [ %r84, %case84 ], [ %r85, %case85 ], [ %r86, %case86 ], [ %r87, %case87 ], [ %r88, %case88 ], [ %r89, %case89 ], [ %r90, %case90 ], [ %r91, %case91 ], [ %r92, %case92 ], [ %r93, %case93 ], [ %r94, %case94 ], [ %r95, %case95 ], [ %r96, %case96 ], [ %r97, %case97 ], [ %r98, %case98 ], [ %r99, %case99 ], [ %r100, %case100 ], [ %r101, %case101 ], [ %r102, %case102 ], [ %r103, %case103 ], [ %r104, %case104 ], [ %r105, %case105 ], [ %r106, %case106 ], [ %r107, %case107 ], [ %r108, %case108 ], [ %r109, %case109 ], [ %r110, %case110 ], [ %r111, %case111 ], [ %r112, %case112 ], [ %r113, %case113 ], [ %r114, %case114 ], [ %r115, %case115 ], [ %r116, %case116 ], [ %r117, %case117 ], [ %r118, %case118 ], [ %r119, %case119 ], [ %r120, %case120 ], [ %r121, %case121 ], [ %r122, %case122 ], [ %r123, %case123 ], [ %r124, %case124 ], [ %r125, %case125 ], [ %r126, %case126 ], [ %r127, %case127 ], [ %r128, %case128 ], [ %r129, %case129 ], [ %r130, %case130 ], [ %r131, %case131 ], [ %r132, %case132 ], [ %r133, %case133 ], [ %r134, %case134 ], [ %r135, %case135 ], [ %r136, %case136 ], [ %r137, %case137 ], [ %r138, %case138 ], [ %r139, %case139 ], [ %r140, %case140 ], [ %r141, %case141 ], [ %r142, %case142 ], [ %r143, %case143 ], [ %r144, %case144 ], [ %r145, %case145 ], [ %r146, %case146 ], [ %r147, %case147 ], [ %r148, %case148 ], [ %r149, %case149 ], [ %r150, %case150 ], [ %r151, %case151 ], [ %r152, %case152 ], [ %r153, %case153 ], [ %r154, %case154 ], [ %r155, %case155 ], [ %r156, %case156 ], [ %r157, %case157 ], [ %r158, %case158 ], [ %r159, %case159 ], [ %r160, %case160 ], [ %r161, %case161 ], [ %r162, %case162 ], [ %r163, %case163 ], [ %r164, %case164 ], [ %r165, %case165 ], [ %r166, %case166 ], [ %r167, %case167 ], [ %r168, %case168 ], [ %r169, %case169 ], [ %r170, %case170 ], [ %r171, %case171 ], [ %r172, %case172 ], [ %r173, %case173 ], [ %r174, %case174 ], [ %r175, %case175 ], [ %r176, %case176 ], [ %r177, %case177 ], [ %r178, %case178 ], [ %r179, %case179 ], [ %r180, %case180 ], [ %r181, %case181 ], [ %r182, %case182 ], [ %r183, %case183 ], [ %r184, %case184 ], [ %r185, %case185 ], [ %r186, %case186 ], [ %r187, %case187 ], [ %r188, %case188 ], [ %r189, %case189 ], [ %r190, %case190 ], [ %r191, %case191 ], [ %r192, %case192 ], [ %r193, %case193 ], [ %r194, %case194 ], [ %r195, %case195 ], [ %r196, %case196 ], [ %r197, %case197 ], [ %r198, %case198 ], [ %r199, %case199 ], [ %r200, %case200 ], [ %r201, %case201 ], [ %r202, %case202 ], [ %r203, %case203 ], [ %r204, %case204 ], [ %r205, %case205 ], [ %r206, %case206 ], [ %r207, %case207 ], [ %r208, %case208 ], [ %r209, %case209 ], [ %r210, %case210 ], [ %r211, %case211 ], [ %r212, %case212 ], [ %r213, %case213 ], [ %r214, %case214 ], [ %r215, %case215 ], [ %r216, %case216 ], [ %r217, %case217 ], [ %r218, %case218 ], [ %r219, %case219 ], [ %r220, %case220 ], [ %r221, %case221 ], [ %r222, %case222 ], [ %r223, %case223 ], [ %r224, %case224 ], [ %r225, %case225 ], [ %r226, %case226 ], [ %r227, %case227 ], [ %r228, %case228 ], [ %r229, %case229 ], [ %r230, %case230 ], [ %r231, %case231 ], [ %r232, %case232 ], [ %r233, %case233 ], [ %r234, %case234 ], [ %r235, %case235 ], [ %r236, %case236 ], [ %r237, %case237 ], [ %r238, %case238 ], [ %r239, %case239 ], [ %r240, %case240 ], [ %r241, %case241 ], [ %r242, %case242 ], [ %r243, %case243 ], [ %r244, %case244 ], [ %r245, %case245 ], [ %r246, %case246 ], [ %r247, %case247 ], [ %r248, %case248 ], [ %r249, %case249 ], [ %r250, %case250 ], [ %r251, %case251 ], [ %r252, %case252 ], [ %r253, %case253 ], [ %r254, %case254 ], [ %r255, %case255 ], [ %r256, %case256 ], [ %r257, %case257 ], [ %r258, %case258 ], [ %r259, %case259 ], [ %r260, %case260 ], [ %r261, %case261 ], [ %r262, %case262 ], [ %r263, %case263 ], [ %r264, %case264 ], [ %r265, %case265 ], [ %r266, %case266 ], [ %r267, %case267 ], [ %r268, %case268 ], [ %r269, %case269 ], [ %r270, %case270 ], [ %r271, %case271 ], [ %r272, %case272 ], [ %r273, %case273 ], [ %r274, %case274 ], [ %r275, %case275 ], [ %r276, %case276 ], [ %r277, %case277 ], [ %r278, %case278 ], [ %r279, %case279 ], [ %r280, %case280 ], [ %r281, %case281 ], [ %r282, %case282 ], [ %r283, %case283 ], [ %r284, %case284 ], [ %r285, %case285 ], [ %r286, %case286 ], [ %r287, %case287 ], [ %r288, %case288 ], [ %r289, %case289 ], [ %r290, %case290 ], [ %r291, %case291 ], [ %r292, %case292 ], [ %r293, %case293 ], [ %r294, %case294 ], [ %r295, %case295 ], [ %r296, %case296 ], [ %r297, %case297 ], [ %r298, %case298 ], [ %r299, %case299 ], [ %r300, %case300 ], [ %r301, %case301 ], [ %r302, %case302 ], [ %r303, %case303 ], [ %r304, %case304 ], [ %r305, %case305 ], [ %r306, %case306 ], [ %r307, %case307 ], [ %r308, %case308 ], [ %r309, %case309 ], [ %r310, %case310 ], [ %r311, %case311 ], [ %r312, %case312 ], [ %r313, %case313 ], [ %r314, %case314 ], [ %r315, %case315 ], [ %r316, %case316 ], [ %r317, %case317 ], [ %r318, %case318 ], [ %r319, %case319 ], [ %r320, %case320 ], [ %r321, %case321 ], [ %r322, %case322 ], [ %r323, %case323 ], [ %r324, %case324 ], [ %r325, %case325 ], [ %r326, %case326 ], [ %r327, %case327 ], [ %r328, %case328 ], [ %r329, %case329 ], [ %r330, %case330 ], [ %r331, %case331 ], [ %r332, %case332 ], [ %r333, %case333 ], [ %r334, %case334 ], [ %r335, %case335 ], [ %r336, %case336 ], [ %r337, %case337 ], [ %r338, %case338 ], [ %r339, %case339 ], [ %r340, %case340 ], [ %r341, %case341 ], [ %r342, %case342 ], [ %r343, %case343 ], [ %r344, %case344 ], [ %r345, %case345 ], [ %r346, %case346 ], [ %r347, %case347 ], [ %r348, %case348 ], [ %r349, %case349 ], [ %r350, %case350 ], [ %r351, %case351 ], [ %r352, %case352 ], [ %r353, %case353 ], [ %r354, %case354 ], [ %r355, %case355 ], [ %r356, %case356 ], [ %r357, %case357 ], [ %r358, %case358 ], [ %r359, %case359 ], [ %r360, %case360 ], [ %r361, %case361 ], [ %r362, %case362 ], [ %r363, %case363 ], [ %r364, %case364 ], [ %r365, %case365 ], [ %r366, %case366 ], [ %r367, %case367 ], [ %r368, %case368 ], [ %r369, %case369 ], [ %r370, %case370 ], [ %r371, %case371 ], [ %r372, %case372 ], [ %r373, %case373 ], [ %r374, %case374 ], [ %r375, %case375 ], [ %r376, %case376 ], [ %r377, %case377 ], [ %r378, %case378 ], [ %r379, %case379 ], [ %r380, %case380 ], [ %r381, %case381 ], [ %r382, %case382 ], [ %r383, %case383 ], [ %r384, %case384 ], [ %r385, %case385 ], [ %r386, %case386 ], [ %r387, %case387 ], [ %r388, %case388 ], [ %r389, %case389 ], [ %r390, %case390 ], [ %r391, %case391 ], [ %r392, %case392 ], [ %r393, %case393 ], [ %r394, %case394 ], [ %r395, %case395 ], [ %r396, %case396 ], [ %r397, %case397 ], [ %r398, %case398 ], [ %r399, %case399 ], [ %r400, %case400 ], [ %r401, %case401 ], [ %r402, %case402 ], [ %r403, %case403 ], [ %r404, %case404 ], [ %r405, %case405 ], [ %r406, %case406 ], [ %r407, %case407 ], [ %r408, %case408 ], [ %r409, %case409 ], [ %r410, %case410 ], [ %r411, %case411 ], [ %r412, %case412 ], [ %r413, %case413 ], [ %r414, %case414 ], [ %r415, %case415 ], [ %r416, %case416 ], [ %r417, %case417 ], [ %r418, %case418 ], [ %r419, %case419 ], [ %r420, %case420 ], [ %r421, %case421 ], [ %r422, %case422 ], [ %r423, %case423 ], [ %r424, %case424 ], [ %r425, %case425 ], [ %r426, %case426 ], [ %r427, %case427 ], [ %r428, %case428 ], [ %r429, %case429 ], [ %r430, %case430 ], [ %r431, %case431 ], [ %r432, %case432 ], [ %r433, %case433 ], [ %r434, %case434 ], [ %r435, %case435 ], [ %r436, %case436 ], [ %r437, %case437 ], [ %r438, %case438 ], [ %r439, %case439 ], [ %r440, %case440 ], [ %r441, %case441 ], [ %r442, %case442 ], [ %r443, %case443 ], [ %r444, %case444 ], [ %r445, %case445 ], [ %r446, %case446 ], [ %r447, %case447 ], [ %r448, %case448 ], [ %r449, %case449 ], [ %r450, %case450 ], [ %r451, %case451 ], [ %r452, %case452 ], [ %r453, %case453 ], [ %r454, %case454 ], [ %r455, %case455 ], [ %r456, %case456 ], [ %r457, %case457 ], [ %r458, %case458 ], [ %r459, %case459 ], [ %r460, %case460 ], [ %r461, %case461 ], [ %r462, %case462 ], [ %r463, %case463 ], [ %r464, %case464 ], [ %r465, %case465 ], [ %r466, %case466 ], [ %r467, %case467 ], [ %r468, %case468 ], [ %r469, %case469 ], [ %r470, %case470 ], [ %r471, %case471 ], [ %r472, %case472 ], [ %r473, %case473 ], [ %r474, %case474 ], [ %r475, %case475 ], [ %r476, %case476 ], [ %r477, %case477 ], [ %r478, %case478 ], [ %r479, %case479 ], [ %r480, %case480 ], [ %r481, %case481 ], [ %r482, %case482 ], [ %r483, %case483 ], [ %r484, %case484 ], [ %r485, %case485 ], [ %r486, %case486 ], [ %r487, %case487 ], [ %r488, %case488 ], [ %r489, %case489 ], [ %r490, %case490 ], [ %r491, %case491 ], [ %r492, %case492 ], [ %r493, %case493 ], [ %r494, %case494 ], [ %r495, %case495 ], [ %r496, %case496 ], [ %r497, %case497 ], [ %r498, %case498 ], [ %r499, %case499 ], [ %r500, %case500 ], [ %r501, %case501 ], [ %r502, %case502 ], [ %r503, %case503 ], [ %r504, %case504 ], [ %r505, %case505 ], [ %r506, %case506 ], [ %r507, %case507 ], [ %r508, %case508 ], [ %r509, %case509 ], [ %r510, %case510 ], [ %r511, %case511 ], [ 0, %default ]
+  ret i32 %r
+}
@@ -0,0 +1,179 @@
+; 5 point stencil index computation on an n-wide grid, inner loop unrolled 16 times before CSE:
+; every copy recomputes the row offsets, as the unroller leaves them for GVN
+define i32 @stencil_unrolled(i32 %n) {
+entry:
+  br label %i.header
+
+i.header:
+  %i = phi i32 [ 1, %entry ], [ %i.next, %i.body ]
+  %acc = phi i32 [ 0, %entry ], [ %acc.15, %i.body ]
+  %i.cmp = icmp slt i32 %i, 63
+  br i1 %i.cmp, label %i.body, label %exit
+
+i.body:
+  %row.0 = mul i32 %i, %n
+  %up.0 = sub i32 %row.0, %n
+  %down.0 = add i32 %row.0, %n
+  %c.0 = add i32 %row.0, 1
+  %w.0 = add i32 %row.0, 0
+  %e.0 = add i32 %row.0, 2
+  %nn.0 = add i32 %up.0, 1
+  %s.0 = add i32 %down.0, 1
+  %sum.0 = add i32 %nn.0, %s.0
+  %acc.0 = add i32 %acc, %sum.0
+  %row.1 = mul i32 %i, %n
+  %up.1 = sub i32 %row.1, %n
+  %down.1 = add i32 %row.1, %n
+  %c.1 = add i32 %row.1, 2
+  %w.1 = add i32 %row.1, 1
+  %e.1 = add i32 %row.1, 3
+  %nn.1 = add i32 %up.1, 2
+  %s.1 = add i32 %down.1, 2
+  %sum.1 = add i32 %nn.1, %s.1
+  %acc.1 = add i32 %acc.0, %sum.1
+  %row.2 = mul i32 %i, %n
+  %up.2 = sub i32 %row.2, %n
+  %down.2 = add i32 %row.2, %n
+  %c.2 = add i32 %row.2, 3
+  %w.2 = add i32 %row.2, 2
+  %e.2 = add i32 %row.2, 4
+  %nn.2 = add i32 %up.2, 3
+  %s.2 = add i32 %down.2, 3
+  %sum.2 = add i32 %nn.2, %s.2
+  %acc.2 = add i32 %acc.1, %sum.2
+  %row.3 = mul i32 %i, %n
+  %up.3 = sub i32 %row.3, %n
+  %down.3 = add i32 %row.3, %n
+  %c.3 = add i32 %row.3, 4
+  %w.3 = add i32 %row.3, 3
+  %e.3 = add i32 %row.3, 5
+  %nn.3 = add i32 %up.3, 4
+  %s.3 = add i32 %down.3, 4
+  %sum.3 = add i32 %nn.3, %s.3
+  %acc.3 = add i32 %acc.2, %sum.3
+  %row.4 = mul i32 %i, %n
+  %up.4 = sub i32 %row.4, %n
+  %down.4 = add i32 %row.4, %n
+  %c.4 = add i32 %row.4, 5
+  %w.4 = add i32 %row.4, 4
+  %e.4 = add i32 %row.4, 6
+  %nn.4 = add i32 %up.4, 5
+  %s.4 = add i32 %down.4, 5
+  %sum.4 = add i32 %nn.4, %s.4
+  %acc.4 = add i32 %acc.3, %sum.4
+  %row.5 = mul i32 %i, %n
+  %up.5 = sub i32 %row.5, %n
+  %down.5 = add i32 %row.5, %n
+  %c.5 = add i32 %row.5, 6
+  %w.5 = add i32 %row.5, 5
+  %e.5 = add i32 %row.5, 7
+  %nn.5 = add i32 %up.5, 6
+  %s.5 = add i32 %down.5, 6
+  %sum.5 = add i32 %nn.5, %s.5
+  %acc.5 = add i32 %acc.4, %sum.5
+  %row.6 = mul i32 %i, %n
+  %up.6 = sub i32 %row.6, %n
+  %down.6 = add i32 %row.6, %n
+  %c.6 = add i32 %row.6, 7
+  %w.6 = add i32 %row.6, 6
+  %e.6 = add i32 %row.6, 8
+  %nn.6 = add i32 %up.6, 7
+  %s.6 = add i32 %down.6, 7
+  %sum.6 = add i32 %nn.6, %s.6
+  %acc.6 = add i32 %acc.5, %sum.6
+  %row.7 = mul i32 %i, %n
+  %up.7 = sub i32 %row.7, %n
+  %down.7 = add i32 %row.7, %n
+  %c.7 = add i32 %row.7, 8
+  %w.7 = add i32 %row.7, 7
+  %e.7 = add i32 %row.7, 9
+  %nn.7 = add i32 %up.7, 8
+  %s.7 = add i32 %down.7, 8
+  %sum.7 = add i32 %nn.7, %s.7
+  %acc.7 = add i32 %acc.6, %sum.7
+  %row.8 = mul i32 %i, %n
+  %up.8 = sub i32 %row.8, %n
+  %down.8 = add i32 %row.8, %n
+  %c.8 = add i32 %row.8, 9
+  %w.8 = add i32 %row.8, 8
+  %e.8 = add i32 %row.8, 10
+  %nn.8 = add i32 %up.8, 9
+  %s.8 = add i32 %down.8, 9
+  %sum.8 = add i32 %nn.8, %s.8
+  %acc.8 = add i32 %acc.7, %sum.8
+  %row.9 = mul i32 %i, %n
+  %up.9 = sub i32 %row.9, %n
+  %down.9 = add i32 %row.9, %n
+  %c.9 = add i32 %row.9, 10
+  %w.9 = add i32 %row.9, 9
+  %e.9 = add i32 %row.9, 11
+  %nn.9 = add i32 %up.9, 10
+  %s.9 = add i32 %down.9, 10
+  %sum.9 = add i32 %nn.9, %s.9
+  %acc.9 = add i32 %acc.8, %sum.9
+  %row.10 = mul i32 %i, %n
+  %up.10 = sub i32 %row.10, %n
+  %down.10 = add i32 %row.10, %n
+  %c.10 = add i32 %row.10, 11
+  %w.10 = add i32 %row.10, 10
+  %e.10 = add i32 %row.10, 12
+  %nn.10 = add i32 %up.10, 11
+  %s.10 = add i32 %down.10, 11
+  %sum.10 = add i32 %nn.10, %s.10
+  %acc.10 = add i32 %acc.9, %sum.10
+  %row.11 = mul i32 %i, %n
+  %up.11 = sub i32 %row.11, %n
+  %down.11 = add i32 %row.11, %n
+  %c.11 = add i32 %row.11, 12
+  %w.11 = add i32 %row.11, 11
+  %e.11 = add i32 %row.11, 13
+  %nn.11 = add i32 %up.11, 12
+  %s.11 = add i32 %down.11, 12
+  %sum.11 = add i32 %nn.11, %s.11
+  %acc.11 = add i32 %acc.10, %sum.11
+  %row.12 = mul i32 %i, %n
+  %up.12 = sub i32 %row.12, %n
+  %down.12 = add i32 %row.12, %n
+  %c.12 = add i32 %row.12, 13
+  %w.12 = add i32 %row.12, 12
+  %e.12 = add i32 %row.12, 14
+  %nn.12 = add i32 %up.12, 13
+  %s.12 = add i32 %down.12, 13
+  %sum.12 = add i32 %nn.12, %s.12
+  %acc.12 = add i32 %acc.11, %sum.12
+  %row.13 = mul i32 %i, %n
+  %up.13 = sub i32 %row.13, %n
+  %down.13 = add i32 %row.13, %n
+  %c.13 = add i32 %row.13, 14
+  %w.13 = add i32 %row.13, 13
+  %e.13 = add i32 %row.13, 15
+  %nn.13 = add i32 %up.13, 14
+  %s.13 = add i32 %down.13, 14
+  %sum.13 = add i32 %nn.13, %s.13
+  %acc.13 = add i32 %acc.12, %sum.13
+  %row.14 = mul i32 %i, %n
+  %up.14 = sub i32 %row.14, %n
+  %down.14 = add i32 %row.14, %n
+  %c.14 = add i32 %row.14, 15
+  %w.14 = add i32 %row.14, 14
+  %e.14 = add i32 %row.14, 16
+  %nn.14 = add i32 %up.14, 15
+  %s.14 = add i32 %down.14, 15
+  %sum.14 = add i32 %nn.14, %s.14
+  %acc.14 = add i32 %acc.13, %sum.14
+  %row.15 = mul i32 %i, %n
+  %up.15 = sub i32 %row.15, %n
+  %down.15 = add i32 %row.15, %n
+  %c.15 = add i32 %row.15, 16
+  %w.15 = add i32 %row.15, 15
+  %e.15 = add i32 %row.15, 17
+  %nn.15 = add i32 %up.15, 16
+  %s.15 = add i32 %down.15, 16
+  %sum.15 = add i32 %nn.15, %s.15
+  %acc.15 = add i32 %acc.14, %sum.15
+  %i.next = add i32 %i, 1
+  br label %i.header
+
+exit:
+  ret i32 %acc
+}
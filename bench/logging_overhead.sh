@@ -0,0 +1,78 @@
+#!/usr/bin/env bash
+#
+# Cost of the diagnostics printed while analyzing: compares two builds of the plugin (e.g. before and after
+# the logging moved under LLVM_DEBUG) on the same module, reporting time and bytes written to stdout/stderr.
+# The module holds FUNCS functions, each one a loop with a diamond inside and a chain of BLOCKS blocks.
+#
+# usage: bench/logging_overhead.sh <baseline.so> <candidate.so> [runs]
+#
+# Both plugins are also passed with -load so that opt knows the VRA options while parsing them.
+
+set -euo pipefail
+
+BASE=${1:?usage: $0 <baseline.so> <candidate.so> [runs]}
+CAND=${2:?usage: $0 <baseline.so> <candidate.so> [runs]}
+RUNS=${3:-3}
+FUNCS=${FUNCS:-1000}
+BLOCKS=${BLOCKS:-100}
+OPT=${OPT:-opt}
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+gen_module() {
+    for ((f = 0; f < FUNCS; f++)); do
+        echo "define i32 @f$f(i1 %c) {"
+        echo "entry:"
+        echo "  br label %header"
+        echo "header:"
+        echo "  %i = phi i32 [ 0, %entry ], [ %inc, %latch ]"
+        echo "  %cmp = icmp slt i32 %i, $((f % 50 + 10))"
+        echo "  br i1 %cmp, label %then, label %chain0"
+        echo "then:"
+        echo "  %a = add i32 %i, 1"
+        echo "  br i1 %c, label %left, label %right"
+        echo "left:"
+        echo "  %l = mul i32 %a, 2"
+        echo "  br label %latch"
+        echo "right:"
+        echo "  %r = add i32 %a, 3"
+        echo "  br label %latch"
+        echo "latch:"
+        echo "  %m = phi i32 [ %l, %left ], [ %r, %right ]"
+        echo "  %inc = add i32 %i, 1"
+        echo "  br label %header"
+        echo "chain0:"
+        echo "  %v0 = add i32 %i, 1"
+        echo "  br label %chain1"
+        for ((b = 1; b <= BLOCKS; b++)); do
+            echo "chain$b:"
+            echo "  %v$b = add i32 %v$((b - 1)), 1"
+            if ((b < BLOCKS)); then
+                echo "  br label %chain$((b + 1))"
+            else
+                echo "  ret i32 %v$b"
+            fi
+        done
+        echo "}"
+    done
+}
+
+gen_module > "$TMP/module.ll"
+llvm-as "$TMP/module.ll" -o "$TMP/module.bc"
+
+printf "%-10s %12s %14s\n" "plugin" "seconds" "output bytes"
+for name in baseline candidate; do
+    if [[ $name == baseline ]]; then plugin=$BASE; else plugin=$CAND; fi
+
+    best=""
+    for ((r = 0; r < RUNS; r++)); do
+        start=$(date +%s.%N)
+        "$OPT" -load "$plugin" -load-pass-plugin "$plugin" -passes=vra \
+            -disable-output "$TMP/module.bc" > "$TMP/out.txt" 2>&1
+        end=$(date +%s.%N)
+        best=$(awk -v s="$start" -v e="$end" -v b="$best" 'BEGIN { t = e - s; if (b == "" || t < b) b = t; printf "%.3f", b }')
+    done
+
+    printf "%-10s %12s %14s\n" "$name" "$best" "$(wc -c < "$TMP/out.txt")"
+done
@@ -0,0 +1,97 @@
+#!/usr/bin/env bash
+#
+# Scaling curves of the analysis on synthetic IR: each sweep grows one parameter of vra-gen (blocks, fork nesting,
+# loop nesting, switch fan-out, phi width, globals, functions) and runs vra-bench on every point.
+#
+# For each step the growth exponent log(t2/t1) / log(p2/p1) is printed for the time and for the retained memory:
+# 1 is linear in the parameter, more than SUPERLINEAR (default 1.3) is flagged. The most nodes visited by a
+# Scope::lookup (depth) should not grow more than logarithmically: an exponent over LOOKUP_GROWTH (default 0.3)
+# is flagged. The time of a lookup (ns/lookup) is printed too, but it is too noisy to be flagged.
+# The exit status is 1 if something was flagged.
+#
+# usage: bench/scaling.sh <dir with vra-gen and vra-bench> [sweeps...]
+#        sweeps: blocks fork-depth loop-depth switch-fanout phi-width globals functions (default all)
+#
+# CSV=<file> also writes every point as CSV. Extra VRA options can be given in VRA_ARGS (e.g. -vra-threads=4).
+
+set -euo pipefail
+
+BIN=${1:?usage: $0 <dir with vra-gen and vra-bench> [sweeps...]}
+shift
+SWEEPS=${*:-blocks fork-depth loop-depth switch-fanout phi-width globals functions}
+SUPERLINEAR=${SUPERLINEAR:-1.3}
+LOOKUP_GROWTH=${LOOKUP_GROWTH:-0.3}
+REPEAT=${REPEAT:-3}
+VRA_ARGS=${VRA_ARGS:-}
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+# parameter values of each sweep, and the fixed options of its points
+sweep_values() {
+    case $1 in
+        blocks)        echo "1000 2000 4000 8000 16000" ;;
+        fork-depth)    echo "8 16 32 64 128" ;;
+        loop-depth)    echo "1 2 4 8" ;;
+        switch-fanout) echo "64 128 256 512 1024" ;;
+        phi-width)     echo "4 8 16 32 64" ;;
+        globals)       echo "1000 4000 16000 64000" ;;
+        functions)     echo "100 200 400 800" ;;
+        *) echo "unknown sweep $1" >&2; exit 2 ;;
+    esac
+}
+
+sweep_fixed() {
+    case $1 in
+        blocks)        echo "" ;;
+        fork-depth)    echo "-blocks=50" ;;
+        loop-depth)    echo "-blocks=200" ;;
+        switch-fanout) echo "-blocks=20" ;;
+        phi-width)     echo "-blocks=200" ;;
+        globals)       echo "-blocks=2000" ;;
+        functions)     echo "-blocks=20" ;;
+    esac
+}
+
+[[ -n ${CSV:-} ]] && echo "sweep,value,blocks,seconds,peak_rss_kib,retained_kib,max_lookup_depth,lookup_ns" > "$CSV"
+
+flagged=0
+printf "%-14s %7s %8s %11s %7s %13s %7s %6s %7s %10s  %s\n" \
+    "sweep" "value" "blocks" "seconds" "growth" "retained KiB" "growth" "depth" "growth" "ns/lookup" "flags"
+
+for sweep in $SWEEPS; do
+    prev=""
+    for value in $(sweep_values "$sweep"); do
+        # shellcheck disable=SC2046
+        "$BIN/vra-gen" $(sweep_fixed "$sweep") "-$sweep=$value" -o "$TMP/point.ll"
+        # shellcheck disable=SC2086
+        row=$("$BIN/vra-bench" -repeat="$REPEAT" -top-functions=0 $VRA_ARGS "$TMP/point.ll" | awk '$1 == "point.ll"')
+
+        # fields: input funcs blocks seconds blocks/s peakRSS retained depth ns/lookup operands
+        read -r _ _ blocks seconds _ rss retained depth lookup _ <<< "$row"
+        [[ -n ${CSV:-} ]] && echo "$sweep,$value,$blocks,$seconds,$rss,$retained,$depth,$lookup" >> "$CSV"
+
+        line=$(awk -v prev="$prev" -v p="$value" -v t="$seconds" -v m="$retained" -v d="$depth" \
+                   -v superlinear="$SUPERLINEAR" -v lookupGrowth="$LOOKUP_GROWTH" '
+            function growth(a, b, pa, pb) { return (a > 0 && b > 0) ? log(b / a) / log(pb / pa) : 0 }
+            BEGIN {
+                if (prev == "") { printf "%7s %7s %7s |", "-", "-", "-"; exit }
+                split(prev, q, " ")
+                gt = growth(q[2], t, q[1], p); gm = growth(q[3], m, q[1], p); gd = growth(q[4], d, q[1], p)
+                flags = ""
+                if (gt > superlinear) flags = flags " TIME"
+                if (gm > superlinear) flags = flags " MEMORY"
+                if (gd > lookupGrowth) flags = flags " LOOKUP"
+                printf "%7.2f %7.2f %7.2f |%s", gt, gm, gd, flags
+            }')
+        read -r gt gm gd <<< "${line%%|*}"
+        flags=${line#*|}
+        [[ -n $flags ]] && flagged=1
+
+        printf "%-14s %7s %8s %11s %7s %13s %7s %6s %7s %10s %s\n" \
+            "$sweep" "$value" "$blocks" "$seconds" "$gt" "$retained" "$gm" "$depth" "$gd" "$lookup" "$flags"
+        prev="$value $seconds $retained $depth"
+    done
+done
+
+exit $flagged
@@ -0,0 +1,56 @@
+#!/usr/bin/env bash
+#
+# Scaling benchmark of VRAPass::processModule over the number of analysis threads.
+# The module holds FUNCS independent functions, each one a chain of BLOCKS blocks.
+#
+# usage: bench/thread_scaling.sh <path/to/MyHelloPass.so> [threads...]
+#
+# The plugin is also passed with -load so that opt knows -vra-threads while parsing options.
+
+set -euo pipefail
+
+PLUGIN=${1:?usage: $0 <plugin.so> [threads...]}
+shift
+THREADS=${*:-1 2 4 8}
+FUNCS=${FUNCS:-2000}
+BLOCKS=${BLOCKS:-200}
+OPT=${OPT:-opt}
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+gen_module() {
+    for ((f = 0; f < FUNCS; f++)); do
+        echo "define i32 @chain$f(i1 %c) {"
+        echo "entry:"
+        echo "  %v0 = add i32 $f, 1"
+        echo "  br i1 %c, label %bb1, label %end"
+        for ((i = 1; i <= BLOCKS; i++)); do
+            echo "bb$i:"
+            echo "  %v$i = add i32 %v$((i - 1)), 1"
+            if ((i < BLOCKS)); then
+                echo "  br label %bb$((i + 1))"
+            else
+                echo "  br label %end"
+            fi
+        done
+        echo "end:"
+        echo "  ret i32 0"
+        echo "}"
+    done
+}
+
+gen_module > "$TMP/module.ll"
+llvm-as "$TMP/module.ll" -o "$TMP/module.bc"
+
+printf "%8s %12s %10s\n" "threads" "seconds" "speedup"
+base=""
+for t in $THREADS; do
+    start=$(date +%s.%N)
+    "$OPT" -load "$PLUGIN" -load-pass-plugin "$PLUGIN" -passes=vra -vra-threads="$t" \
+        -disable-output "$TMP/module.bc" > /dev/null 2>&1
+    end=$(date +%s.%N)
+    elapsed=$(awk -v s="$start" -v e="$end" 'BEGIN { printf "%.3f", e - s }')
+    base=${base:-$elapsed}
+    awk -v t="$t" -v x="$elapsed" -v b="$base" 'BEGIN { printf "%8d %12.3f %10.2f\n", t, x, b / x }'
+done